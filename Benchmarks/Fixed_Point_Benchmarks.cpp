@@ -0,0 +1,73 @@
+//============================================================================
+// Name        : Fixed_Point_Benchmarks.cpp
+// Description : throughput of the Fixed Point API kernels against the scalar operators
+//============================================================================
+
+#include <iostream>
+
+#include "../bash_tools/bash_tools.h"
+
+#include "../Fixed_Point/Fixed_Point_Static.hpp"
+#include "Fixed_Point_Benchmarks.hpp"
+
+int main()
+{
+	std::cout << italic(bold_yellow("!!! Welcome inside the Fixed Point API benchmarks !!!")) << std::endl << std::endl;
+
+	Fixed_Point_Benchmarks fpb;
+
+	// Compile with -O2 or more, and with -mavx2 or -msse4.1 to enable the larger vector kernels
+	fpb.bench_batches(FP_S< 8,4>( 3.5f), FP_S< 8,2>(-7.25f));
+	fpb.bench_batches(FP_S<16,8>( 3.5f), FP_S<16,8>(-7.25f));
+	fpb.bench_batches(FP_S<15,8>( 3.5f), FP_S<15,4>(-7.25f));
+	fpb.bench_batches(FP_S<32,16>(3.5f), FP_S<32,16>(-7.25f));
+
+	fpb.bench_conversions(FP_S< 8,4>( 3.5f));
+	fpb.bench_conversions(FP_S<16,8>( 3.5f));
+	fpb.bench_conversions(FP_S<24,8>( 3.5f));
+
+	fpb.bench_expressions(FP_S< 8,4>( 3.5f), FP_S< 8,2>(-7.25f), FP_S<16,6>(1.5f));
+	fpb.bench_expressions(FP_S<16,8>( 3.5f), FP_S<16,8>(-7.25f), FP_S<32,16>(1.5f));
+
+	fpb.bench_accumulators(FP_S<16,14>(0.75f), FP_S<16,14>(-0.5f));
+	fpb.bench_accumulators(FP_S<24,16>(3.5f),  FP_S<16,8>(-7.25f));
+
+	fpb.bench_dsp(FP_S<16,14>(0.75f), FP_S<16,14>(-0.5f));
+	fpb.bench_dsp(FP_S<24,16>(3.5f),  FP_S<20,8>(-7.25f));
+
+	fpb.bench_divisions(FP_S<16,8>(3.5f),   FP_S<16,8>(-7.25f));
+	fpb.bench_divisions(FP_S<16,14>(0.75f), FP_S<16,13>(-0.5f));
+
+	fpb.bench_math(FP_S<16,8>(3.5f));
+	fpb.bench_math(FP_S<32,16>(3.5f));
+
+	fpb.bench_luts(FP_S<16,12>(-3.5f));
+	fpb.bench_luts(FP_S<32,28>(-3.5f));
+
+	fpb.bench_policies(FP_S<16,15>(0.25f));
+	fpb.bench_policies(FP_S<32,31>(0.25f));
+	fpb.bench_unsigned(FP_U<8,8>(0.25f));
+	fpb.bench_unsigned(FP_U<16,12>(0.25f));
+	fpb.bench_rounding(FP_S<16,12>(-3.5f), FP_S<8,4>(2.5f));
+	fpb.bench_rounding(FP_S<32,24>(-3.5f), FP_S<16,8>(2.5f));
+	fpb.bench_double_words(FP_S<40,20>(-3.5f), FP_S<48,30>(2.25f));
+	fpb.bench_multi_words(FP_S<64,32>(-3.5f), FP_S<64,40>(2.25f));
+	fpb.bench_to_chars(FP_S<32,16>(-3.5f));
+	fpb.bench_to_chars(FP_S<64,40>(-3.5f));
+	fpb.bench_from_chars(FP_S<32,16>(-3.5f));
+	fpb.bench_from_chars(FP_S<64,40>(-3.5f));
+	fpb.bench_packed(FP_S<12,6>(-3.5f));
+	fpb.bench_packed(FP_S<20,10>(-3.5f));
+	fpb.bench_file(FP_S<16,8>(-3.5f));
+	fpb.bench_file(FP_S<32,16>(-3.5f));
+	fpb.bench_span(FP_S<12,6>(-3.5f));
+	fpb.bench_span(FP_S<24,16>(-3.5f));
+	fpb.bench_dynamic(FP_S<16,8>(-3.5f));
+	fpb.bench_dynamic(FP_S<12,6>(-3.5f));
+
+	Fixed_Point_Benchmarks(std::cout, 1, 10).bench_gemm(FP_S<16,14>(0.75f), FP_S<16,14>(-0.5f));
+	Fixed_Point_Benchmarks(std::cout, 1, 10).bench_gemm(FP_S<24,16>(3.5f),  FP_S<20,8>(-7.25f));
+
+	std::cout << std::endl << italic(bold_yellow("!!!Good bye!!!")) << std::endl;
+	return 0;
+}
@@ -0,0 +1,258 @@
+#ifndef FIXED_POINT_BENCHMARKS_HPP_
+#define FIXED_POINT_BENCHMARKS_HPP_
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <sstream>
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "../Fixed_Point/Fixed_Point_Static.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_batch.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_expressions.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_accumulator.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_dsp.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_gemm.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_division.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_math.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_lut.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_charconv.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_packed.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_file.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_span.hpp"
+#include "../Fixed_Point/Fixed_Point_Dynamic_array.hpp"
+
+#include "../bash_tools/bash_tools.h"
+
+class Fixed_Point_Benchmarks
+{
+private:
+	std::ostream& os;
+	size_t        n;       // number of elements of the benchmarked arrays
+	size_t        repeats; // the best time of the repeats is kept
+
+public:
+	Fixed_Point_Benchmarks(std::ostream& os = std::cout, size_t n = 1 << 16, size_t repeats = 200);
+	virtual ~Fixed_Point_Benchmarks();
+
+	/*
+	 * Methods that call different benchmarks in function of the measured thematic
+	 */
+	template <typename A, typename B>
+	void bench_batches(A a, B b);
+	template <typename A>
+	void bench_conversions(A a);
+	template <typename A, typename B, typename C>
+	void bench_expressions(A a, B b, C c);
+	template <typename A, typename B>
+	void bench_accumulators(A a, B b);
+	template <typename A, typename B>
+	void bench_dsp(A a, B b);
+	template <typename A, typename B>
+	void bench_gemm(A a, B b);
+	template <typename A, typename B>
+	void bench_divisions(A a, B b);
+	template <typename A>
+	void bench_math(A a);
+	template <typename A>
+	void bench_luts(A a);
+	template <typename A>
+	void bench_policies(A a);
+	template <typename A>
+	void bench_unsigned(A a);
+	template <typename A, typename B>
+	void bench_rounding(A a, B b);
+	template <typename A, typename B>
+	void bench_double_words(A a, B b);
+	template <typename A, typename B>
+	void bench_multi_words(A a, B b);
+	template <typename A>
+	void bench_to_chars(A a);
+	template <typename A>
+	void bench_from_chars(A a);
+	template <typename A>
+	void bench_packed(A a);
+	template <typename A>
+	void bench_file(A a);
+	template <typename A>
+	void bench_span(A a);
+	template <typename A>
+	void bench_dynamic(A a);
+
+	/*
+	 * Method that returns the best throughput of f in millions of elements per second
+	 */
+	template <class Functor>
+	double throughput(Functor f);
+
+	/*
+	 * Method that returns the best duration of f in seconds
+	 */
+	template <class Functor>
+	double best_time(Functor f);
+
+	/*
+	 * Method that displays the throughput of a kernel against the one of the scalar operator loop
+	 */
+	void bench_line(const std::string& name, double kernel, double loop, const std::string& unit = "Melem/s",
+	                const std::string& loop_name = "operator loop");
+
+	/*
+	 * Methods that measure a batch kernel against the scalar operator loop
+	 */
+	template <typename A, typename B>
+	void batch(A a, B b);
+	template <typename A>
+	void saturating_batch(A a);
+
+	/*
+	 * Method that measures the bulk conversions against operator= and convert<floating_t>() loops
+	 */
+	template <typename A, typename floating_t>
+	void conversion(A a, floating_t f, const std::string& str_f);
+
+	/*
+	 * Method that measures a lazy expression assigned in c against the same operators
+	 */
+	template <typename A, typename B, typename C>
+	void expression(A a, B b, C c);
+
+	/*
+	 * Method that measures the accumulator mac loop against acc += a*b on a Fixed_Point_Static
+	 */
+	template <typename A, typename B>
+	void mac(A a, B b);
+
+	/*
+	 * Methods that measure the dot product and the FIR filter against the sums of products with the operators
+	 */
+	template <typename A, typename B>
+	void dot(A a, B b);
+	template <size_t Ntaps, typename C, typename X>
+	void fir(C c, X x);
+
+	/*
+	 * Method that measures the matrix product against a naive triple loop with the operators and a float one
+	 */
+	template <typename A, typename B>
+	void gemm(A a, B b, size_t size);
+
+	/*
+	 * Method that measures the division variants against operator/ and the divmod against div(n, d, q, r)
+	 */
+	template <typename A, typename B>
+	void division(A a, B b);
+
+	/*
+	 * Method that measures the division by the constant of type B and raw data D against operator/
+	 */
+	template <int64_t D, typename A, typename B>
+	void division_by(A a, B b);
+
+	/*
+	 * Method that measures the square roots against the same functions called on to_double() and converted back
+	 */
+	template <typename A>
+	void square_root(A a);
+
+	/*
+	 * Method that measures sin, cos, atan2, exp, log2 and log against the same functions called on to_double() and
+	 * converted back
+	 */
+	template <typename A>
+	void transcendental(A a);
+
+	/*
+	 * Method that measures the lookups and interpolations in a table of Size samples of sin against std::sin, on
+	 * fixed points and on to_double()
+	 */
+	template <size_t Size, typename A>
+	void lookup_table(A a);
+
+	/*
+	 * Method that measures a phase accumulator and a 2 stages integrator (as in a CIC filter) in the wrapped
+	 * quantification of A against the same loops in the saturated one
+	 */
+	template <typename A>
+	void integrators(A a);
+
+	/*
+	 * Method that measures saturated a + b and a * b stored in the unsigned A against the same loops in the signed
+	 * quantification of the same range (one more bit, that often doubles the size of base_type)
+	 */
+	template <typename A>
+	void unsigned_storage(A a);
+
+	/*
+	 * Method that measures requantize_n and convert_n from float of A in the quantification of B with every rounding
+	 * mode against the assignment loops (rounded toward zero and to the nearest)
+	 */
+	template <typename A, typename B>
+	void rounding_modes(A a, B b);
+
+	template <FP_numeric::Rounding_type R, typename A, typename B>
+	void rounding_mode(const std::vector<A>& va, const std::vector<float>& vf, B b, const std::string& mode);
+
+	/*
+	 * Method that measures the operations of FP_numeric::int128_t against the ones of __int128 (if the compiler has
+	 * it), then a * b and a * b + a * b whom results have more than 64 bits
+	 */
+	template <typename A, typename B>
+	void double_words(A a, B b);
+
+	/*
+	 * Method that measures the exact a / b and (a * b)^2 whom results have more than 128 bits (multi_word base_type)
+	 * against the same operations on long double
+	 */
+	template <typename A, typename B>
+	void multi_words(A a, B b);
+
+	/*
+	 * Method that measures the decimal writings of FP_numeric::to_chars against the former display through a double
+	 * and a stringstream, and against printf of the double value
+	 */
+	template <typename A>
+	void to_chars(A a);
+
+	/*
+	 * Method that measures the parsing of FP_numeric::from_chars and read_column against strtod followed by the
+	 * operator= of the doubles
+	 */
+	template <typename A>
+	void from_chars(A a);
+
+	/*
+	 * Method that measures the vectorized pack_n and unpack_n of FP_packed against the loops of set and get on each
+	 * element
+	 */
+	template <typename A>
+	void packed(A a);
+
+	/*
+	 * Method that measures the reopening of a column file by FP_mapped (then a sum of its values) against the parsing
+	 * of the same values written as text by read_column, and against their copy by fread
+	 */
+	template <typename A>
+	void file(A a);
+
+	/*
+	 * Method that measures a batch kernel on FP_span views of raw words against the copy of the words by set_data
+	 * before the same kernel, and the in place sign_extend against the set_data loop
+	 */
+	template <typename A>
+	void span(A a);
+
+	/*
+	 * Method that measures the batch kernels on FP_dynamic_array in the quantification of a (dispatched once per call)
+	 * against the loop of the Fixed_Point_Dynamic operators, and against the static batch kernels of A
+	 */
+	template <typename A>
+	void dynamic(A a);
+};
+
+#include "Fixed_Point_Benchmarks.hxx"
+
+#endif /* FIXED_POINT_BENCHMARKS_HPP_ */
@@ -0,0 +1,1125 @@
+#ifndef FIXED_POINT_BENCHMARKS_HXX_
+#define FIXED_POINT_BENCHMARKS_HXX_
+
+#include "Fixed_Point_Benchmarks.hpp"
+
+#define os_nline    os << std::endl
+
+Fixed_Point_Benchmarks::Fixed_Point_Benchmarks(std::ostream& os, size_t n, size_t repeats)
+: os(os), n(n), repeats(repeats)
+{
+}
+
+Fixed_Point_Benchmarks::~Fixed_Point_Benchmarks()
+{
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_batches(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Batch kernels benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	batch(a,b);
+	saturating_batch(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_conversions(A a)
+{
+	std::stringstream sstream;
+	sstream << "Bulk conversions benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	conversion(a, 0.f, "float");
+	conversion(a, 0.,  "double");
+
+	os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Benchmarks::bench_expressions(A a, B b, C c)
+{
+	std::stringstream sstream;
+	sstream << "Lazy expressions benchmarks with a" << a.display_quantification() << ", b" << b.display_quantification()
+	        << " and c" << c.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	expression(a, b, c);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_accumulators(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Accumulators benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	mac(a, b);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_dsp(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "DSP benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	dot(a, b);
+	fir<16>(a, b);
+	fir<64>(a, b);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_gemm(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Matrix product benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << FP_numeric::thread_pool::global().size() + 1 << " threads)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	gemm(a, b, 64);
+	gemm(a, b, 256);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_divisions(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Divisions benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	division(a, b);
+	division_by<3>(a, b);
+	division_by<B::max().get_data()>(a, b);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_math(A a)
+{
+	std::stringstream sstream;
+	sstream << "Mathematical functions benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	square_root(a);
+	transcendental(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_luts(A a)
+{
+	std::stringstream sstream;
+	sstream << "Lookup tables benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	lookup_table<256> (a);
+	lookup_table<4096>(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_policies(A a)
+{
+	std::stringstream sstream;
+	sstream << "Overflow policies benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	integrators(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_unsigned(A a)
+{
+	std::stringstream sstream;
+	sstream << "Unsigned types benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	unsigned_storage(a);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_rounding(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Rounding modes benchmarks with a" << a.display_quantification() << " in b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	rounding_modes(a, b);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_double_words(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Double words benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	double_words(a, b);
+
+	os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::bench_multi_words(A a, B b)
+{
+	std::stringstream sstream;
+	sstream << "Multi words benchmarks with a" << a.display_quantification() << " and b" << b.display_quantification()
+	        << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	multi_words(a, b);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_to_chars(A a)
+{
+	std::stringstream sstream;
+	sstream << "To chars benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	to_chars(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_from_chars(A a)
+{
+	std::stringstream sstream;
+	sstream << "From chars benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	from_chars(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_packed(A a)
+{
+	std::stringstream sstream;
+	sstream << "Packed benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	packed(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_file(A a)
+{
+	std::stringstream sstream;
+	sstream << "File benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	file(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_span(A a)
+{
+	std::stringstream sstream;
+	sstream << "Span benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	span(a);
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::bench_dynamic(A a)
+{
+	std::stringstream sstream;
+	sstream << "Dynamic benchmarks with a" << a.display_quantification() << " (" << n << " elements)";
+	os << bold_orange(sstream.str()); os_nline;
+
+	dynamic(a);
+
+	os_nline;
+}
+
+template <class Functor>
+double Fixed_Point_Benchmarks::throughput(Functor f)
+{
+	return n / best_time(f) / 1e6;
+}
+
+template <class Functor>
+double Fixed_Point_Benchmarks::best_time(Functor f)
+{
+	double best = std::numeric_limits<double>::max();
+	for (size_t r = 0; r < repeats; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		f();
+		auto stop  = std::chrono::steady_clock::now();
+
+		best = std::min(best, std::chrono::duration<double>(stop - start).count());
+	}
+	return best;
+}
+
+void Fixed_Point_Benchmarks::bench_line(const std::string& name, double kernel, double loop, const std::string& unit,
+                                        const std::string& loop_name)
+{
+	std::stringstream sstream;
+	sstream << std::fixed << std::setprecision(1)
+	        << std::setw(18) << name << " : " << std::setw(8) << kernel << " " << unit << ",   " << loop_name << " : "
+	        << std::setw(8) << loop << " " << unit << ",   speedup : " << std::setprecision(2) << kernel / loop;
+
+	os << "\t";
+	if (kernel >= loop)
+		os << green(sstream.str());
+	else
+		os <<   red(sstream.str());
+	os_nline;
+}
+
+// the operator loops are kept out of line so that they are measured as written by a user
+template <typename A, typename B, typename R, class Functor>
+__attribute__((noinline)) void operator_loop(const A* a, const B* b, size_t n, R* res, Functor f)
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = f(a[i], b[i]);
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::batch(A a, B b)
+{
+	using add_t = typename FP_numeric::add_res_type<A,B>::type;
+	using sub_t = typename FP_numeric::sub_res_type<A,B>::type;
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+	}
+	std::vector<add_t> vadd(n);
+	std::vector<sub_t> vsub(n);
+	std::vector<mul_t> vmul(n);
+
+	bench_line("add_n",   throughput([&]{ FP_numeric::add_n  (va.data(), vb.data(), n, vadd.data()); }),
+	                      throughput([&]{ operator_loop(va.data(), vb.data(), n, vadd.data(), [](A x, B y){ return x + y; }); }));
+	bench_line("sub_n",   throughput([&]{ FP_numeric::sub_n  (va.data(), vb.data(), n, vsub.data()); }),
+	                      throughput([&]{ operator_loop(va.data(), vb.data(), n, vsub.data(), [](A x, B y){ return x - y; }); }));
+	bench_line("mul_n",   throughput([&]{ FP_numeric::mul_n  (va.data(), vb.data(), n, vmul.data()); }),
+	                      throughput([&]{ operator_loop(va.data(), vb.data(), n, vmul.data(), [](A x, B y){ return x * y; }); }));
+	bench_line("scale_n", throughput([&]{ FP_numeric::scale_n(va.data(), n, b,         vmul.data()); }),
+	                      throughput([&]{ operator_loop(va.data(), vb.data(), n, vmul.data(), [b](A x, B){ return x * b; }); }));
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::saturating_batch(A a)
+{
+	std::vector<A> va(n, a), vb(n, a), res(n);
+	for (size_t i = 0; i < n; i++)
+		vb[i].set_data(a.to_raw() * (typename A::base_type)(i % 3));
+
+	bench_line("saturating_add_n", throughput([&]{ FP_numeric::saturating_add_n(va.data(), vb.data(), n, res.data()); }),
+	                               throughput([&]{ operator_loop(va.data(), vb.data(), n, res.data(), [](A x, A y){ return (A)(x + y); }); }));
+}
+
+template <typename A, typename floating_t>
+void Fixed_Point_Benchmarks::conversion(A a, floating_t, const std::string& str_f)
+{
+	std::vector<floating_t> vf(n);
+	std::vector<A>          va(n);
+	for (size_t i = 0; i < n; i++)
+		vf[i] = a.template convert<floating_t>() * floating_t(i % 100) / floating_t(37);
+
+	bench_line(str_f + " -> FP", throughput([&]{ FP_numeric::convert_n(vf.data(), n, va.data()); }),
+	                             throughput([&]{ operator_loop(vf.data(), vf.data(), n, va.data(), [](floating_t x, floating_t){ return (A)x; }); }));
+	bench_line("FP -> " + str_f, throughput([&]{ FP_numeric::convert_n(va.data(), n, vf.data()); }),
+	                             throughput([&]{ operator_loop(va.data(), va.data(), n, vf.data(), [](A x, A){ return x.template convert<floating_t>(); }); }));
+}
+
+// same as operator_loop with a third operand
+template <typename A, typename B, typename C, class Functor>
+__attribute__((noinline)) void operator_loop(const A* a, const B* b, const C* c, size_t n, C* res, Functor f)
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = f(a[i], b[i], c[i]);
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Benchmarks::expression(A a, B b, C c)
+{
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	std::vector<C> vc(n, c), res(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+	}
+
+	bench_line("c = a*b + c", throughput([&]{ operator_loop(va.data(), vb.data(), vc.data(), n, res.data(),
+	                                                        [](A x, B y, C z){ return FP_numeric::lazy(x) * y + z; }); }),
+	                          throughput([&]{ operator_loop(va.data(), vb.data(), vc.data(), n, res.data(),
+	                                                        [](A x, B y, C z){ return x * y + z; }); }));
+	bench_line("c = (a+b)*(c-a)", throughput([&]{ operator_loop(va.data(), vb.data(), vc.data(), n, res.data(),
+	                                                        [](A x, B y, C z){ return (FP_numeric::lazy(x) + y) * (FP_numeric::lazy(z) - x); }); }),
+	                          throughput([&]{ operator_loop(va.data(), vb.data(), vc.data(), n, res.data(),
+	                                                        [](A x, B y, C z){ return (x + y) * (z - x); }); }));
+}
+
+// the result is written in res so that the loop is not seen as a pure function
+template <typename A, typename B, typename R>
+__attribute__((noinline)) void mac_loop(const A* a, const B* b, size_t n, R* res)
+{
+	R acc = 0;
+	for (size_t i = 0; i < n; i++)
+		acc += a[i] * b[i];
+	*res = acc;
+}
+
+template <typename Acc, typename A, typename B, typename R>
+__attribute__((noinline)) void accumulator_loop(const A* a, const B* b, size_t n, R* res)
+{
+	Acc acc;
+	for (size_t i = 0; i < n; i++)
+		acc.mac(a[i], b[i]);
+	*res = acc.template result<R::Tb, R::Fb>();
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::mac(A a, B b)
+{
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+	}
+
+	using acc_t = FP_numeric::accumulator<mul_t::Tb, mul_t::Fb, 17>; // 17 guard bits for the 2^16 products
+
+	A res;
+	bench_line("accumulator mac", throughput([&]{ accumulator_loop<acc_t>(va.data(), vb.data(), n, &res); }),
+	                              throughput([&]{ mac_loop               (va.data(), vb.data(), n, &res); }));
+}
+
+template <typename R, typename A, typename B>
+__attribute__((noinline)) void dot_loop(const A* a, const B* b, size_t n, R* res)
+{
+	R sum = 0;
+	for (size_t i = 0; i < n; i++)
+		sum = sum + a[i] * b[i];
+	*res = sum;
+}
+
+// FIR filter as usually written: the delay line is shifted at each sample
+template <size_t Ntaps, typename C, typename X, typename R>
+__attribute__((noinline)) void fir_loop(const C* coefs, X* delay, const X* x, size_t n, R* y)
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		for (size_t k = Ntaps - 1; k > 0; k--)
+			delay[k] = delay[k-1];
+		delay[0] = x[i];
+
+		R sum = 0;
+		for (size_t k = 0; k < Ntaps; k++)
+			sum = sum + coefs[k] * delay[k];
+		y[i] = sum;
+	}
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::dot(A a, B b)
+{
+	using res_t = typename FP_numeric::dot_res_type<A, B, (1 << 16)>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+	}
+
+	res_t res;
+	bench_line("dot", throughput([&]{ res = FP_numeric::dot<(1 << 16)>(va.data(), vb.data(), std::min(n, size_t(1 << 16))); }),
+	                  throughput([&]{ dot_loop(va.data(), vb.data(), std::min(n, size_t(1 << 16)), &res); }));
+}
+
+template <size_t Ntaps, typename C, typename X>
+void Fixed_Point_Benchmarks::fir(C c, X x)
+{
+	using fir_t = FP_numeric::fir<C::Tb, C::Fb, X::Tb, X::Fb, Ntaps>;
+	using res_t = typename fir_t::res_type;
+
+	std::vector<C> coefs(Ntaps, c);
+	std::vector<X> vx(n, x), delay(Ntaps);
+	std::vector<res_t> y(n);
+	for (size_t i = 0; i < n; i++)
+		vx[i].set_data(x.to_raw() - (typename X::base_type)(i % 32));
+
+	fir_t filter(coefs.data());
+	bench_line("fir<" + std::to_string(Ntaps) + ">", throughput([&]{ filter.process(vx.data(), n, y.data()); }),
+	                                                 throughput([&]{ fir_loop<Ntaps>(coefs.data(), delay.data(), vx.data(), n, y.data()); }));
+}
+
+// naive triple loop on row-major matrices
+template <typename R, typename A, typename B>
+__attribute__((noinline)) void gemm_loop(size_t size, const A* a, const B* b, R* c)
+{
+	for (size_t i = 0; i < size; i++)
+		for (size_t j = 0; j < size; j++)
+		{
+			R sum = 0;
+			for (size_t p = 0; p < size; p++)
+				sum = sum + a[i*size + p] * b[p*size + j];
+			c[i*size + j] = sum;
+		}
+}
+
+// float matrix product in the i, p, j order, so that the inner loop is vectorized
+__attribute__((noinline)) void gemm_float(size_t size, const float* a, const float* b, float* c)
+{
+	for (size_t i = 0; i < size; i++)
+	{
+		for (size_t j = 0; j < size; j++)
+			c[i*size + j] = 0;
+		for (size_t p = 0; p < size; p++)
+			for (size_t j = 0; j < size; j++)
+				c[i*size + j] += a[i*size + p] * b[p*size + j];
+	}
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::gemm(A a, B b, size_t size)
+{
+	using res_t  = typename FP_numeric::dot_res_type<A, B, 256>::type;
+	using layout = FP_numeric::Matrix_layout;
+
+	std::vector<A> ma(size * size, a);
+	std::vector<B> mb(size * size, b);
+	std::vector<res_t> mc(size * size);
+	std::vector<float> fa(size * size), fb(size * size), fc(size * size);
+	for (size_t i = 0; i < size * size; i++)
+	{
+		ma[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		mb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+		fa[i] = ma[i].template convert<float>();
+		fb[i] = mb[i].template convert<float>();
+	}
+
+	// millions of multiply-adds per second
+	const double macs = double(size) * size * size / 1e6;
+	const double t    = best_time([&]{ FP_numeric::gemm<256>(size, size, size, ma.data(), layout::ROW_MAJOR, mb.data(), layout::ROW_MAJOR,
+	                                                                          mc.data(), layout::ROW_MAJOR); });
+
+	const std::string name = "gemm " + std::to_string(size) + "^3";
+	bench_line(name, macs / t, macs / best_time([&]{ gemm_loop (size, ma.data(), mb.data(), mc.data()); }), "MMAC/s", "naive loop");
+	bench_line(name, macs / t, macs / best_time([&]{ gemm_float(size, fa.data(), fb.data(), fc.data()); }), "MMAC/s", "float gemm");
+}
+
+template <typename R, typename A, typename B, class Functor>
+__attribute__((noinline)) void division_loop(const A* a, const B* b, size_t n, R* res, Functor f)
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = f(a[i], b[i]);
+}
+
+template <bool fused, typename A, typename B, typename R>
+__attribute__((noinline)) void divmod_loop(const A* a, const B* b, size_t n, A* q, R* r)
+{
+	for (size_t i = 0; i < n; i++)
+	{
+		if (fused)
+			FP_numeric::divmod(a[i], b[i], q[i], r[i]);
+		else
+			FP_numeric::div   (a[i], b[i], q[i], r[i]);
+	}
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::division(A a, B b)
+{
+	using div_t = typename FP_numeric::div_res_type<A, B>::type;
+	using rem_t = typename FP_numeric::sub_res_type<A, typename FP_numeric::mul_res_type<A, B>::type>::type;
+
+	std::vector<A> va(n, a), q(n);
+	std::vector<B> vb(n, b);
+	std::vector<div_t> res(n);
+	std::vector<rem_t> r(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(b.to_raw() - (typename B::base_type)(i % 32));
+	}
+
+	const double loop = throughput([&]{ division_loop(va.data(), vb.data(), n, res.data(), [](const A& x, const B& y){ return x / y; }); });
+
+	bench_line("div_sat",  throughput([&]{ division_loop(va.data(), vb.data(), n, res.data(),
+	                                                     [](const A& x, const B& y){ return FP_numeric::div_sat (x, y); }); }), loop);
+	bench_line("div_fast", throughput([&]{ division_loop(va.data(), vb.data(), n, res.data(),
+	                                                     [](const A& x, const B& y){ return FP_numeric::div_fast(x, y); }); }), loop);
+	bench_line("divmod",   throughput([&]{ divmod_loop<true >(va.data(), vb.data(), n, q.data(), r.data()); }),
+	                       throughput([&]{ divmod_loop<false>(va.data(), vb.data(), n, q.data(), r.data()); }),
+	                       "Melem/s", "div(n, d, q, r)");
+}
+
+template <int64_t D, typename A, typename B>
+void Fixed_Point_Benchmarks::division_by(A a, B b)
+{
+	using div_t = typename FP_numeric::div_res_type<A, B>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	std::vector<div_t> res(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(a.to_raw() + (typename A::base_type)(i % 64));
+		vb[i].set_data(D);
+	}
+
+	const double loop = throughput([&]{ division_loop(va.data(), vb.data(), n, res.data(), [](const A& x, const B& y){ return x / y; }); });
+
+	std::stringstream sstream;
+	sstream << "div_by<" << D << ">";
+	bench_line(sstream.str(), throughput([&]{ division_loop(va.data(), vb.data(), n, res.data(),
+	                                                        [](const A& x, const B&){ return FP_numeric::div_by<B::Tb, B::Fb, D>(x); }); }), loop);
+	bench_line("div_by_n", throughput([&]{ FP_numeric::div_by_n<B::Tb, B::Fb, D>(va.data(), n, res.data()); }), loop);
+}
+
+template <typename R, typename A, class Functor>
+__attribute__((noinline)) void function_loop(const A* a, size_t n, R* res, Functor f)
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = f(a[i]);
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::square_root(A a)
+{
+	using sqrt_t  = typename FP_numeric::sqrt_res_type<A>::type;
+	using rsqrt_t = typename FP_numeric::rsqrt_res_type<A>::type;
+	using hypot_t = typename FP_numeric::hypot_res_type<A, A>::type;
+
+	std::vector<A> va(n, a), vb(n, a);
+	std::vector<sqrt_t>  s(n);
+	std::vector<rsqrt_t> r(n);
+	std::vector<hypot_t> h(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i % 1024)));
+		vb[i].set_data((typename A::base_type)(a.to_raw() - (typename A::base_type)(i % 512)));
+	}
+
+	bench_line("sqrt",  throughput([&]{ function_loop(va.data(), n, s.data(), [](const A& x){ return std::sqrt(x); }); }),
+	                    throughput([&]{ function_loop(va.data(), n, s.data(), [](const A& x){ return sqrt_t(std::sqrt(x.to_double())); }); }),
+	                    "Melem/s", "double loop");
+	bench_line("rsqrt", throughput([&]{ function_loop(va.data(), n, r.data(), [](const A& x){ return FP_numeric::rsqrt(x); }); }),
+	                    throughput([&]{ function_loop(va.data(), n, r.data(), [](const A& x){ return rsqrt_t(1.0 / std::sqrt(x.to_double())); }); }),
+	                    "Melem/s", "double loop");
+	bench_line("hypot", throughput([&]{ for (size_t i = 0; i < n; i++) h[i] = std::hypot(va[i], vb[i]); }),
+	                    throughput([&]{ for (size_t i = 0; i < n; i++) h[i] = hypot_t(std::hypot(va[i].to_double(), vb[i].to_double())); }),
+	                    "Melem/s", "double loop");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::transcendental(A a)
+{
+	using trig_t  = typename FP_numeric::trig_res_type<A>::type;
+	using atan2_t = typename FP_numeric::atan2_res_type<A, A>::type;
+	using log_t   = typename FP_numeric::log_res_type<A>::type;
+
+	std::vector<A> va(n, a), vb(n, a);
+	std::vector<trig_t>  s(n), c(n);
+	std::vector<atan2_t> t(n);
+	std::vector<A>       e(n);
+	std::vector<log_t>   l(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i % 1024)));
+		vb[i].set_data((typename A::base_type)(a.to_raw() - (typename A::base_type)(i % 512)));
+	}
+
+	bench_line("sin",    throughput([&]{ function_loop(va.data(), n, s.data(), [](const A& x){ return std::sin(x); }); }),
+	                     throughput([&]{ function_loop(va.data(), n, s.data(), [](const A& x){ return trig_t(std::sin(x.to_double())); }); }),
+	                     "Melem/s", "double loop");
+	bench_line("sincos", throughput([&]{ for (size_t i = 0; i < n; i++) FP_numeric::sincos(va[i], s[i], c[i]); }),
+	                     throughput([&]{ for (size_t i = 0; i < n; i++) s[i] = std::sin(va[i].to_double()), c[i] = std::cos(va[i].to_double()); }),
+	                     "Melem/s", "double loop");
+	bench_line("atan2",  throughput([&]{ for (size_t i = 0; i < n; i++) t[i] = std::atan2(va[i], vb[i]); }),
+	                     throughput([&]{ for (size_t i = 0; i < n; i++) t[i] = atan2_t(std::atan2(va[i].to_double(), vb[i].to_double())); }),
+	                     "Melem/s", "double loop");
+	bench_line("exp",    throughput([&]{ function_loop(va.data(), n, e.data(), [](const A& x){ return std::exp(x); }); }),
+	                     throughput([&]{ function_loop(va.data(), n, e.data(), [](const A& x){ return A(std::exp(x.to_double())); }); }),
+	                     "Melem/s", "double loop");
+	bench_line("log2",   throughput([&]{ function_loop(va.data(), n, l.data(), [](const A& x){ return std::log2(x); }); }),
+	                     throughput([&]{ function_loop(va.data(), n, l.data(), [](const A& x){ return log_t(std::log2(x.to_double())); }); }),
+	                     "Melem/s", "double loop");
+	bench_line("log",    throughput([&]{ function_loop(va.data(), n, l.data(), [](const A& x){ return std::log(x); }); }),
+	                     throughput([&]{ function_loop(va.data(), n, l.data(), [](const A& x){ return log_t(std::log(x.to_double())); }); }),
+	                     "Melem/s", "double loop");
+}
+
+// sine evaluated at compile time in the lookup tables
+struct lut_sine
+{
+	template <typename X>
+	constexpr auto operator()(const X& x) const -> decltype(std::sin(x)) { return std::sin(x); }
+};
+
+template <size_t Size, typename A>
+void Fixed_Point_Benchmarks::lookup_table(A a)
+{
+	using trig_t = typename FP_numeric::trig_res_type<A>::type;
+	using table  = FP_numeric::lut<A::Tb, A::Fb, trig_t::Tb, trig_t::Fb, lut_sine, Size>;
+
+	std::vector<A>      va(n, a);
+	std::vector<trig_t> res(n);
+	for (size_t i = 0; i < n; i++)
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i * 37)));
+
+	std::stringstream sstream;
+	sstream << "lookup " << table::size;
+	bench_line(sstream.str(), throughput([&]{ table::lookup_n(va.data(), n, res.data()); }),
+	                          throughput([&]{ function_loop(va.data(), n, res.data(), [](const A& x){ return std::sin(x); }); }),
+	                          "Melem/s", "std::sin loop");
+	sstream.str("");
+	sstream << "interpolate " << table::size;
+	bench_line(sstream.str(), throughput([&]{ table::interpolate_n(va.data(), n, res.data()); }),
+	                          throughput([&]{ function_loop(va.data(), n, res.data(), [](const A& x){ return std::sin(x); }); }),
+	                          "Melem/s", "std::sin loop");
+	bench_line(sstream.str(), throughput([&]{ table::interpolate_n(va.data(), n, res.data()); }),
+	                          throughput([&]{ function_loop(va.data(), n, res.data(), [](const A& x){ return trig_t(std::sin(x.to_double())); }); }),
+	                          "Melem/s", "double loop");
+}
+
+// phase accumulator: the running sum of x, stored in the quantification of R at each step
+template <typename R, typename A>
+__attribute__((noinline)) void phase_loop(const A* x, size_t n, R* res)
+{
+	R phase = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		phase += x[i];
+		res[i] = phase;
+	}
+}
+
+// 2 cascaded integrators as in a CIC decimator, stored in the quantification of R at each step
+template <typename R, typename A>
+__attribute__((noinline)) void integrator_loop(const A* x, size_t n, R* res)
+{
+	R i1 = 0, i2 = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		i1 += x[i];
+		i2 += i1;
+		res[i] = i2;
+	}
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::integrators(A a)
+{
+	using W = FP_S<A::Tb, A::Fb, FP_numeric::Arithmetic_type::SIGNED_WRAPPED>;
+
+	std::vector<A> va(n, a);
+	std::vector<A> res(n);
+	std::vector<W> res_w(n);
+	for (size_t i = 0; i < n; i++)
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i * 37)));
+
+	bench_line("phase accumulator", throughput([&]{ phase_loop(va.data(), n, res_w.data()); }),
+	                                throughput([&]{ phase_loop(va.data(), n, res  .data()); }),
+	                                "Melem/s", "saturated loop");
+	bench_line("CIC integrators",   throughput([&]{ integrator_loop(va.data(), n, res_w.data()); }),
+	                                throughput([&]{ integrator_loop(va.data(), n, res  .data()); }),
+	                                "Melem/s", "saturated loop");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::unsigned_storage(A a)
+{
+	using S = FP_S<A::Tb + 1, A::Fb>;
+
+	std::vector<A> va(n, a), vb(n, a), res(n);
+	std::vector<S> sa(n), sb(n), res_s(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i * 37)));
+		vb[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i * 101)));
+		sa[i] = va[i], sb[i] = vb[i];
+	}
+
+	std::stringstream sstream;
+	sstream << "signed" << S().display_quantification();
+	bench_line("a + b", throughput([&]{ operator_loop(va.data(), vb.data(), n, res  .data(), [](const A& x, const A& y){ return x + y; }); }),
+	                    throughput([&]{ operator_loop(sa.data(), sb.data(), n, res_s.data(), [](const S& x, const S& y){ return x + y; }); }),
+	                    "Melem/s", sstream.str());
+	bench_line("a * b", throughput([&]{ operator_loop(va.data(), vb.data(), n, res  .data(), [](const A& x, const A& y){ return x * y; }); }),
+	                    throughput([&]{ operator_loop(sa.data(), sb.data(), n, res_s.data(), [](const S& x, const S& y){ return x * y; }); }),
+	                    "Melem/s", sstream.str());
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::rounding_modes(A a, B b)
+{
+	std::vector<A> va(n, a);
+	std::vector<float> vf(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data((typename A::base_type)(a.to_raw() + (typename A::base_type)(i * 37)));
+		vf[i] = va[i].to_float();
+	}
+
+	using R = FP_numeric::Rounding_type;
+	rounding_mode<R::TRUNCATED        >(va, vf, b, "truncated");
+	rounding_mode<R::ROUNDED_HALF_UP  >(va, vf, b, "half up");
+	rounding_mode<R::ROUNDED_HALF_EVEN>(va, vf, b, "half even");
+	rounding_mode<R::ROUNDED_TO_ZERO  >(va, vf, b, "to zero");
+}
+
+template <FP_numeric::Rounding_type R, typename A, typename B>
+void Fixed_Point_Benchmarks::rounding_mode(const std::vector<A>& va, const std::vector<float>& vf, B b,
+                                           const std::string& mode)
+{
+	std::vector<B> res(n, b);
+
+	bench_line("requant " + mode, throughput([&]{ FP_numeric::requantize_n<R>(va.data(), n, res.data()); }),
+	                              throughput([&]{ operator_loop(va.data(), va.data(), n, res.data(), [](A x, A){ return (B)x; }); }),
+	                              "Melem/s", "b = a loop");
+	bench_line("convert " + mode, throughput([&]{ FP_numeric::convert_n<R>(vf.data(), n, res.data()); }),
+	                              throughput([&]{ operator_loop(vf.data(), vf.data(), n, res.data(), [](float x, float){ return (B)x; }); }),
+	                              "Melem/s", "b = float loop");
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::double_words(A a, B b)
+{
+	using W = FP_numeric::int128_t;
+
+	std::vector<W> wx(n), wy(n), wres(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		wx[i] = W(i * 0x9E3779B97F4A7C15ULL, ~i * 0xC2B2AE3D27D4EB4FULL);
+		wy[i] = W(i * 0x165667B19E3779F9ULL, (i + 1) * 0x27D4EB2F165667C5ULL) >> (i % 100);
+	}
+
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef __int128 native_t;
+	__extension__ typedef unsigned __int128 native_ut;
+
+	std::vector<native_t> nx(n), ny(n), nres(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		nx[i] = (native_t)(((native_ut)wx[i].high() << 64) | wx[i].low());
+		ny[i] = (native_t)(((native_ut)wy[i].high() << 64) | wy[i].low());
+	}
+
+	bench_line("x + y" , throughput([&]{ operator_loop(wx.data(), wy.data(), n, wres.data(), [](W x, W y){ return x + y; }); }),
+	                     throughput([&]{ operator_loop(nx.data(), ny.data(), n, nres.data(), [](native_t x, native_t y){ return x + y; }); }),
+	                     "Melem/s", "__int128");
+	bench_line("x - y" , throughput([&]{ operator_loop(wx.data(), wy.data(), n, wres.data(), [](W x, W y){ return x - y; }); }),
+	                     throughput([&]{ operator_loop(nx.data(), ny.data(), n, nres.data(), [](native_t x, native_t y){ return x - y; }); }),
+	                     "Melem/s", "__int128");
+	bench_line("x * y" , throughput([&]{ operator_loop(wx.data(), wy.data(), n, wres.data(), [](W x, W y){ return x * y; }); }),
+	                     throughput([&]{ operator_loop(nx.data(), ny.data(), n, nres.data(), [](native_t x, native_t y){ return native_t((native_ut)x * (native_ut)y); }); }),
+	                     "Melem/s", "__int128");
+	bench_line("x >> 37", throughput([&]{ operator_loop(wx.data(), wy.data(), n, wres.data(), [](W x, W){ return x >> 37; }); }),
+	                      throughput([&]{ operator_loop(nx.data(), ny.data(), n, nres.data(), [](native_t x, native_t){ return x >> 37; }); }),
+	                      "Melem/s", "__int128");
+	bench_line("x < y" , throughput([&]{ operator_loop(wx.data(), wy.data(), n, wres.data(), [](W x, W y){ return W(x < y); }); }),
+	                     throughput([&]{ operator_loop(nx.data(), ny.data(), n, nres.data(), [](native_t x, native_t y){ return native_t(x < y); }); }),
+	                     "Melem/s", "__int128");
+#else
+	os << "\t" << "no __int128 to compare with"; os_nline;
+#endif
+
+	// the same loops on the fixed points whom results are double words (the 64 bits products as a reference)
+	using S = FP_S<32, A::Fb / 2>;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	std::vector<S> sa(n, S(a.to_double())), sb(n, S(b.to_double()));
+	std::vector<typename FP_numeric::mul_res_type<A,B>::type> res(n);
+	std::vector<typename FP_numeric::mul_res_type<S,S>::type> res_s(n);
+
+	std::stringstream sstream;
+	sstream << "a * b" << S().display_quantification();
+	bench_line("a * b", throughput([&]{ operator_loop(va.data(), vb.data(), n, res  .data(), [](const A& x, const B& y){ return x * y; }); }),
+	                    throughput([&]{ operator_loop(sa.data(), sb.data(), n, res_s.data(), [](const S& x, const S& y){ return x * y; }); }),
+	                    "Melem/s", sstream.str());
+}
+
+template <typename A, typename B>
+void Fixed_Point_Benchmarks::multi_words(A a, B b)
+{
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+	using sqr_t = typename FP_numeric::mul_res_type<mul_t,mul_t>::type;
+	using div_t = typename FP_numeric::div_res_type<A,B>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	std::vector<mul_t> vp(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(typename A::base_type(int64_t(i * 0x9E3779B97F4A7C15ULL) >> (i % 7) * 8));
+		vb[i].set_data(typename B::base_type(int64_t((i + 1) * 0xC2B2AE3D27D4EB4FULL) >> (i % 5) * 8) | 1);
+		vp[i] = va[i] * vb[i];
+	}
+
+	std::vector<long double> la(n), lb(n), lp(n), lres(n);
+	for (size_t i = 0; i < n; i++)
+		la[i] = va[i].to_double(), lb[i] = vb[i].to_double(), lp[i] = vp[i].to_double();
+
+	std::vector<div_t> res_div(n);
+	std::vector<sqr_t> res_sqr(n);
+
+	std::stringstream sstream;
+	sstream << " in " << div_t().display_quantification() << ", (a * b)^2 in " << sqr_t().display_quantification();
+	os << "\t" << "a / b" << sstream.str(); os_nline;
+
+	bench_line("a / b"      , throughput([&]{ operator_loop(va.data(), vb.data(), n, res_div.data(), [](const A& x, const B& y){ return x / y; }); }),
+	                          throughput([&]{ operator_loop(la.data(), lb.data(), n, lres.data(), [](long double x, long double y){ return x / y; }); }),
+	                          "Melem/s", "long double");
+	bench_line("(a * b)^2"  , throughput([&]{ operator_loop(vp.data(), vp.data(), n, res_sqr.data(), [](const mul_t& x, const mul_t& y){ return x * y; }); }),
+	                          throughput([&]{ operator_loop(lp.data(), lp.data(), n, lres.data(), [](long double x, long double y){ return x * y; }); }),
+	                          "Melem/s", "long double");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::to_chars(A a)
+{
+	const size_t size = FP_numeric::chars_size<A>::value + 6;
+
+	std::vector<A> va(n, a);
+	std::vector<double> vd(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(typename A::base_type(int64_t(i * 0x9E3779B97F4A7C15ULL) >> (i % 7) * 8));
+		vd[i] = va[i].to_double();
+	}
+
+	// the writings are kept in text so that they are not optimized out
+	std::vector<char> text(n * size);
+	const auto write_fixed  = [&](size_t precision) { for (size_t i = 0; i < n; i++) FP_numeric::to_chars(&text[i * size], &text[i * size] + size, va[i], precision); };
+	const auto write_printf = [&](const char* format) { for (size_t i = 0; i < n; i++) std::snprintf(&text[i * size], size, format, vd[i]); };
+
+	bench_line("to_chars(a, 6)", throughput([&]{ write_fixed(6); }),
+	                             throughput([&]{ for (size_t i = 0; i < n; i++) va[i].display(6).copy(&text[i * size], size); }),
+	                             "Melem/s", "display(6)");
+	bench_line("to_chars(a, 6)", throughput([&]{ write_fixed(6); }),
+	                             throughput([&]{ write_printf("%.6f"); }),
+	                             "Melem/s", "snprintf(%.6f)");
+	bench_line("to_chars(a)"   , throughput([&]{ for (size_t i = 0; i < n; i++) FP_numeric::to_chars(&text[i * size], &text[i * size] + size, va[i]); }),
+	                             throughput([&]{ write_printf("%.17g"); }),
+	                             "Melem/s", "snprintf(%.17g)");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::from_chars(A a)
+{
+	// a column of n values written with 6 fractional digits, one per line
+	std::string text;
+	std::vector<size_t> starts(n + 1);
+	for (size_t i = 0; i < n; i++)
+	{
+		A x = a;
+		x.set_data(typename A::base_type(int64_t(i * 0x9E3779B97F4A7C15ULL) >> (i % 7) * 8));
+
+		char buffer[FP_numeric::chars_size<A>::value + 6];
+		starts[i] = text.size();
+		text.append(buffer, FP_numeric::to_chars(std::begin(buffer), std::end(buffer), x, 6).ptr);
+		text += '\n';
+	}
+	starts[n] = text.size();
+
+	std::vector<A> res(n);
+	const char* const t = text.data();
+
+	bench_line("from_chars(a)"  , throughput([&]{ for (size_t i = 0; i < n; i++) FP_numeric::from_chars(t + starts[i], t + starts[i + 1] - 1, res[i]); }),
+	                              throughput([&]{ for (size_t i = 0; i < n; i++) res[i] = std::strtod(t + starts[i], nullptr); }),
+	                              "Melem/s", "a = strtod");
+	bench_line("read_column(a)" , throughput([&]{ FP_numeric::read_column(t, t + text.size(), res.data(), n); }),
+	                              throughput([&]{ for (size_t i = 0; i < n; i++) res[i] = std::strtod(t + starts[i], nullptr); }),
+	                              "Melem/s", "a = strtod");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::packed(A a)
+{
+	std::vector<A> values(n, a), res(n);
+	for (size_t i = 0; i < n; i++)
+		values[i].set_data(typename A::base_type(int64_t(i * 0x9E3779B97F4A7C15ULL) >> (i % 7) * 8));
+	for (auto& x : values)
+		x = std::max(x, A::min());
+
+	FP_numeric::FP_packed<A::Tb, A::Fb, A::Ab> p(n);
+
+	bench_line("pack_n(a)"  , throughput([&]{ p.pack(0, values.data(), n); }),
+	                          throughput([&]{ for (size_t i = 0; i < n; i++) p.set(i, values[i]); }),
+	                          "Melem/s", "set(i, a)");
+	bench_line("unpack_n(a)", throughput([&]{ p.unpack(0, n, res.data()); }),
+	                          throughput([&]{ for (size_t i = 0; i < n; i++) res[i] = p.get(i); }),
+	                          "Melem/s", "a = get(i)");
+}
+
+// sum of the raw data of x, to read all the values of the column files
+template <typename A>
+__attribute__((noinline)) int64_t raw_sum(const A* x, size_t n)
+{
+	int64_t sum = 0;
+	for (size_t i = 0; i < n; i++)
+		sum += int64_t(x[i].get_data());
+	return sum;
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::file(A a)
+{
+	std::vector<A> values(n, a), res(n);
+	std::string text;
+	for (size_t i = 0; i < n; i++)
+	{
+		values[i].set_data(typename A::base_type(int64_t(i * 0x9E3779B97F4A7C15ULL) >> (i % 7) * 8));
+
+		char buffer[FP_numeric::chars_size<A>::value];
+		text.append(buffer, FP_numeric::to_chars(std::begin(buffer), std::end(buffer), values[i]).ptr);
+		text += '\n';
+	}
+
+	FP_numeric::write_file("Fixed_Point_Benchmarks.fpc", values.data(), n);
+	std::FILE* file = std::fopen("Fixed_Point_Benchmarks.txt", "wb");
+	std::fwrite(text.data(), 1, text.size(), file);
+	std::fclose(file);
+
+	// each reading ends with the sum of the values
+	const auto mapped = [&]
+	{
+		const FP_numeric::FP_mapped<A::Tb, A::Fb, A::Ab> m("Fixed_Point_Benchmarks.fpc");
+		res[0].set_data(raw_sum(m.data(), m.size()));
+	};
+	const auto parsed = [&]
+	{
+		std::FILE* f = std::fopen("Fixed_Point_Benchmarks.txt", "rb");
+		std::fread(&text[0], 1, text.size(), f);
+		std::fclose(f);
+		FP_numeric::read_column(text.data(), text.data() + text.size(), res.data(), n);
+		res[0].set_data(raw_sum(res.data(), n));
+	};
+	const auto copied = [&]
+	{
+		std::FILE* f = std::fopen("Fixed_Point_Benchmarks.fpc", "rb");
+		std::fseek(f, sizeof(FP_numeric::column_header), SEEK_SET);
+		std::fread(res.data(), sizeof(A), n, f);
+		std::fclose(f);
+		res[0].set_data(raw_sum(res.data(), n));
+	};
+
+	bench_line("FP_mapped(a)", throughput(mapped), throughput(parsed), "Melem/s", "read_column(a)");
+	bench_line("FP_mapped(a)", throughput(mapped), throughput(copied), "Melem/s", "fread(a)");
+
+	std::remove("Fixed_Point_Benchmarks.fpc");
+	std::remove("Fixed_Point_Benchmarks.txt");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::span(A a)
+{
+	using add_t = typename FP_numeric::add_res_type_d<A::Tb, A::Fb, A::Tb, A::Fb>::type;
+
+	// raw words as given by a driver, then the same words with garbage on their unused bits
+	std::vector<typename A::base_type> words(n), garbage(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		A x = a;
+		x.set_data(typename A::base_type(i * 0x9E3779B97F4A7C15ULL));
+		words[i]   = x.get_data();
+		garbage[i] = typename A::base_type(i * 0x9E3779B97F4A7C15ULL);
+	}
+
+	std::vector<A> copy(n);
+	std::vector<add_t> res(n);
+	const FP_numeric::FP_cspan<A::Tb, A::Fb> view(words.data(), n);
+	const FP_numeric::FP_span <A::Tb, A::Fb> dirty(garbage.data(), n);
+
+	bench_line("add_n(span)"  , throughput([&]{ FP_numeric::add_n(view.data(), view.data(), n, res.data()); }),
+	                            throughput([&]{ FP_numeric::copy(words.begin(), words.end(), copy.begin());
+	                                            FP_numeric::add_n(copy.data(), copy.data(), n, res.data()); }),
+	                            "Melem/s", "copy + add_n");
+	bench_line("sign_extend()", throughput([&]{ dirty.sign_extend(); }),
+	                            throughput([&]{ FP_numeric::copy(garbage.begin(), garbage.end(), copy.begin()); }),
+	                            "Melem/s", "copy");
+}
+
+template <typename A>
+void Fixed_Point_Benchmarks::dynamic(A a)
+{
+	using add_t = typename FP_numeric::add_res_type_d<A::Tb, A::Fb, A::Tb, A::Fb>::type;
+	using mul_t = typename FP_numeric::mul_res_type_d<A::Tb, A::Fb, A::Tb, A::Fb>::type;
+
+	std::vector<A> va(n, a), vb(n, a);
+	std::vector<add_t> add_res(n);
+	std::vector<mul_t> mul_res(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i].set_data(typename A::base_type(i * 0x9E3779B97F4A7C15ULL));
+		vb[i].set_data(typename A::base_type(i * 0xC2B2AE3D27D4EB4FULL));
+	}
+
+	const FP_numeric::FP_dynamic_array da(va.data(), n), db(vb.data(), n);
+	FP_numeric::FP_dynamic_array dr(1, 0);
+	std::vector<FP_D> xa(va.begin(), va.end()), xb(vb.begin(), vb.end()), xr(n);
+
+	bench_line("add_n(dynamic)", throughput([&]{ FP_numeric::add_n(da, db, dr); }),
+	                             throughput([&]{ for (size_t i = 0; i < n; i++) xr[i] = xa[i] + xb[i]; }),
+	                             "Melem/s", "FP_D loop");
+	bench_line("mul_n(dynamic)", throughput([&]{ FP_numeric::mul_n(da, db, dr); }),
+	                             throughput([&]{ for (size_t i = 0; i < n; i++) xr[i] = xa[i] * xb[i]; }),
+	                             "Melem/s", "FP_D loop");
+	bench_line("add_n(dynamic)", throughput([&]{ FP_numeric::add_n(da, db, dr); }),
+	                             throughput([&]{ FP_numeric::add_n(va.data(), vb.data(), n, add_res.data()); }),
+	                             "Melem/s", "add_n(static)");
+	bench_line("mul_n(dynamic)", throughput([&]{ FP_numeric::mul_n(da, db, dr); }),
+	                             throughput([&]{ FP_numeric::mul_n(va.data(), vb.data(), n, mul_res.data()); }),
+	                             "Melem/s", "mul_n(static)");
+}
+
+#endif /* FIXED_POINT_BENCHMARKS_HXX_ */
@@ -23,9 +23,9 @@ int main()
 	FP_S<32,5> b = 9.8925f;
 	FP_S< 9,4> c = 8.3f;
 
-	// FP_D d(3.0f, 8, 3);
-	// FP_D e(9.5f,10, 5);
-	// FP_D f(8.3f, 9, 4);
+	FP_D d(3.0f, 8, 3);
+	FP_D e(9.5f,10, 5);
+	FP_D f(8.3f, 9, 4);
 
 	// BIG WARNING ! To be compared, the == operator of the fixed point (static or dynamic)
 	// number is used. So results in floating point are converted
@@ -37,8 +37,76 @@ int main()
 
 	fpt.test_arithmetics(a,b,c);
 	fpt.test_comparisons(a,b,c);
-//	fpt.test_arithmetics(d,e,f);
-//	fpt.test_comparisons(d,e,f);
+	fpt.test_storages(a,b,c);
+	fpt.test_constant_expressions();
+	fpt.test_batches(a,b,c);
+	fpt.test_conversions(a,b,c);
+	fpt.test_conversions(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f), FP_S<30,12>(-1234.5f));
+	fpt.test_arrays(a,b,c);
+	fpt.test_expressions(c,c,c);
+	fpt.test_expressions(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f), FP_S<12,2>(-3.5f));
+	fpt.test_accumulators(c,c);
+	fpt.test_accumulators(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f));
+	fpt.test_accumulators(FP_S<16,14>(0.75f), FP_S<16,14>(-0.5f));
+	fpt.test_accumulators(FP_S<24,20>(-3.25f), FP_S<30,10>(1000.5f));
+	fpt.test_dsp(FP_S<16,14>(0.75f), FP_S<16,13>(-0.5f));
+	fpt.test_dsp(FP_S<12,6>(-3.5f), FP_S<16,8>(100.75f));
+	fpt.test_dsp(FP_S<32,24>(-3.5f), FP_S<20,12>(100.75f));
+	fpt.test_dsp(FP_S<8,3>(-5.125f), FP_S<8,7>(0.5f));
+	fpt.test_dsp(FP_S<24,16>(-3.5f), FP_S<20,12>(100.75f));
+	fpt.test_gemm(FP_S<16,14>(0.75f), FP_S<16,13>(-0.5f));
+	fpt.test_gemm(FP_S<12,6>(-3.5f), FP_S<16,8>(100.75f));
+	fpt.test_gemm(FP_S<24,16>(-3.5f), FP_S<20,12>(100.75f));
+	fpt.test_gemm(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f));
+	fpt.test_divisions(FP_S<16,8>(3.5f), FP_S<16,8>(-7.25f));
+	fpt.test_divisions(FP_S<16,14>(0.75f), FP_S<16,13>(-0.5f));
+	fpt.test_divisions(FP_S<24,16>(-3.5f), FP_S<20,12>(100.75f));
+	fpt.test_divisions(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f));
+	fpt.test_divisions(FP_S<24,12>(-3.5f), FP_S<16,15>(0.75f));
+	fpt.test_divisions(FP_S<32,0>(-1234.0f), FP_S<32,31>(0.25f));
+	fpt.test_divisions(FP_S<8,3>(-5.125f), FP_S<32,1>(100.5f));
+	fpt.test_constant_divisions(FP_S<16,8>(3.5f), FP_S<16,8>(-7.25f));
+	fpt.test_constant_divisions(FP_S<16,14>(0.75f), FP_S<16,13>(-0.5f));
+	fpt.test_constant_divisions(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f));
+	fpt.test_constant_divisions(FP_S<24,16>(-3.5f), FP_S<8,4>(2.5f));
+	fpt.test_constant_divisions(FP_S<16,2>(-3.5f), FP_S<8,7>(0.5f));
+	fpt.test_constant_divisions(FP_S<32,16>(-3.5f), FP_S<16,8>(100.75f));
+	fpt.test_math(FP_S<16,8>(3.5f), FP_S<16,8>(-7.25f));
+	fpt.test_math(FP_S<16,15>(0.75f), FP_S<16,13>(-0.5f));
+	fpt.test_math(FP_S<8,3>(-5.125f), FP_S<16,8>(100.75f));
+	fpt.test_math(FP_S<32,16>(-3.5f), FP_S<24,12>(2.5f));
+	fpt.test_luts(FP_S<16,12>(3.5f), FP_S<16,14>(-0.5f));
+	fpt.test_luts(FP_S<8,5>(-2.5f), FP_S<8,6>(0.5f));
+	fpt.test_luts(FP_S<32,28>(1.5f), FP_S<24,22>(-0.5f));
+	fpt.test_policies(FP_S<16,8>(3.5f), FP_S<16,12>(-1.25f));
+	fpt.test_policies(FP_S<8,4>(-2.5f), FP_S<8,6>(0.75f));
+	fpt.test_policies(FP_S<32,16>(-3.5f), FP_S<24,20>(2.5f));
+	fpt.test_unsigned(FP_U<8,8>(0.75f), FP_S<16,8>(-7.25f));
+	fpt.test_unsigned(FP_U<16,8>(3.5f), FP_U<16,12>(1.25f));
+	fpt.test_unsigned(FP_U<24,16>(100.5f), FP_S<16,12>(-2.5f));
+	fpt.test_rounding(FP_S<16,12>(-3.5f), FP_S<8,4>(2.5f));
+	fpt.test_rounding(FP_S<12,10>(0.75f), FP_S<8,2>(-1.25f));
+	fpt.test_rounding(FP_S<32,24>(-2.5f), FP_S<16,8>(100.75f));
+	fpt.test_double_words(FP_S<40,20>(-3.5f), FP_S<48,30>(2.25f));
+	fpt.test_double_words(FP_U<52,30>(12.5f), FP_S<53,40>(-0.75f));
+	fpt.test_multi_words(FP_S<64,32>(-3.5f), FP_S<64,40>(2.25f));
+	fpt.test_multi_words(FP_U<96,60>(12.5f), FP_S<80,40>(-0.75f));
+	fpt.test_to_chars(FP_S<32,16>(-3.5f), FP_U<16,12>(1.25f));
+	fpt.test_to_chars(FP_S<64,40>(-1234.0625f), FP_S<200,150>(2.75f));
+	fpt.test_from_chars(FP_S<32,16>(-3.5f), FP_U<16,12>(1.25f));
+	fpt.test_from_chars(FP_S<8,3>(-1.5f), FP_S<96,60>(12.125f));
+	fpt.test_packed(FP_S<12,6>(-3.5f), FP_S<20,10>(1.25f));
+	fpt.test_packed(FP_U<7,4>(2.5f), FP_S<40,20>(-7.75f));
+	fpt.test_file(FP_S<12,6>(-3.5f), FP_U<32,16>(1.25f));
+	fpt.test_file(FP_S<8,3>(-1.5f), FP_S<96,60>(12.125f));
+	fpt.test_span(FP_S<12,6>(-3.5f), FP_S<12,6>(1.25f));
+	fpt.test_span(FP_S<20,10>(-7.75f), FP_S<27,4>(2.5f));
+	fpt.test_dynamic(FP_S<16,8>(3.5f), FP_S<16,8>(-7.25f));
+	fpt.test_dynamic(FP_S<8,3>(-1.5f), FP_S<8,3>(2.25f));
+	fpt.test_dynamic(FP_S<12,6>(-3.5f), FP_S<20,10>(1.25f));
+	fpt.test_dynamic(FP_S<31,3>(3.0f), FP_S<32,5>(9.8925f));
+	fpt.test_arithmetics(d,e,f);
+	fpt.test_comparisons(d,e,f);
 
 
 	std::cout << std::endl << italic(bold_yellow("!!!Good bye!!!")) << std::endl;
@@ -5,8 +5,26 @@
 #include <iomanip>
 #include <string>
 #include <stdexcept>
+#include <cstring>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
 
 #include "../Fixed_Point/Fixed_Point_Static.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_batch.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_array.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_expressions.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_accumulator.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_dsp.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_gemm.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_division.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_math.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_lut.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_charconv.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_packed.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_file.hpp"
+#include "../Fixed_Point/Fixed_Point_Static_span.hpp"
+#include "../Fixed_Point/Fixed_Point_Dynamic_array.hpp"
 
 #include "../bash_tools/bash_tools.h"
 
@@ -31,6 +49,53 @@ public:
 	void test_comparisons(A a, B b);
 	template <typename A, typename B, typename C>
 	void test_comparisons(A a, B b, C c);
+	template <typename A, typename B, typename C>
+	void test_storages(A a, B b, C c);
+	void test_constant_expressions();
+	template <typename A, typename B, typename C>
+	void test_batches(A a, B b, C c);
+	template <typename A, typename B, typename C>
+	void test_conversions(A a, B b, C c);
+	template <typename A, typename B, typename C>
+	void test_arrays(A a, B b, C c);
+	template <typename A, typename B, typename C>
+	void test_expressions(A a, B b, C c);
+	template <typename A, typename B>
+	void test_accumulators(A a, B b);
+	template <typename A, typename B>
+	void test_dsp(A a, B b);
+	template <typename A, typename B>
+	void test_gemm(A a, B b);
+	template <typename A, typename B>
+	void test_divisions(A a, B b);
+	template <typename A, typename B>
+	void test_constant_divisions(A a, B b);
+	template <typename A, typename B>
+	void test_math(A a, B b);
+	template <typename A, typename B>
+	void test_luts(A a, B b);
+	template <typename A, typename B>
+	void test_policies(A a, B b);
+	template <typename A, typename B>
+	void test_unsigned(A a, B b);
+	template <typename A, typename B>
+	void test_rounding(A a, B b);
+	template <typename A, typename B>
+	void test_double_words(A a, B b);
+	template <typename A, typename B>
+	void test_multi_words(A a, B b);
+	template <typename A, typename B>
+	void test_to_chars(A a, B b);
+	template <typename A, typename B>
+	void test_from_chars(A a, B b);
+	template <typename A, typename B>
+	void test_packed(A a, B b);
+	template <typename A, typename B>
+	void test_file(A a, B b);
+	template <typename A, typename B>
+	void test_span(A a, B b);
+	template <typename A, typename B>
+	void test_dynamic(A a, B b);
 
 	/*
 	 * Methods that print an header with the tested given values
@@ -57,6 +122,11 @@ public:
 	template <typename A, typename B, class Functor>
 	void test_method(A a, B b, Functor f);
 
+	/*
+	 * Method that displays the given description of a check and its result
+	 */
+	void test_check(const std::string& str, bool comp_res);
+
 	/*
 	 * Methods that display results of its different arguments executed by f
 	 */
@@ -182,6 +252,214 @@ public:
 	void comp_low_or_equal(A a, B b);
 	template <typename A, typename B, typename C>
 	void comp_low_or_equal(A a, B b, C c);
+
+	/*
+	 * Methods that check a is stored exactly as its base_type:
+	 * same size, trivially copyable and copyable with memcpy
+	 */
+	template <typename A>
+	void storage(A a);
+	template <typename A, typename B, typename C>
+	void storage(A a, B b, C c);
+
+	/*
+	 * Method that checks conversions and arithmetic are folded at compile time
+	 */
+	void constant_expression();
+
+	/*
+	 * Methods that check the batch kernels give the same bits than the scalar operators
+	 * on arrays of pseudo random values starting with a and b
+	 */
+	template <typename A, typename B>
+	void batch(A a, B b);
+	template <typename A>
+	void saturating_batch(A a);
+
+	/*
+	 * Methods that check the bulk conversions give the same bits than operator= and convert<floating_t>()
+	 * on arrays of values around a, halfway values and values out of its range
+	 */
+	template <typename A>
+	void conversion(A a);
+	template <typename A, typename floating_t>
+	void conversion(A a, floating_t f, const std::string& str_f);
+
+	/*
+	 * Method that checks an FP_array of a stays contiguous and aligned while it grows,
+	 * and can be used by the batch kernels
+	 */
+	template <typename A, typename B>
+	void array(A a, B b);
+
+	/*
+	 * Method that checks lazy expressions of a, b and c give the same type and the same bits than the operators
+	 */
+	template <typename A, typename B, typename C, typename Lazy, typename Eager>
+	void expression(A a, B b, C c, Lazy lazy, Eager eager, const std::string& str);
+
+	/*
+	 * Methods that check the accumulator register against the operators and its rounded and saturated results
+	 * against a long double reference
+	 */
+	template <typename A, typename B>
+	void accumulator(A a, B b);
+	template <typename Acc, size_t To, size_t Fo>
+	bool accumulator_result(const Acc& acc);
+
+	/*
+	 * Methods that check the dot product and the FIR filter against the sums of products with the operators
+	 */
+	template <size_t N, typename A, typename B>
+	void dot(A a, B b, size_t n);
+	template <size_t Ntaps, typename C, typename X>
+	void fir(C c, X x);
+
+	/*
+	 * Method that checks the matrix product in every layout against the sums of products with the operators
+	 */
+	template <size_t K, typename A, typename B>
+	void gemm(A a, B b, size_t m, size_t n, size_t k, FP_numeric::thread_pool& pool);
+
+	/*
+	 * Method that checks the saturating division and the fused divmod against the operators,
+	 * and the reciprocal division against its error bound
+	 */
+	template <typename A, typename B>
+	void division_variants(A a, B b);
+
+	/*
+	 * Method that checks the division by the constant of type B and raw data D against operator/ for every value of
+	 * type A (or pseudo random values from a if A has more than 16 bits), one by one and by the batch kernel
+	 */
+	template <int64_t D, typename A, typename B>
+	void division_by(A a, B b);
+
+	/*
+	 * Method that checks sqrt, rsqrt and hypot against the truncation of the long double results for every value of
+	 * type A (or pseudo random values from a if A has more than 16 bits)
+	 */
+	template <typename A, typename B>
+	void square_root(A a, B b);
+
+	/*
+	 * Method that checks sin, cos, atan2, exp, log2 and log against the long double results (at most 1 unit of the
+	 * last place of the result) for every value of type A (or pseudo random values from a if A has more than 16 bits)
+	 */
+	template <typename A, typename B>
+	void transcendental(A a, B b);
+
+	/*
+	 * Method that checks the samples, the lookups and the interpolations of a lookup table of Size samples of Func
+	 * from A to B against the long double results for every value of type A (or pseudo random values from a if A has
+	 * more than 16 bits)
+	 */
+	template <class Func, size_t Size, typename A, typename B>
+	void lookup_table(A a, B b);
+
+	/*
+	 * Method that checks the wrapped, saturated and checked versions of the quantification of A against the exact
+	 * results stored in a wider Fixed_Point_Static for every value of A (or pseudo random values from a if A has more
+	 * than 16 bits) and pseudo random values of B
+	 */
+	template <typename A, typename B>
+	void overflow_policies(A a, B b);
+
+	/*
+	 * Method that checks the conversions of the unsigned A for every value of A (or pseudo random values from a if A
+	 * has more than 16 bits), and its exact mixed operations and comparisons with pseudo random values of B, and the
+	 * saturated, wrapped and checked storage of their differences in A
+	 */
+	template <typename A, typename B>
+	void unsigned_types(A a, B b);
+
+	/*
+	 * Method that checks every rounding mode of the requantization of A in the quantification of B, of the conversion
+	 * of A from double and to integer, and of their batch versions against the rounded exact values for every value
+	 * of A (or pseudo random values from a if A has more than 16 bits)
+	 */
+	template <typename A, typename B>
+	void rounding_modes(A a, B b);
+
+	template <FP_numeric::Rounding_type R, typename A, typename B>
+	void rounding_mode(const std::vector<A>& va, B b, const std::string& mode);
+
+	/*
+	 * Method that checks the operations of FP_numeric::int128_t against the ones of __int128 (if the compiler has it)
+	 * on pseudo random words, and the results of more than 64 bits of pseudo random values of A and B against their
+	 * correctly rounded double results
+	 */
+	template <typename A, typename B>
+	void double_words(A a, B b);
+
+	/*
+	 * Method that checks the operations of FP_numeric::multi_word on pseudo random words (q * d + r == n, low words ==
+	 * the int128_t results) and the chains of products, quotients and sums of A and B beyond 128 bits
+	 */
+	template <typename A, typename B>
+	void multi_words(A a, B b);
+
+	/*
+	 * Method that checks the decimal writings of FP_numeric::to_chars of pseudo random values of A and B: the exact
+	 * expansion against the digits of data * 5^F, the rounded ones against printf("%.*Lf") (if exact in a long double)
+	 */
+	template <typename A, typename B>
+	void to_chars(A a, B b);
+
+	template <typename FP>
+	bool to_chars_check(const FP& x);
+
+	/*
+	 * Method that checks the parsing of FP_numeric::from_chars on the writings of pseudo random values of A and B: the
+	 * exact ones are read back, the ties and the rounded ones are rounded as the exact decimal value, the values out of
+	 * range are saturated, then the columns of a CSV and of a whitespace delimited text read by read_column
+	 */
+	template <typename A, typename B>
+	void from_chars(A a, B b);
+
+	template <typename FP>
+	bool from_chars_check(const FP& x);
+
+	/*
+	 * Method that checks FP_packed on pseudo random values of A and B: the size of the packed values, the unpacking
+	 * of all the values and of the ranges at any offset, the packing of a range between kept values, and the random
+	 * access by get and set
+	 */
+	template <typename A, typename B>
+	void packed(A a, B b);
+
+	template <typename FP>
+	bool packed_check(std::vector<FP> v, bool access);
+
+	/*
+	 * Method that checks the column files of pseudo random values of A and B: written at once or by appended blocks,
+	 * then mapped back by FP_mapped with the same values, aligned for the batch kernels, and refused with
+	 * std::runtime_error for another quantification or when truncated
+	 */
+	template <typename A, typename B>
+	void file(A a, B b);
+
+	template <typename FP>
+	bool file_check(const std::vector<FP>& v, const std::string& path);
+
+	/*
+	 * Method that checks FP_span over the raw words of pseudo random values of A and B: the views are the values
+	 * without copy (elements, sub views, batch kernels and FP_numeric::copy), and the words with garbage on their
+	 * unused bits are extended in place as set_data would do
+	 */
+	template <typename A, typename B>
+	void span(A a, B b);
+
+	template <typename FP>
+	bool span_check(const std::vector<FP>& v);
+
+	/*
+	 * Method that checks Fixed_Point_Dynamic and FP_dynamic_array against the static code on pseudo random values of
+	 * A and B in the same quantifications: the scalar operators and the batch kernels (precompiled for the common
+	 * widths or generic) give the same bits than the Fixed_Point_Static ones
+	 */
+	template <typename A, typename B>
+	void dynamic(A a, B b);
 };
 
 #include "Fixed_Point_Tests.hxx"
@@ -76,6 +76,345 @@ void Fixed_Point_Tests::test_comparisons(A a, B b, C c)
 	os << bold_orange("**********************************************"); os_nline; os_nline;
 }
 
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::test_storages(A a, B b, C c)
+{
+	os << bold_orange("Storage tests ********************************"); os_nline;
+
+	storage(a,b,c);
+
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::test_batches(A a, B b, C c)
+{
+	os << bold_orange("Batch kernels tests **************************"); os_nline;
+
+	batch(a,b);
+	batch(b,a);
+	batch(c,c);
+	batch(a,c);
+	saturating_batch(a);
+	saturating_batch(b);
+	saturating_batch(c);
+
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::test_conversions(A a, B b, C c)
+{
+	os << bold_orange("Bulk conversions tests ***********************"); os_nline;
+
+	conversion(a);
+	conversion(b);
+	conversion(c);
+
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::test_arrays(A a, B b, C c)
+{
+	os << bold_orange("FP_array tests *******************************"); os_nline;
+
+	array(a,b);
+	array(c,c);
+
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::test_expressions(A a, B b, C c)
+{
+	os << bold_orange("Lazy expressions tests ***********************"); os_nline;
+
+	test_header("expression", a, b, c, "a", "b", "c");
+
+	expression(a, b, c, [](A x, B y, C z) { return FP_numeric::lazy(x) * y + z; },
+	                    [](A x, B y, C z) { return x * y + z; }, "a*b + c");
+	expression(a, b, c, [](A x, B y, C z) { return z - FP_numeric::lazy(x) * y; },
+	                    [](A x, B y, C z) { return z - x * y; }, "c - a*b");
+	expression(a, b, c, [](A x, B y, C z) { return (FP_numeric::lazy(x) * y - z * x) * z + y; },
+	                    [](A x, B y, C z) { return (x * y - z * x) * z + y; }, "(a*b - c*a)*c + b");
+	expression(a, b, c, [](A x, B y, C z) { return (FP_numeric::lazy(x) + y) * (FP_numeric::lazy(z) - x); },
+	                    [](A x, B y, C z) { return (x + y) * (z - x); }, "(a + b)*(c - a)");
+
+	// a single saturation when assigned to a smaller quantification
+	C sat = FP_numeric::lazy(a) * b + c;
+	C ref = a * b + c;
+	std::stringstream sstream;
+	sstream << "c = a*b + c = " << sat << ",   operators : " << ref;
+	os << "\t"; test_check(sstream.str(), sat.to_raw() == ref.to_raw()); os_nline;
+
+	constexpr FP_S<16,8> k0 = 1.5, k1 = -0.25;
+	constexpr FP_S<16,8> k  = FP_numeric::lazy(k0) * k1 + k0;
+	static_assert(k.to_raw() == FP_S<16,8>(k0 * k1 + k0).to_raw(), "lazy expressions must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_accumulators(A a, B b)
+{
+	os << bold_orange("Accumulators tests ***************************"); os_nline;
+
+	accumulator(a, b);
+
+	// ties are rounded up and the saturation is done once at the end
+	constexpr FP_S<16,8> x = 1.5, y = -1.5;
+	static_assert(FP_numeric::accumulator<16,8,4>(x).result<8,0>().to_raw() ==  2, "1.5 must be rounded to 2");
+	static_assert(FP_numeric::accumulator<16,8,4>(y).result<8,0>().to_raw() == -1, "-1.5 must be rounded to -1");
+	static_assert(FP_numeric::accumulator<31,16,4>(x).mac(x, x).add(x).result<4,1>().is_max(), "must be saturated");
+	static_assert(FP_numeric::accumulator<31,16,4>(x).mac(x, y).add(x).result<4,1>().to_raw() == 2, "1.5 - 2.25 + 1.5");
+
+	// the other rounding modes
+	using RT = FP_numeric::Rounding_type;
+	static_assert(FP_numeric::accumulator<16,8,4>(x).result<8,0,RT::TRUNCATED        >().to_raw() ==  1, "1.5 must be truncated to 1");
+	static_assert(FP_numeric::accumulator<16,8,4>(y).result<8,0,RT::TRUNCATED        >().to_raw() == -2, "-1.5 must be truncated to -2");
+	static_assert(FP_numeric::accumulator<16,8,4>(x).result<8,0,RT::ROUNDED_TO_ZERO  >().to_raw() ==  1, "1.5 must be rounded to 1");
+	static_assert(FP_numeric::accumulator<16,8,4>(y).result<8,0,RT::ROUNDED_TO_ZERO  >().to_raw() == -1, "-1.5 must be rounded to -1");
+	static_assert(FP_numeric::accumulator<16,8,4>(y).result<8,0,RT::ROUNDED_HALF_EVEN>().to_raw() == -2, "-1.5 must be rounded to -2");
+	static_assert(FP_numeric::accumulator<16,8,4>(x).add(FP_S<8,0>(1)).result<8,0,RT::ROUNDED_HALF_EVEN>().to_raw() == 2,
+	              "2.5 must be rounded to 2");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_dsp(A a, B b)
+{
+	os << bold_orange("DSP tests ************************************"); os_nline;
+
+	static_assert(std::is_same<typename FP_numeric::dot_res_type<A, B, 2>::type,
+	                           typename FP_numeric::add_res_type<typename FP_numeric::mul_res_type<A, B>::type,
+	                                                             typename FP_numeric::mul_res_type<A, B>::type>::type>::value,
+	              "the sum of 2 products must have the type of the operators");
+
+	dot<1>   (a, b, 1);
+	dot<7>   (a, b, 7);
+	dot<1024>(a, b, 1021); // not a multiple of the vector sizes to also test the remaining products
+	dot<1024>(a, b, 1024);
+	fir<1> (a, b);
+	fir<5> (a, b);
+	fir<32>(a, b);
+	fir<63>(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_gemm(A a, B b)
+{
+	os << bold_orange("Matrix product tests *************************"); os_nline;
+
+	FP_numeric::thread_pool single(0), pool(3);
+
+	gemm<1>   (a, b,   1,   1,   1, single);
+	gemm<16>  (a, b,   3,   5,  16, single);
+	gemm<100> (a, b,  37,  29,  99, pool);
+	gemm<1024>(a, b,  70, 131, 600, pool); // several tiles and several blocks of products
+	gemm<1024>(a, b,  70, 131, 600, FP_numeric::thread_pool::global());
+
+	bool thrown = false;
+	try { gemm<8>(a, b, 2, 2, 9, single); }
+	catch (std::length_error&) { thrown = true; }
+	os << "\t"; test_check("k > K throws std::length_error", thrown); os_nline;
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_divisions(A a, B b)
+{
+	os << bold_orange("Divisions tests ******************************"); os_nline;
+
+	division_variants(a, b);
+
+	// a division by zero saturates without exception
+	constexpr FP_S<16,8> x = 1.5, zero = 0;
+	using div_t = typename FP_numeric::div_res_type<FP_S<16,8>, FP_S<16,8>>::type;
+	static_assert(noexcept(FP_numeric::div_sat(x, zero)) && noexcept(FP_numeric::div_fast(x, zero)), "must be noexcept");
+	static_assert(FP_numeric::div_sat( x, zero).to_raw() == div_t::max().to_raw(), "x / 0 must be saturated at max()");
+	static_assert(FP_numeric::div_sat(-x, zero).to_raw() == div_t::min().to_raw(), "-x / 0 must be saturated at min()");
+	static_assert(FP_numeric::div_sat(zero, zero).to_raw() == 0, "0 / 0 must be 0");
+	os << "\t"; test_check("div_fast(x, 0) == max(),   div_fast(-x, 0) == min()",
+	                       FP_numeric::div_fast(x, zero).is_max() && FP_numeric::div_fast(-x, zero).is_min()); os_nline;
+
+	bool thrown = false;
+	FP_S<16,8> q, r;
+	try { FP_numeric::divmod(x, zero, q, r); }
+	catch (std::domain_error&) { thrown = true; }
+	os << "\t"; test_check("divmod(x, 0, q, r) throws std::domain_error", thrown); os_nline;
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_constant_divisions(A a, B b)
+{
+	os << bold_orange("Constant divisions tests *********************"); os_nline;
+
+	division_by<3>(a, b);
+	division_by<-7>(a, b);
+	division_by<1>(a, b);
+	division_by<B::one().get_data()>(a, b);
+	division_by<B::max().get_data()>(a, b);
+	division_by<B::min().get_data()>(a, b);
+	division_by<B::max().get_data() / 3 * 2>(a, b); // a power of 2 times an odd number
+
+	constexpr FP_S<16,8> x = 7.5, k = 3;
+	static_assert(FP_numeric::div_by<16,8, k.get_data()>(x).to_raw() == (x / k).to_raw(), "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_math(A a, B b)
+{
+	os << bold_orange("Mathematical functions tests *****************"); os_nline;
+
+	square_root(a, b);
+	transcendental(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+// functions of the lookup tables tests, evaluated at compile time in integer or floating point arithmetic
+struct lut_sine
+{
+	template <typename X>
+	constexpr auto operator()(const X& x) const -> decltype(std::sin(x)) { return std::sin(x); }
+};
+
+struct lut_softsign
+{
+	template <typename X>
+	constexpr double operator()(const X& x) const { return x.to_double() / (1 + ((x < 0)? -x.to_double() : x.to_double())); }
+};
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_luts(A a, B b)
+{
+	os << bold_orange("Lookup tables tests **************************"); os_nline;
+
+	lookup_table<lut_sine,     2>  (a, b);
+	lookup_table<lut_sine,     256>(a, b);
+	lookup_table<lut_softsign, 64> (a, b);
+	lookup_table<lut_softsign, (A::Tb <= 12)? (size_t(1) << A::Tb) : 4096>(a, b);
+
+	static_assert(FP_numeric::lut<8,5, 8,6, lut_sine, 256>::lookup(FP_S<8,5>(0)) == 0, "must be folded at compile time");
+	static_assert(FP_numeric::lut<8,5, 8,6, lut_sine, 16>::interpolate(FP_S<8,5>(0)) == 0, "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_policies(A a, B b)
+{
+	os << bold_orange("Overflow policies tests **********************"); os_nline;
+
+	overflow_policies(a, b);
+
+	using W = FP_S<8,0, FP_numeric::Arithmetic_type::SIGNED_WRAPPED>;
+	using C = FP_S<8,0, FP_numeric::Arithmetic_type::SIGNED_CHECKED>;
+	static_assert(W(W(127) + W(1)).to_raw() == -128 && (-W::min()).to_raw() == -128, "must be folded at compile time");
+	static_assert(C(C(100) + C(27)).to_raw() == 127, "must be folded at compile time");
+	static_assert(FP_numeric::has_raw_layout<W>::value && FP_numeric::has_raw_layout<C>::value, "must be stored as int8_t");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_unsigned(A a, B b)
+{
+	os << bold_orange("Unsigned types tests *************************"); os_nline;
+
+	unsigned_types(a, b);
+
+	static_assert(std::is_same<FP_U<8,8>::base_type, uint8_t>::value && sizeof(FP_U<8,8>) == 1, "must be stored as uint8_t");
+	static_assert(std::is_same<FP_numeric::add_res_type<FP_U<8,8>, FP_U<8,4>>::type, FP_U<13,8>>::value, "u + u is unsigned");
+	static_assert(std::is_same<FP_numeric::sub_res_type<FP_U<8,8>, FP_U<8,8>>::type, FP_S<10,8>>::value, "u - u is signed");
+	static_assert(std::is_same<FP_numeric::mul_res_type<FP_U<8,8>, FP_U<8,4>>::type, FP_U<16,12>>::value, "u * u is unsigned");
+	static_assert(std::is_same<FP_numeric::mul_res_type<FP_U<8,8>, FP_S<8,4>>::type, FP_S<16,12>>::value, "u * s is signed");
+	static_assert(FP_U<8,8>(0.5).to_raw() == 128 && FP_U<8,8>(-0.5).to_raw() == 0 && FP_U<8,8>(2).is_max(),
+	              "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_rounding(A a, B b)
+{
+	os << bold_orange("Rounding modes tests *************************"); os_nline;
+
+	rounding_modes(a, b);
+
+	using R = FP_numeric::Rounding_type;
+	static_assert(FP_numeric::shift_fract<R::ROUNDED_HALF_EVEN>(int8_t(-40), 0, 4) == -2
+	           && FP_numeric::shift_fract<R::ROUNDED_HALF_UP  >(int8_t(-40), 0, 4) == -2
+	           && FP_numeric::shift_fract<R::ROUNDED_TO_ZERO  >(int8_t(-40), 0, 4) == -2
+	           && FP_numeric::shift_fract<R::TRUNCATED        >(int8_t(-40), 0, 4) == -3, "must be folded at compile time");
+	static_assert(FP_S<8,0>(-2.5).to_raw() == -2 && FP_S<8,0>(-2.6).to_raw() == -3 && FP_S<8,4>(7.97).convert<int>() == 8,
+	              "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_double_words(A a, B b)
+{
+	os << bold_orange("Double words tests ***************************"); os_nline;
+
+	double_words(a, b);
+
+	static_assert(sizeof(FP_numeric::int128_t) == 16 && FP_numeric::is_integral<FP_numeric::int128_t>::value,
+	              "must be stored as two words");
+	static_assert(((FP_numeric::int128_t(-3) << 100) >> 100) == -3 && FP_numeric::int128_t(-7e20) / 7 == FP_numeric::int128_t(-1e20)
+	           && (FP_numeric::uint128_t(~uint64_t(0)) * ~uint64_t(0)).high() == ~uint64_t(0) - 1, "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_multi_words(A a, B b)
+{
+	os << bold_orange("Multi words tests ****************************"); os_nline;
+
+	multi_words(a, b);
+
+	using int256_t = FP_numeric::multi_word<4, true>;
+	static_assert(sizeof(Fixed_Point_Static<200, 100>) == 32 && std::is_same<Fixed_Point_Static<129, 64>::base_type, FP_numeric::multi_word<3, true>>::value
+	           && FP_numeric::is_integral<int256_t>::value, "must be stored in N words");
+	static_assert(((int256_t(-3) << 200) >> 200) == -3 && int256_t(-7) * (int256_t(1) << 150) / 7 == -(int256_t(1) << 150)
+	           && int256_t(-0x1p150) == -(int256_t(1) << 150) && (int256_t(-17) % 5) == -2, "must be folded at compile time");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+void Fixed_Point_Tests::test_constant_expressions()
+{
+	os << bold_orange("Constant expression tests ********************"); os_nline;
+
+	constant_expression();
+
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
 
 template <typename A>
 void Fixed_Point_Tests::test_header(const std::string& method_name, A a,
@@ -170,6 +509,18 @@ void Fixed_Point_Tests::test_method(A a, B b, Functor f)
 }
 
 
+void Fixed_Point_Tests::test_check(const std::string& str, bool comp_res)
+{
+	std::stringstream sstream;
+	sstream << str << ",   comp : " << comp_res;
+
+	if (comp_res)
+		os << green(sstream.str());
+	else
+		os <<   red(sstream.str());
+}
+
+
 template <typename A, class Functor>
 void Fixed_Point_Tests::test_bank(A a, Functor f, const std::string& op,
                                   const std::string& str_a)
@@ -313,7 +664,7 @@ void Fixed_Point_Tests::division(A a, B b, C c)
 struct incrementer_type
 {
 	template <typename A>
-	auto operator()(A a) -> decltype(a++)
+	A operator()(A a)
 	{
 		return (++a);
 	}
@@ -352,7 +703,7 @@ void Fixed_Point_Tests::increment(A a, B b, C c)
 struct decrementer_type
 {
 	template <typename A>
-	auto operator()(A a) -> decltype(a--)
+	A operator()(A a)
 	{
 		return (--a);
 	}
@@ -584,4 +935,1846 @@ void Fixed_Point_Tests::comp_low_or_equal(A a, B b, C c)
 	os_nline;
 }
 
+
+template <typename A>
+void Fixed_Point_Tests::storage(A a)
+{
+	using base_type = typename A::base_type;
+
+	std::stringstream sstream;
+	sstream << "sizeof = " << sizeof(A) << ",   base_type : " << sizeof(base_type)
+	        << ",   trivially copyable : " << std::is_trivially_copyable<A>::value;
+	os << "\t"; test_check(sstream.str(), sizeof(A) == sizeof(base_type) && std::is_trivially_copyable<A>::value);
+	os_nline;
+
+	A copies[4] = {a, -a, a, -a};
+	base_type raws[4];
+	std::memcpy(raws, copies, sizeof(copies));
+
+	sstream.str("");
+	sstream << "memcpy = " << raws[0] << " " << raws[1] << ",   raw : " << a.to_raw() << " " << (-a).to_raw();
+	os << "\t"; test_check(sstream.str(), raws[0] == a.to_raw() && raws[1] == (-a).to_raw() && raws[2] == raws[0] && raws[3] == raws[1]);
+	os_nline;
+}
+
+template <typename A, typename B, typename C>
+void Fixed_Point_Tests::storage(A a, B b, C c)
+{
+	test_header("storage", a, b, c, "a", "b", "c");
+	storage(a);
+	storage(b);
+	storage(c);
+	os_nline;
+}
+
+void Fixed_Point_Tests::constant_expression()
+{
+	constexpr FP_S<16,8> k    = 0.75;
+	constexpr FP_S<16,8> coefs[4] = {0.125, -0.5f, 1, FP_S<16,8>::max()};
+	constexpr auto       p    = k * FP_S<16,8>(2) + FP_S<8,4>(1.5f);
+	constexpr auto       q    = -(coefs[1] - k) / FP_S<16,8>(0.25);
+	constexpr bool       comp = (p > k) && (coefs[0] < k) && (std::abs(coefs[1]) == FP_S<16,8>(0.5));
+
+	static_assert(k.to_raw()        == 192,                            "k must be folded at compile time");
+	static_assert(coefs[1].to_raw() == -128,                           "coefs must be folded at compile time");
+	static_assert(coefs[3]          == FP_S<16,8>::max(),              "max() must be folded at compile time");
+	static_assert(p.to_raw()        == (3 << p.get_fractional_bits()), "k * 2 + 1.5 must be folded at compile time");
+	static_assert(comp,                                                "comparisons must be folded at compile time");
+
+	test_header("constant_expression", k, "k");
+
+	std::stringstream sstream;
+	sstream << "k * 2 + 1.5 = " << p.to_double() << p.display_quantification() << ",   expected : 3";
+	os << "\t"; test_check(sstream.str(), p.to_double() == 3.0); os_nline;
+
+	sstream.str("");
+	sstream << "-(-0.5 - k) / 0.25 = " << q.to_double() << q.display_quantification() << ",   expected : 5";
+	os << "\t"; test_check(sstream.str(), q.to_double() == 5.0); os_nline;
+
+	os_nline;
+}
+
+// fill v with pseudo random raw values (including the extreme ones) after its first element
+template <typename A>
+static void fill_random(std::vector<A>& v, uint64_t seed)
+{
+	for (size_t i = 1; i < v.size(); i++)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		v[i].set_data((int64_t)seed >> (i % 7) * 8);
+	}
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::batch(A a, B b)
+{
+	test_header("batch", a, b, "a", "b");
+
+	const size_t n = 1021; // not a multiple of the vector sizes to also test the remaining elements
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	fill_random(va, 1);
+	fill_random(vb, 2);
+
+	std::vector<typename FP_numeric::add_res_type<A,B>::type> add(n);
+	std::vector<typename FP_numeric::sub_res_type<A,B>::type> sub(n);
+	std::vector<typename FP_numeric::mul_res_type<A,B>::type> mul(n), scale(n);
+
+	FP_numeric::add_n  (va.data(), vb.data(), n, add.data());
+	FP_numeric::sub_n  (va.data(), vb.data(), n, sub.data());
+	FP_numeric::mul_n  (va.data(), vb.data(), n, mul.data());
+	FP_numeric::scale_n(va.data(), n, b,         scale.data());
+
+	bool add_ok = true, sub_ok = true, mul_ok = true, scale_ok = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		add_ok   &= add  [i].to_raw() == (va[i] + vb[i]).to_raw();
+		sub_ok   &= sub  [i].to_raw() == (va[i] - vb[i]).to_raw();
+		mul_ok   &= mul  [i].to_raw() == (va[i] * vb[i]).to_raw();
+		scale_ok &= scale[i].to_raw() == (va[i] * b    ).to_raw();
+	}
+
+	std::stringstream sstream;
+	sstream << "add_n   = " << add  [0] << ",   a + b : " << a + b;
+	os << "\t"; test_check(sstream.str(), add_ok); os_nline;
+	sstream.str("");
+	sstream << "sub_n   = " << sub  [0] << ",   a - b : " << a - b;
+	os << "\t"; test_check(sstream.str(), sub_ok); os_nline;
+	sstream.str("");
+	sstream << "mul_n   = " << mul  [0] << ",   a * b : " << a * b;
+	os << "\t"; test_check(sstream.str(), mul_ok); os_nline;
+	sstream.str("");
+	sstream << "scale_n = " << scale[0] << ",   a * b : " << a * b;
+	os << "\t"; test_check(sstream.str(), scale_ok); os_nline;
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Tests::saturating_batch(A a)
+{
+	test_header("saturating_batch", a, "a");
+
+	const size_t n = 1021;
+
+	std::vector<A> va(n, a), vb(n, a), res(n);
+	fill_random(va, 3);
+	fill_random(vb, 4);
+	vb[1] = A::max(); va[1] = A::max(); // saturated at max
+	vb[2] = A::min(); va[2] = A::min(); // saturated at min
+
+	FP_numeric::saturating_add_n(va.data(), vb.data(), n, res.data());
+
+	bool ok = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		A expected = va[i] + vb[i];
+		ok &= res[i].to_raw() == expected.to_raw();
+	}
+
+	std::stringstream sstream;
+	sstream << "saturating_add_n = " << res[0] << " " << res[1] << " " << res[2] << ",   a + a : " << (A)(a + a);
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+
+	os_nline;
+}
+
+template <typename A>
+void Fixed_Point_Tests::conversion(A a)
+{
+	test_header("conversion", a, "a");
+	conversion(a, 0.f, "float ");
+	conversion(a, 0.,  "double");
+	os_nline;
+}
+
+template <typename A, typename floating_t>
+void Fixed_Point_Tests::conversion(A a, floating_t, const std::string& str_f)
+{
+	const size_t n = 1021;
+	const floating_t quantum = floating_t(1) / A::one().to_raw();
+	const floating_t range   = A::max().template convert<floating_t>() * floating_t(1.5);
+
+	// a itself, halfway values between two quantums, values up to 1.5 times the range of A and far beyond it
+	std::vector<floating_t> in(n);
+	in[0] = a.template convert<floating_t>();
+	uint64_t seed = 5;
+	for (size_t i = 1; i < n; i++)
+	{
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		floating_t r = floating_t(int32_t(seed >> 32)) / floating_t(1u << 31); // in [-1, 1[
+		if (i % 3 == 0)
+			in[i] = (std::floor(r * range / quantum) + floating_t(0.5)) * quantum;
+		else if (i % 10 == 1)
+			in[i] = r * range * floating_t(1e6);
+		else
+			in[i] = r * range;
+	}
+
+	// the last values are huge, infinite or NaN: they saturate (NaN gives 0) and never wrap to the other end
+	const floating_t huge = std::numeric_limits<floating_t>::max(), inf = std::numeric_limits<floating_t>::infinity();
+	const std::vector<floating_t> special     = {huge, -huge, floating_t(6e18), inf, -inf, std::numeric_limits<floating_t>::quiet_NaN()};
+	const std::vector<A>          special_ref = {A::max(), A::min(), A::max(), A::max(), A::min(), A::zero()};
+	std::copy(special.begin(), special.end(), in.end() - special.size());
+
+	std::vector<A> fp(n);
+	FP_numeric::convert_n(in.data(), n, fp.data());
+
+	bool to_fp_ok = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		A expected = in[i];
+		to_fp_ok &= fp[i].to_raw() == expected.to_raw();
+	}
+
+	std::vector<floating_t> out(n);
+	FP_numeric::convert_n(fp.data(), n, out.data());
+
+	bool to_floating_ok = true;
+	for (size_t i = 0; i < n; i++)
+		to_floating_ok &= out[i] == fp[i].template convert<floating_t>();
+
+	bool special_ok = true;
+	for (size_t i = 0; i < special.size(); i++)
+	{
+		const A scalar = special[i];
+		special_ok &= scalar.to_raw() == special_ref[i].to_raw() && fp[n - special.size() + i].to_raw() == special_ref[i].to_raw();
+	}
+
+	std::stringstream sstream;
+	sstream << str_f << " -> FP = " << fp[0] << ",   a : " << a;
+	os << "\t"; test_check(sstream.str(), to_fp_ok); os_nline;
+	sstream.str("");
+	sstream << "FP -> " << str_f << " = " << std::setw(9) << out[0] << ",   a : " << a.template convert<floating_t>();
+	os << "\t"; test_check(sstream.str(), to_floating_ok); os_nline;
+	os << "\t"; test_check("huge, infinite and NaN " + str_f + " -> FP saturated" + a.display_quantification(), special_ok); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::array(A a, B b)
+{
+	test_header("array", a, b, "a", "b");
+
+	using array_a = FP_numeric::FP_array<A::Tb, A::Fb>;
+	using array_b = FP_numeric::FP_array<B::Tb, B::Fb>;
+
+	auto aligned = [](const void* p) { return reinterpret_cast<uintptr_t>(p) % 64 == 0; };
+
+	array_a va(3, a);
+	bool aligned_ok = aligned(va.data());
+	for (size_t i = 0; i < 1000; i++)
+	{
+		va.push_back(-a);
+		aligned_ok &= aligned(va.data());
+	}
+	va.reserve(5000); aligned_ok &= aligned(va.data());
+	va.resize (4097); aligned_ok &= aligned(va.data());
+
+	std::stringstream sstream;
+	sstream << "size = " << va.size() << ",   capacity : " << va.capacity() << ",   aligned : " << aligned_ok;
+	os << "\t"; test_check(sstream.str(), aligned_ok && va.size() == 4097 && va.capacity() >= 5000); os_nline;
+
+	bool raw_ok = (const void*)va.raw() == (const void*)va.data()
+	           && va[0] == a && va[3] == -a && va[1002] == -a && va[1003] == 0 && va.back() == 0;
+	for (size_t i = 0; i < va.size(); i++)
+		raw_ok &= va.raw()[i] == va[i].to_raw();
+
+	sstream.str("");
+	sstream << "raw = " << va.raw()[0] << " " << va.raw()[3] << ",   values : " << va[0] << " " << va[3];
+	os << "\t"; test_check(sstream.str(), raw_ok); os_nline;
+
+	std::vector<float> floats(va.size());
+	for (size_t i = 0; i < floats.size(); i++)
+		floats[i] = a.to_float() * float(i % 17) / 7.f;
+
+	array_b vb(floats.data(), floats.size());
+	bool float_ok = vb.size() == floats.size();
+	for (size_t i = 0; i < vb.size(); i++)
+		float_ok &= vb[i] == B(floats[i]);
+
+	sstream.str("");
+	sstream << "from float = " << vb[8] << ",   operator= : " << B(floats[8]);
+	os << "\t"; test_check(sstream.str(), float_ok); os_nline;
+
+	FP_numeric::FP_array<A::Tb + B::Tb - 1, A::Fb + B::Fb> vmul(va.size());
+	FP_numeric::mul_n(va.data(), vb.data(), va.size(), vmul.data());
+	bool mul_ok = true;
+	for (size_t i = 0; i < va.size(); i++)
+		mul_ok &= vmul[i] == va[i] * vb[i];
+
+	sstream.str("");
+	sstream << "mul_n = " << vmul[8] << ",   a * b : " << va[8] * vb[8];
+	os << "\t"; test_check(sstream.str(), mul_ok); os_nline;
+
+	FP_numeric::FP_array<A::Tb, A::Fb, std::allocator<A>> vs = {a, -a, a};
+	vs.resize(10, -a);
+	sstream.str("");
+	sstream << "std::allocator = " << vs.front() << " " << vs.back() << ",   size : " << vs.size();
+	os << "\t"; test_check(sstream.str(), vs.size() == 10 && vs[2] == a && vs.back() == -a); os_nline;
+
+	bool throw_ok = false;
+	try { vs.at(10); } catch (const std::out_of_range&) { throw_ok = true; }
+	os << "\t"; test_check("at(size) throws std::out_of_range", throw_ok); os_nline;
+
+	os_nline;
+}
+
+template <typename A, typename B, typename C, typename Lazy, typename Eager>
+void Fixed_Point_Tests::expression(A a, B b, C c, Lazy lazy, Eager eager, const std::string& str)
+{
+	using lazy_t  = decltype(FP_numeric::eval(lazy(a, b, c)));
+	using eager_t = decltype(eager(a, b, c));
+
+	// the given values then values spread on all the range of A, B and C
+	bool ok = std::is_same<lazy_t, eager_t>::value;
+	std::vector<A> va(257, a);
+	std::vector<B> vb(257, b);
+	std::vector<C> vc(257, c);
+	fill_random(va, 6);
+	fill_random(vb, 7);
+	fill_random(vc, 8);
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		va[i] = std::max(std::min(va[i], A::max()), A::min());
+		vb[i] = std::max(std::min(vb[i], B::max()), B::min());
+		vc[i] = std::max(std::min(vc[i], C::max()), C::min());
+
+		lazy_t res = lazy(va[i], vb[i], vc[i]);
+		ok &= res.to_raw() == eager(va[i], vb[i], vc[i]).to_raw();
+	}
+
+	lazy_t res = lazy(a, b, c);
+	std::stringstream sstream;
+	sstream << std::setw(18) << str << " = " << res << ",   operators : " << eager(a, b, c);
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::accumulator(A a, B b)
+{
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+	using acc_t = FP_numeric::accumulator<mul_t::Tb, mul_t::Fb, 9>; // 9 guard bits for the 257 products
+	using reg_t = typename acc_t::value_type;
+
+	test_header("accumulator", a, b, "a", "b");
+
+	std::vector<A> va(257, a);
+	std::vector<B> vb(257, b);
+	fill_random(va, 9);
+	fill_random(vb, 10);
+
+	acc_t acc;
+	reg_t ref = 0;
+	A     sat = 0; // the usual loop: saturated and re-quantified at each iteration
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		va[i] = std::max(std::min(va[i], A::max()), A::min());
+		vb[i] = std::max(std::min(vb[i], B::max()), B::min());
+
+		if (i % 5 == 4)
+		{
+			acc.msu(va[i], vb[i]);
+			ref = ref - va[i] * vb[i];
+			sat -= va[i] * vb[i];
+		}
+		else
+		{
+			acc.mac(va[i], vb[i]);
+			ref = ref + va[i] * vb[i];
+			sat += va[i] * vb[i];
+		}
+	}
+
+	std::stringstream sstream;
+	sstream << "register : " << acc.value() << ",   operators : " << ref;
+	os << "\t"; test_check(sstream.str(), acc.to_raw() == ref.to_raw()); os_nline;
+
+	bool ok = accumulator_result<acc_t, A::Tb, A::Fb>(acc)
+	        & accumulator_result<acc_t, B::Tb, B::Fb>(acc)
+	        & accumulator_result<acc_t, mul_t::Tb, mul_t::Fb>(acc)
+	        & accumulator_result<acc_t, mul_t::Tb + 4, mul_t::Fb + 3>(acc)
+	        & accumulator_result<acc_t, mul_t::Tb, 0>(acc);
+
+	// the partial sums must be rounded the same way
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		acc_t partial(va[i] * vb[i]);
+		ok &= accumulator_result<acc_t, A::Tb, A::Fb>(partial) & accumulator_result<acc_t, 8, 1>(partial);
+	}
+
+	sstream.str("");
+	sstream << "result<" << A::Tb << "," << A::Fb << ">() = " << acc.template result<A::Tb, A::Fb>()
+	        << ",   saturated at each iteration : " << sat;
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+}
+
+template <typename Acc, size_t To, size_t Fo>
+bool Fixed_Point_Tests::accumulator_result(const Acc& acc)
+{
+	using res_t = FP_S<To, Fo>;
+
+	long double ref = std::floor(std::ldexp((long double)acc.to_raw(), (int)Fo - (int)Acc::Fb) + 0.5L);
+	ref = std::max(std::min(ref, (long double)res_t::max().get_data()), (long double)res_t::min().get_data());
+
+	return (long double)acc.template result<To, Fo>().get_data() == ref;
+}
+
+template <size_t N, typename A, typename B>
+void Fixed_Point_Tests::dot(A a, B b, size_t n)
+{
+	using res_t = typename FP_numeric::dot_res_type<A, B, N>::type;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	fill_random(va, 11);
+	fill_random(vb, 12);
+
+	res_t ref = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i] = std::max(std::min(va[i], A::max()), A::min());
+		vb[i] = std::max(std::min(vb[i], B::max()), B::min());
+		ref = ref + va[i] * vb[i];
+	}
+
+	// with the extreme values: the sum of products must not overflow
+	std::vector<A> va_max(n, A::min());
+	std::vector<B> vb_max(n, B::min());
+	res_t ref_max = 0;
+	for (size_t i = 0; i < n; i++)
+		ref_max = ref_max + va_max[i] * vb_max[i];
+
+	res_t res = FP_numeric::dot<N>(va.data(), vb.data(), n);
+
+	std::stringstream sstream;
+	sstream << "dot<" << N << ">(a, b, " << n << ") = " << res << ",   operators : " << ref;
+	os << "\t"; test_check(sstream.str(), res.to_raw() == ref.to_raw()
+	                                    && FP_numeric::dot<N>(va_max.data(), vb_max.data(), n).to_raw() == ref_max.to_raw()
+	                                    && ref_max.is_spos()); os_nline;
+}
+
+template <size_t Ntaps, typename C, typename X>
+void Fixed_Point_Tests::fir(C c, X x)
+{
+	using fir_t = FP_numeric::fir<C::Tb, C::Fb, X::Tb, X::Fb, Ntaps>;
+	using res_t = typename fir_t::res_type;
+
+	const size_t n = 300;
+
+	std::vector<C> coefs(Ntaps, c);
+	std::vector<X> vx(n, x);
+	fill_random(coefs, 13);
+	fill_random(vx,    14);
+	for (auto& k : coefs) k = std::max(std::min(k, C::max()), C::min());
+	for (auto& v : vx   ) v = std::max(std::min(v, X::max()), X::min());
+
+	fir_t filter(coefs.data());
+	std::vector<res_t> y(n);
+	std::vector<X>     y_sat(n);
+	filter.process(vx.data(), n, y.data());
+	filter.reset();
+	filter.process(vx.data(), n, y_sat.data());
+
+	// n is larger than the history block: the history is rewound while filtering
+	static_assert(fir_t::block < 300, "the history must be rewound during the test");
+
+	// direct convolution with the operators (the samples before the first one are null)
+	fir_t stream(coefs.data());
+	bool ok = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		res_t ref = 0;
+		for (size_t k = 0; k < Ntaps && k <= i; k++)
+			ref = ref + coefs[k] * vx[i - k];
+
+		X ref_sat = ref;
+		ok &= (y[i].to_raw() == ref.to_raw()) && (y_sat[i].to_raw() == ref_sat.to_raw()) && (stream(vx[i]).to_raw() == ref.to_raw());
+	}
+
+	std::stringstream sstream;
+	sstream << "fir<" << Ntaps << "> y[" << n-1 << "] = " << y[n-1] << ",   saturated : " << y_sat[n-1];
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+}
+
+template <size_t K, typename A, typename B>
+void Fixed_Point_Tests::gemm(A a, B b, size_t m, size_t n, size_t k, FP_numeric::thread_pool& pool)
+{
+	using res_t = typename FP_numeric::dot_res_type<A, B, K>::type;
+	using layout = FP_numeric::Matrix_layout;
+
+	// row-major matrices, and their col-major copies
+	std::vector<A> ma(m * k, a), ma_t(m * k);
+	std::vector<B> mb(k * n, b), mb_t(k * n);
+	fill_random(ma, 15);
+	fill_random(mb, 16);
+	for (auto& v : ma) v = std::max(std::min(v, A::max()), A::min());
+	for (auto& v : mb) v = std::max(std::min(v, B::max()), B::min());
+	for (size_t i = 0; i < m; i++) for (size_t p = 0; p < k; p++) ma_t[p*m + i] = ma[i*k + p];
+	for (size_t p = 0; p < k; p++) for (size_t j = 0; j < n; j++) mb_t[j*k + p] = mb[p*n + j];
+
+	// naive triple loop with the operators
+	std::vector<res_t> ref(m * n);
+	for (size_t i = 0; i < m; i++)
+		for (size_t j = 0; j < n; j++)
+		{
+			res_t sum = 0;
+			for (size_t p = 0; p < k; p++)
+				sum = sum + ma[i*k + p] * mb[p*n + j];
+			ref[i*n + j] = sum;
+		}
+
+	bool ok = true;
+	std::vector<res_t> mc(m * n);
+	std::vector<A>     mc_sat(m * n);
+	for (int l = 0; l < 4; l++)
+	{
+		const bool a_row = (l & 1), b_row = (l & 2);
+		FP_numeric::gemm<K>(m, n, k, a_row? ma.data() : ma_t.data(), a_row? layout::ROW_MAJOR : layout::COL_MAJOR,
+		                             b_row? mb.data() : mb_t.data(), b_row? layout::ROW_MAJOR : layout::COL_MAJOR,
+		                             mc.data(), (l == 1)? layout::COL_MAJOR : layout::ROW_MAJOR, pool);
+
+		for (size_t i = 0; i < m; i++)
+			for (size_t j = 0; j < n; j++)
+				ok &= mc[(l == 1)? j*m + i : i*n + j].to_raw() == ref[i*n + j].to_raw();
+	}
+
+	// requantized in the type of a
+	FP_numeric::gemm<K>(m, n, k, ma.data(), layout::ROW_MAJOR, mb.data(), layout::ROW_MAJOR, mc_sat.data(), layout::ROW_MAJOR, pool);
+	for (size_t i = 0; i < m * n; i++)
+	{
+		A ref_sat = ref[i];
+		ok &= mc_sat[i].to_raw() == ref_sat.to_raw();
+	}
+
+	std::stringstream sstream;
+	sstream << "gemm<" << K << ">(" << m << "x" << k << " * " << k << "x" << n << ", " << pool.size() << " threads) : c[0] = "
+	        << mc[0] << ",   requantized : " << mc_sat[0];
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::division_variants(A a, B b)
+{
+	using div_t = typename FP_numeric::div_res_type<A, B>::type;
+	using rem_t = typename FP_numeric::sub_res_type<A, typename FP_numeric::mul_res_type<A, B>::type>::type;
+
+	const size_t n = 1021;
+
+	std::vector<A> va(n, a);
+	std::vector<B> vb(n, b);
+	fill_random(va, 17);
+	fill_random(vb, 18);
+
+	bool ok_sat = true, ok_mod = true, ok_fast = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		va[i] = std::max(std::min(va[i], A::max()), A::min());
+		vb[i] = std::max(std::min(vb[i], B::max()), B::min());
+		if (!vb[i])
+			continue;
+
+		const div_t ref = va[i] / vb[i];
+		ok_sat &= FP_numeric::div_sat(va[i], vb[i]).to_raw() == ref.to_raw();
+
+		// quotient saturated in A
+		A     q_ref, q;
+		rem_t r_ref, r;
+		FP_numeric::div   (va[i], vb[i], q_ref, r_ref);
+		FP_numeric::divmod(va[i], vb[i], q,     r);
+		ok_mod &= q.to_raw() == q_ref.to_raw() && r.to_raw() == r_ref.to_raw();
+
+		// |error| < 2^-28 * |quotient| + 1 unit of the last place
+		const long double err = std::fabs((long double)FP_numeric::div_fast(va[i], vb[i]).to_raw() - (long double)ref.to_raw());
+		ok_fast &= err <= std::ldexp(std::fabs((long double)ref.to_raw()), -28) + 1;
+	}
+
+	std::stringstream sstream;
+	sstream << "div_sat(a, b) == a / b";
+	os << "\t"; test_check(sstream.str(), ok_sat); os_nline;
+	sstream.str("");
+	sstream << "divmod(a, b, q, r) == div(a, b, q, r) with q" << a.display_quantification();
+	os << "\t"; test_check(sstream.str(), ok_mod); os_nline;
+	sstream.str("");
+	sstream << "div_fast(a, b) : " << FP_numeric::div_fast(va[1], vb[1]) << ",   a / b : " << va[1] / vb[1];
+	os << "\t"; test_check(sstream.str(), ok_fast); os_nline;
+}
+
+template <int64_t D, typename A, typename B>
+void Fixed_Point_Tests::division_by(A a, B b)
+{
+	using div_t = typename FP_numeric::div_res_type<A, B>::type;
+
+	B k = b;
+	k.set_data(D);
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = A::min().get_data(); x <= A::max().get_data(); x++)
+			va.push_back(a), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(1021, a);
+		fill_random(va, 19);
+		for (auto& v : va) v = std::max(std::min(v, A::max()), A::min());
+	}
+
+	std::vector<div_t> res(va.size());
+	FP_numeric::div_by_n<B::Tb, B::Fb, D>(va.data(), va.size(), res.data());
+
+	bool ok = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const div_t ref = va[i] / k;
+		ok &= FP_numeric::div_by<B::Tb, B::Fb, D>(va[i]).to_raw() == ref.to_raw() && res[i].to_raw() == ref.to_raw();
+	}
+
+	std::stringstream sstream;
+	sstream << "div_by<" << k << ">(a) == a / " << k << " for " << va.size() << " values of a" << a.display_quantification();
+	os << "\t"; test_check(sstream.str(), ok); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::square_root(A a, B b)
+{
+	using sqrt_t  = typename FP_numeric::sqrt_res_type<A>::type;
+	using rsqrt_t = typename FP_numeric::rsqrt_res_type<A>::type;
+	using hypot_t = typename FP_numeric::hypot_res_type<A, B>::type;
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = A::min().get_data(); x <= A::max().get_data(); x++)
+			va.push_back(a), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(1021, a);
+		fill_random(va, 23);
+		for (auto& v : va) v = std::max(std::min(v, A::max()), A::min());
+		va.push_back(A::max()), va.push_back(A::min()), va.push_back(A(0));
+	}
+
+	std::vector<B> vb(va.size(), b);
+	fill_random(vb, 29);
+	for (auto& v : vb) v = std::max(std::min(v, B::max()), B::min());
+
+	// truncation of the exact value in units of the last place of the result
+	auto ulps = [](long double x, size_t F){ return (int64_t)std::floor(std::ldexp(x, (int)F)); };
+	auto real = [](int64_t data, size_t F){ return std::ldexp((long double)data, -(int)F); };
+
+	bool ok_sqrt = true, ok_rsqrt = true, ok_hypot = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const long double x = real(va[i].get_data(), A::Fb), y = real(vb[i].get_data(), B::Fb);
+
+		ok_hypot &= std::hypot(va[i], vb[i]).get_data() == ulps(std::sqrt(x*x + y*y), hypot_t::Fb);
+
+		if (x < 0)
+		{
+			bool thrown = false;
+			try { std::sqrt(va[i]); } catch (std::domain_error&) { thrown = true; }
+			ok_sqrt &= thrown;
+		}
+		else
+		{
+			ok_sqrt  &= std::sqrt(va[i]).get_data() == ulps(std::sqrt(x), sqrt_t::Fb);
+			ok_rsqrt &= FP_numeric::rsqrt(va[i]).get_data() ==
+			            ((x == 0)? rsqrt_t::max().get_data() : ulps(1 / std::sqrt(x), rsqrt_t::Fb));
+		}
+	}
+
+	std::stringstream sstream;
+	sstream << " for " << va.size() << " values of a" << a.display_quantification();
+	os << "\t"; test_check("sqrt(a) == truncated sqrt(a.to_long_double())"  + sstream.str(), ok_sqrt ); os_nline;
+	os << "\t"; test_check("rsqrt(a) == truncated 1/sqrt(a.to_long_double())" + sstream.str(), ok_rsqrt); os_nline;
+	os << "\t"; test_check("hypot(a, b) == truncated hypot(a.to_long_double(), b.to_long_double())" + sstream.str(), ok_hypot); os_nline;
+
+	constexpr FP_S<16,8> c = 6.25;
+	static_assert(std::sqrt(c) == 2.5, "must be folded at compile time");
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::transcendental(A a, B b)
+{
+	using trig_t  = typename FP_numeric::trig_res_type<A>::type;
+	using atan2_t = typename FP_numeric::atan2_res_type<A, B>::type;
+	using log_t   = typename FP_numeric::log_res_type<A>::type;
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = A::min().get_data(); x <= A::max().get_data(); x++)
+			va.push_back(a), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(1021, a);
+		fill_random(va, 31);
+		for (auto& v : va) v = std::max(std::min(v, A::max()), A::min());
+		va.push_back(A::max()), va.push_back(A::min()), va.push_back(A(0));
+	}
+
+	std::vector<B> vb(va.size(), b);
+	fill_random(vb, 37);
+	for (auto& v : vb) v = std::max(std::min(v, B::max()), B::min());
+
+	// distance in units of the last place of the result between its raw data and the exact value
+	auto ulps = [](int64_t data, long double x, size_t F){ return std::fabs((long double)data - std::ldexp(x, (int)F)); };
+	auto real = [](int64_t data, size_t F){ return std::ldexp((long double)data, -(int)F); };
+
+	long double err_sin = 0, err_cos = 0, err_atan2 = 0, err_exp = 0, err_log2 = 0, err_log = 0;
+	bool ok_domain = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const long double x = real(va[i].get_data(), A::Fb), y = real(vb[i].get_data(), B::Fb);
+
+		trig_t s, c;
+		FP_numeric::sincos(va[i], s, c);
+		err_sin   = std::max(err_sin,   ulps(s.get_data(), std::sin(x), trig_t::Fb));
+		err_cos   = std::max(err_cos,   ulps(c.get_data(), std::cos(x), trig_t::Fb));
+		err_sin   = std::max(err_sin,   ulps(std::sin(va[i]).get_data() - s.get_data(), 0, 0));
+		err_atan2 = std::max(err_atan2, ulps(std::atan2(va[i], vb[i]).get_data(), std::atan2(x, y), atan2_t::Fb));
+
+		const long double e = std::min(std::exp(x), real(A::max().get_data(), A::Fb));
+		err_exp = std::max(err_exp, ulps(std::exp(va[i]).get_data(), e, A::Fb));
+
+		if (x <= 0)
+		{
+			bool thrown = false;
+			try { std::log2(va[i]); } catch (std::domain_error&) { thrown = true; }
+			ok_domain &= thrown;
+		}
+		else
+		{
+			err_log2 = std::max(err_log2, ulps(std::log2(va[i]).get_data(), std::log2(x), log_t::Fb));
+			err_log  = std::max(err_log,  ulps(std::log (va[i]).get_data(), std::log (x), log_t::Fb));
+		}
+	}
+
+	std::stringstream sstream;
+	sstream << " for " << va.size() << " values of a" << a.display_quantification() << " (max ";
+	auto check = [&](const std::string& str, long double err)
+	{
+		std::stringstream max_err;
+		max_err << std::setprecision(3) << (double)err << " ulp)";
+		os << "\t"; test_check(str + sstream.str() + max_err.str(), err <= 1); os_nline;
+	};
+	check("|sin(a) - sin(a.to_long_double())| <= 1 ulp",                                      err_sin);
+	check("|cos(a) - cos(a.to_long_double())| <= 1 ulp",                                      err_cos);
+	check("|atan2(a, b) - atan2(a.to_long_double(), b.to_long_double())| <= 1 ulp",           err_atan2);
+	check("|exp(a) - exp(a.to_long_double())| <= 1 ulp",                                      err_exp);
+	check("|log2(a) - log2(a.to_long_double())| <= 1 ulp",                                    err_log2);
+	check("|log(a) - log(a.to_long_double())| <= 1 ulp",                                      err_log);
+	os << "\t"; test_check("log2(a) and log(a) throw std::domain_error for a <= 0", ok_domain); os_nline;
+
+	constexpr FP_S<16,8> z = 0, k = 8;
+	static_assert(std::sin(z) == 0 && std::cos(z) == 1 && std::log2(k) == 3 && std::exp(z) == 1,
+	              "must be folded at compile time");
+}
+
+template <class Func, size_t Size, typename A, typename B>
+void Fixed_Point_Tests::lookup_table(A a, B b)
+{
+	using table = FP_numeric::lut<A::Tb, A::Fb, B::Tb, B::Fb, Func, Size>;
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = A::min().get_data(); x <= A::max().get_data(); x++)
+			va.push_back(a), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(1021, a);
+		fill_random(va, 41);
+		for (auto& v : va) v = std::max(std::min(v, A::max()), A::min());
+		va.push_back(A::max()), va.push_back(A::min()), va.push_back(A(0));
+	}
+
+	bool ok_samples = true;
+	for (size_t i = 0; i < table::size; i++)
+		ok_samples &= table::sample(i).get_data() == B(Func()(table::abscissa(i))).get_data();
+
+	// the nearest sample and the exact linear interpolation between the samples around x, in long double
+	long double err_interpolate = 0;
+	bool ok_lookup = true;
+	for (const auto& x : va)
+	{
+		const long double u = (long double)x.get_data() + std::ldexp(1.0L, (int)A::Tb - 1);
+		const long double t = u / std::ldexp(1.0L, (int)table::shift);
+		const size_t      i = (size_t)std::floor(t);
+		const size_t      n = (t - i >= 0.5L)? i + 1 : i;
+
+		ok_lookup &= table::lookup(x).get_data() == table::sample(n).get_data();
+
+		const long double y0 = table::sample(i).get_data();
+		const long double y1 = (i + 1 < table::size)? table::sample(i + 1).get_data() : y0;
+		err_interpolate = std::max(err_interpolate, std::fabs(table::interpolate(x).get_data() - (y0 + (y1 - y0) * (t - i))));
+	}
+
+	std::vector<B> res(va.size()), res_n(va.size());
+	bool ok_n = table::lookup_n(va.data(), va.size(), res_n.data()) == res_n.data() + va.size();
+	for (size_t i = 0; i < va.size(); i++) res[i] = table::lookup(va[i]);
+	ok_n &= std::memcmp(res.data(), res_n.data(), res.size() * sizeof(B)) == 0;
+	table::interpolate_n(va.data(), va.size(), res_n.data());
+	for (size_t i = 0; i < va.size(); i++) res[i] = table::interpolate(va[i]);
+	ok_n &= std::memcmp(res.data(), res_n.data(), res.size() * sizeof(B)) == 0;
+
+	std::stringstream sstream;
+	sstream << " of a table of " << table::size << " samples (" << table::bytes << " bytes) from a"
+	        << a.display_quantification() << " to b" << b.display_quantification();
+	os << "\t"; test_check("sample(i) == Func(abscissa(i))" + sstream.str(), ok_samples); os_nline;
+	os << "\t"; test_check("lookup(a) == nearest sample" + sstream.str(), ok_lookup); os_nline;
+	os << "\t"; test_check("|interpolate(a) - linear interpolation| <= 0.5 ulp" + sstream.str(), err_interpolate <= 0.5L); os_nline;
+	os << "\t"; test_check("lookup_n and interpolate_n == lookup and interpolate" + sstream.str(), ok_n); os_nline;
+
+	static_assert(alignof(table) <= 64 && table::bytes % 64 == 0, "the samples must be aligned on a cache line");
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::overflow_policies(A a, B b)
+{
+	test_header("overflow_policies", a, b, "a", "b");
+
+	using W    = FP_S<A::Tb, A::Fb, FP_numeric::Arithmetic_type::SIGNED_WRAPPED>;
+	using C    = FP_S<A::Tb, A::Fb, FP_numeric::Arithmetic_type::SIGNED_CHECKED>;
+	using wide = FP_S<A::Tb + B::Tb + 2, A::Fb>; // the results truncated in the fractional bits of A, never saturated
+
+	std::vector<W> vw;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = W::min().get_data(); x <= W::max().get_data(); x++)
+			vw.push_back(W()), vw.back().set_data(x);
+	}
+	else
+	{
+		vw.resize(4093, W(a));
+		fill_random(vw, 43);
+		vw.push_back(W::max()), vw.push_back(W::min()), vw.push_back(W(0));
+	}
+	std::vector<B> vb(61, b);
+	fill_random(vb, 47);
+	vb.push_back(B::max()), vb.push_back(B::min()), vb.push_back(B::one()), vb.push_back(-B::one());
+
+	const int64_t max = A::max().get_data();
+	bool ok_wrap = true, ok_sat = true, ok_check = true;
+
+	// ref is the exact result truncated in wide, r the raw results of the 3 policies (nothing stored if r_check throws)
+	auto check = [&](int64_t ref, int64_t r_wrap, int64_t r_sat, bool thrown, int64_t r_check, bool sat_defined)
+	{
+		ok_wrap &= r_wrap == FP_numeric::sign_extension(ref, A::Tb);
+		if (!sat_defined) return;
+		ok_sat   &= r_sat == std::min(std::max(ref, -max), max);
+		ok_check &= (thrown == (ref < -max || ref > max)) && (thrown || r_check == r_sat);
+	};
+
+	for (const auto& x : vw)
+		for (const auto& y : vb)
+		{
+			const bool sat_defined = x.get_data() >= -max; // min() of W is out of the symmetric range of A and C
+			A xs; xs.set_data(x.get_data());
+
+			W w = x; w += y; A s = xs; s += y; C c; bool thrown = false;
+			try { c = xs; c += y; } catch (std::overflow_error&) { thrown = true; }
+			check(wide(xs + y).get_data(), w.get_data(), s.get_data(), thrown, c.get_data(), sat_defined);
+
+			w = x; w *= y; s = xs; s *= y; thrown = false;
+			try { c = xs; c *= y; } catch (std::overflow_error&) { thrown = true; }
+			check(wide(xs * y).get_data(), w.get_data(), s.get_data(), thrown, c.get_data(), sat_defined);
+		}
+
+	W w_max = W::max(); ++w_max;
+	A s_max = A::max(); ++s_max;
+	C c_max = C::max(); bool thrown = false;
+	try { ++c_max; } catch (std::overflow_error&) { thrown = true; }
+
+	std::stringstream sstream;
+	sstream << " of a" << W().display_quantification() << " and b" << b.display_quantification();
+	os << "\t"; test_check("wrapped a += b and a *= b == exact result modulo 2^T" + sstream.str(), ok_wrap); os_nline;
+	os << "\t"; test_check("saturated a += b and a *= b == exact result clamped in [-max, max]" + sstream.str(), ok_sat); os_nline;
+	os << "\t"; test_check("checked a += b and a *= b == saturated or throws std::overflow_error" + sstream.str(), ok_check); os_nline;
+	os << "\t"; test_check("++max() == min() + 1 - ulp if wrapped, == max() if saturated, throws if checked",
+	                       w_max.get_data() == W::min().get_data() + W::one().get_data() - 1
+	                       && s_max.is_max() && thrown && c_max.is_max()); os_nline;
+	os << "\t"; test_check("-min() == min() if wrapped", (-W::min()).get_data() == W::min().get_data()); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::unsigned_types(A a, B b)
+{
+	test_header("unsigned_types", a, b, "a", "b");
+
+	using W = FP_U<A::Tb, A::Fb, FP_numeric::Arithmetic_type::UNSIGNED_WRAPPED>;
+	using C = FP_U<A::Tb, A::Fb, FP_numeric::Arithmetic_type::UNSIGNED_CHECKED>;
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (uint64_t x = 0; x <= (uint64_t)A::max().get_data(); x++)
+			va.push_back(A()), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(4093, a);
+		fill_random(va, 53);
+		va.push_back(A::max()), va.push_back(A::min());
+	}
+	std::vector<B> vb(61, b);
+	fill_random(vb, 59);
+	vb.push_back(B::max()), vb.push_back(B::min()), vb.push_back(B::one()), vb.push_back(B(0));
+
+	const double ulp = std::ldexp(1.0, -(int)A::Fb), max = A::max().to_double();
+	bool ok_conv = true, ok_ops = true, ok_comp = true, ok_store = true;
+
+	for (const auto& x : va)
+	{
+		const double dx = (double)x.get_data() * ulp;
+		ok_conv &= x.to_double() == dx && A(dx) == x && A(dx + ulp/4) == x && x.is_pos()
+		        && x.to_lint() == (int64_t)std::floor(dx + 0.5) && (-x).is_zero();
+
+		for (const auto& y : vb)
+		{
+			const double dy = y.to_double();
+			ok_ops &= (x + y).to_double() == dx + dy && (x - y).to_double() == dx - dy && (x * y).to_double() == dx * dy;
+			ok_comp &= (x < y) == (dx < dy) && (x > y) == (dx > dy) && (x == y) == (dx == dy) && (x >= y) == (dx >= dy);
+
+			// the difference (truncated toward zero in the fractional bits of A) is stored in A: saturated in [0, max],
+			// wrapped modulo 2^T or checked
+			const double d = std::trunc((dx - dy) / ulp) * ulp, wrapped = d - std::floor(d / (max + ulp)) * (max + ulp);
+			A s = x; s -= y;
+			W w; w.set_data(x.get_data()); w -= y;
+			C c; bool thrown = false;
+			try { c = x; c -= y; } catch (std::overflow_error&) { thrown = true; }
+
+			const double clamped = std::min(std::max(d, 0.0), max);
+			ok_store &= s.to_double() == clamped && w.to_double() == wrapped
+			         && thrown == (d < 0 || d > max) && (thrown || c.to_double() == clamped);
+		}
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+	os << "\t"; test_check("a == data * 2^-F, rounded to integer, from double and negated (0)" + sstream.str(), ok_conv); os_nline;
+	os << "\t"; test_check("a + b, a - b and a * b == exact results" + sstream.str(), ok_ops); os_nline;
+	os << "\t"; test_check("a < b, a > b, a == b and a >= b == comparisons of the values" + sstream.str(), ok_comp); os_nline;
+	os << "\t"; test_check("a -= b saturated in [0, max], wrapped modulo 2^T or checked" + sstream.str(), ok_store); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::rounding_modes(A a, B b)
+{
+	test_header("rounding_modes", a, b, "a", "b");
+
+	std::vector<A> va;
+	if (A::Tb <= 16)
+	{
+		for (int64_t x = A::min().get_data(); x <= (int64_t)A::max().get_data(); x++)
+			va.push_back(A()), va.back().set_data(x);
+	}
+	else
+	{
+		va.resize(4093, a);
+		fill_random(va, 61);
+		va.push_back(A::max()), va.push_back(A::min());
+	}
+
+	using R = FP_numeric::Rounding_type;
+	rounding_mode<R::TRUNCATED        >(va, b, "truncated        ");
+	rounding_mode<R::ROUNDED_HALF_UP  >(va, b, "rounded half up  ");
+	rounding_mode<R::ROUNDED_HALF_EVEN>(va, b, "rounded half even");
+	rounding_mode<R::ROUNDED_TO_ZERO  >(va, b, "rounded to zero  ");
+}
+
+template <FP_numeric::Rounding_type R, typename A, typename B>
+void Fixed_Point_Tests::rounding_mode(const std::vector<A>& va, B b, const std::string& mode)
+{
+	// the exact value v rounded to an integer in function of R (std::nearbyint rounds the ties to even)
+	const auto round = [](double v)
+	{
+		return (R == FP_numeric::Rounding_type::TRUNCATED)         ? std::floor(v)
+		     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_UP)   ? std::floor(v + 0.5)
+		     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_EVEN) ? std::nearbyint(v)
+		                                                           : std::trunc(v);
+	};
+
+	const double ulp = std::ldexp(1.0, -(int)B::Fb);
+	const size_t n   = va.size();
+
+	std::vector<double> vd(n);
+	std::vector<float>  vf(n);
+	std::vector<B> scalar(n), from_double(n), requantized(n), batch_double(n), batch_float(n);
+
+	bool ok_req = true, ok_float = true, ok_conv = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		const double dx = va[i].to_double();
+		const double ref = std::min(std::max(round(dx / ulp) * ulp, B::min().to_double()), B::max().to_double());
+
+		vd[i] = dx;
+		vf[i] = (float)dx;
+		scalar     [i].template change_data<R>(va[i]);
+		from_double[i].template change_data<R>(dx, B::Tb, B::Fb);
+
+		ok_req   &= scalar     [i].to_double() == ref;
+		ok_float &= from_double[i].to_double() == ref;
+		ok_conv  &= va[i].template convert<int64_t, R>() == (int64_t)round(dx);
+	}
+
+	FP_numeric::requantize_n<R>(va.data(), n, requantized.data());
+	FP_numeric::convert_n   <R>(vd.data(), n, batch_double.data());
+	FP_numeric::convert_n   <R>(vf.data(), n, batch_float .data());
+
+	bool ok_batch = true;
+	for (size_t i = 0; i < n; i++)
+	{
+		B f; f.template change_data<R>(vf[i], B::Tb, B::Fb);
+		ok_batch &= requantized[i] == scalar[i] && batch_double[i] == from_double[i] && batch_float[i] == f;
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << va[0].display_quantification() << " in b" << b.display_quantification();
+	os << "\t"; test_check(mode + " : a requantized with change_data == rounded a"                  + sstream.str(), ok_req  ); os_nline;
+	os << "\t"; test_check(mode + " : double a converted with change_data == rounded a"            + sstream.str(), ok_float); os_nline;
+	os << "\t"; test_check(mode + " : a converted to integer == rounded a"                         + sstream.str(), ok_conv ); os_nline;
+	os << "\t"; test_check(mode + " : requantize_n and convert_n == scalar requantizations"        + sstream.str(), ok_batch); os_nline;
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef          __int128 test_int128;
+__extension__ typedef unsigned __int128 test_uint128;
+
+static test_int128 to_int128(const FP_numeric::int128_t& x)
+{
+	return (test_int128)(((test_uint128)x.high() << 64) | x.low());
+}
+#endif
+
+template <typename A, typename B>
+void Fixed_Point_Tests::double_words(A a, B b)
+{
+	test_header("double_words", a, b, "a", "b");
+
+#if defined(__SIZEOF_INT128__)
+	uint64_t seed = 67;
+	const auto random_word = [&seed]() { seed = seed * 6364136223846793005ULL + 1442695040888963407ULL; return seed; };
+
+	bool ok_words = true;
+	for (size_t i = 0; i < 4096; i++)
+	{
+		// operands of every size, with zeros and carries
+		const FP_numeric::int128_t x(random_word() >> (i % 3) * 32, random_word()), y = FP_numeric::int128_t(random_word(), random_word()) >> (i % 127);
+		const test_int128 xi = to_int128(x), yi = to_int128(y);
+		const size_t s = random_word() % 128;
+
+		ok_words &= to_int128(x + y) == xi + yi && to_int128(x - y) == xi - yi
+		         && to_int128(x * y) == (test_int128)((test_uint128)xi * yi)
+		         && to_int128(x << s) == (test_int128)((test_uint128)xi << s) && to_int128(x >> s) == xi >> s
+		         && (x < y) == (xi < yi) && (x == y) == (xi == yi) && (double)x == (double)xi && (float)y == (float)yi;
+		if (yi != 0)
+			ok_words &= to_int128(x / y) == xi / yi && to_int128(x % y) == xi % yi;
+	}
+	os << "\t"; test_check("int128_t +, -, *, /, %, <<, >>, <, == and floating point conversions == __int128", ok_words); os_nline;
+#endif
+
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+	using add_t = typename FP_numeric::add_res_type<A,B>::type;
+
+	// the base_type of 65 to 128 bits (__int128 with ENABLE_128_BITS, even with -std=c++1y) is an integer for the library
+	static_assert(FP_numeric::is_integral<typename mul_t::base_type>::value
+	           && FP_numeric::is_signed  <typename mul_t::base_type>::value, "the base_type must be a signed integer");
+
+	std::vector<A> va(4093, a);
+	std::vector<B> vb(4093, b);
+	fill_random(va, 71);
+	fill_random(vb, 73);
+	va.push_back(A::max()), va.push_back(A::min());
+	vb.push_back(B::min()), vb.push_back(B::max());
+
+	// the operands hold in a double: the double product and sum are the correctly rounded exact results, as to_double
+	bool ok_ops = true, ok_comp = true, ok_req = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const double da = va[i].to_double(), db = vb[i].to_double();
+		const mul_t  p  = va[i] * vb[i];
+		const add_t  s  = va[i] + vb[i];
+
+		ok_ops  &= p.to_double() == da * db && s.to_double() == da + db && (s - vb[i]).to_double() == da;
+		ok_comp &= (p < s) == (da * db < da + db) && (p == va[i]) == (da * db == da);
+
+		// the product requantized in A is the rounded exact product (std::nearbyint rounds the ties to even) when the
+		// double product is exact (null residual)
+		A r; r.template change_data<FP_numeric::Rounding_type::ROUNDED_HALF_EVEN>(p);
+		const double ulp = std::ldexp(1.0, -(int)A::Fb);
+		ok_req &= r.to_double() == std::min(std::max(std::nearbyint(da * db / ulp) * ulp, A::min().to_double()), A::max().to_double())
+		       || std::fma(da, db, -(da * db)) != 0;
+
+		// the narrowing assignment is the requantization toward zero
+		const A h = va[i] * vb[i];
+		A z; z.template change_data<FP_numeric::Rounding_type::ROUNDED_TO_ZERO>(p);
+		ok_req &= h == z;
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification() << " in "
+	        << mul_t().display_quantification() << " (base_type of " << sizeof(typename mul_t::base_type) * 8 << " bits)";
+	os << "\t"; test_check("a * b, a + b and a + b - b == exact results" + sstream.str(), ok_ops ); os_nline;
+	os << "\t"; test_check("a * b < a + b and a * b == a == comparisons of the values" + sstream.str(), ok_comp); os_nline;
+	os << "\t"; test_check("a * b requantized in a == rounded product and a = a * b" + sstream.str(), ok_req ); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_to_chars(A a, B b)
+{
+	os << bold_orange("To chars tests *******************************"); os_nline;
+
+	to_chars(a, b);
+
+	static_assert(FP_numeric::chars_size<FP_S<16,8>>::value == 13 && FP_numeric::chars_size<FP_S<64,0>>::value == 22,
+	              "sign, integer digits, point and fractional digits");
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_from_chars(A a, B b)
+{
+	os << bold_orange("From chars tests *****************************"); os_nline;
+
+	from_chars(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_packed(A a, B b)
+{
+	os << bold_orange("Packed tests *********************************"); os_nline;
+
+	packed(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_file(A a, B b)
+{
+	os << bold_orange("File tests ***********************************"); os_nline;
+
+	file(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_span(A a, B b)
+{
+	os << bold_orange("Span tests ***********************************"); os_nline;
+
+	span(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::test_dynamic(A a, B b)
+{
+	os << bold_orange("Dynamic tests ********************************"); os_nline;
+
+	dynamic(a, b);
+
+	os_nline;
+	os << bold_orange("**********************************************"); os_nline; os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::multi_words(A a, B b)
+{
+	test_header("multi_words", a, b, "a", "b");
+
+	using int256_t = FP_numeric::multi_word<4, true>;
+
+	uint64_t seed = 79;
+	const auto random_word = [&seed]() { seed = seed * 6364136223846793005ULL + 1442695040888963407ULL; return seed; };
+
+	// the results modulo 2^128 are the ones of int128_t, the division is checked by its remainder
+	bool ok_words = true, ok_div = true;
+	for (size_t i = 0; i < 4096; i++)
+	{
+		const int256_t x = ((int256_t(random_word()) << 192) | (int256_t(random_word()) << 128) | FP_numeric::int128_t(random_word(), random_word())) >> (i % 251);
+		const int256_t y = ((int256_t(random_word()) << 192) | (int256_t(random_word()) << 128) | FP_numeric::int128_t(random_word(), random_word())) >> (random_word() % 254);
+		const FP_numeric::int128_t xl(x), yl(y);
+		const size_t s = random_word() % 128;
+
+		ok_words &= FP_numeric::int128_t(x + y) == xl + yl && FP_numeric::int128_t(x - y) == xl - yl && FP_numeric::int128_t(x * y) == xl * yl
+		         && FP_numeric::int128_t(x << s) == xl << s && (x + y) - y == x
+		         && (x < y) == ((double)x < (double)y || ((double)x == (double)y && (x - y).is_neg()))
+		         && (double)int256_t((double)x) == (double)x && (double)-x == -(double)x && (float)int256_t(yl) == (float)yl;
+
+		if (y)
+		{
+			const int256_t q = x / y, r = x % y;
+			ok_div &= q * y + r == x && (r < 0 ? -r : r) < (y < 0 ? -y : y) && (!r || (r < 0) == (x < 0));
+		}
+	}
+	os << "\t"; test_check("multi_word<4> +, -, *, <<, <, floating point conversions (low words == int128_t)", ok_words); os_nline;
+	os << "\t"; test_check("multi_word<4> x / y * y + x % y == x and |x % y| < |y|", ok_div); os_nline;
+
+	using mul_t = typename FP_numeric::mul_res_type<A,B>::type;
+	using sqr_t = typename FP_numeric::mul_res_type<mul_t,mul_t>::type;
+	using div_t = typename FP_numeric::div_res_type<A,B>::type;
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 83);
+	fill_random(vb, 89);
+	va.push_back(A::max()), va.push_back(A::min());
+	vb.push_back(B::min()), vb.push_back(B::max());
+
+	// the products and quotients of more than 128 bits are exact: (a * b) / b == a and (p * p) / p == p, the quotient
+	// a / b is truncated toward zero (a remainder of the sign of a lower than one ulp of the quotient times b)
+	using sum_t = Fixed_Point_Static<sqr_t::Tb + 11, sqr_t::Fb>; // 2^11 squares at most
+
+	bool ok_chain = true, ok_quot = true;
+	sum_t sum_forward, sum_backward;
+	double sum_double = 0;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const size_t j = va.size() - 1 - i;
+		const mul_t  p = va[i] * vb[i], pj = va[j] * vb[j];
+		sum_forward  = sum_forward  + p * p;
+		sum_backward = sum_backward + pj * pj;
+		sum_double  += p.to_double() * p.to_double();
+
+		if (!vb[i] || !va[i])
+			continue;
+
+		const div_t q = va[i] / vb[i];
+		ok_chain &= ((p / vb[i]) == va[i]) && ((p * p) / p == p);
+
+		const double r = (va[i] - q * vb[i]).to_double();
+		ok_quot &= (r == 0 || (r < 0) == (va[i].to_double() < 0))
+		        && std::abs(r) < std::abs(vb[i].to_double()) * std::ldexp(1.0, -(int)div_t::Fb);
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+	os << "\t"; test_check("(a * b) / b == a and (a * b)^2 / (a * b) == a * b in " + mul_t().display_quantification() + ", "
+	                       + sqr_t().display_quantification() + sstream.str(), ok_chain); os_nline;
+	os << "\t"; test_check("a / b in " + div_t().display_quantification() + " truncated toward zero" + sstream.str(), ok_quot); os_nline;
+	os << "\t"; test_check("sum of the (a * b)^2 exact (in any order)" + sstream.str(),
+	                       sum_forward == sum_backward && std::abs(sum_forward.to_double() - sum_double) <= 1e-12 * sum_double); os_nline;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::to_chars(A a, B b)
+{
+	test_header("to_chars", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 97);
+	fill_random(vb, 101);
+	va.push_back(A::max()), va.push_back(A::min()), va.push_back(A());
+	vb.push_back(B::max()), vb.push_back(B::min()), vb.push_back(B());
+
+	bool ok_a = true, ok_b = true;
+	for (const A& x : va)
+		ok_a &= to_chars_check(x);
+	for (const B& x : vb)
+		ok_b &= to_chars_check(x);
+
+	// a buffer one char too small is not written out of its bounds
+	char buffer[FP_numeric::chars_size<A>::value + 8] = {};
+	const FP_numeric::to_chars_result res = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), a, 3);
+	const size_t length = res.ptr - buffer;
+	const FP_numeric::to_chars_result small = FP_numeric::to_chars(buffer, buffer + length - 1, a, 3);
+
+	std::stringstream sstream, stream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+	stream << std::setprecision(3) << a;
+
+	char buffer_b[FP_numeric::chars_size<B>::value + 6];
+	const std::string string_b(buffer_b, FP_numeric::to_chars(std::begin(buffer_b), std::end(buffer_b), b, 6).ptr);
+
+	os << "\t"; test_check("exact expansion and rounded digits (0 to F + 2) of a" + a.display_quantification(), ok_a); os_nline;
+	os << "\t"; test_check("exact expansion and rounded digits (0 to F + 2) of b" + b.display_quantification(), ok_b); os_nline;
+	os << "\t"; test_check("too small buffer == errc::value_too_large" + sstream.str(),
+	                       small.ec == std::errc::value_too_large && small.ptr == buffer + length - 1); os_nline;
+	os << "\t"; test_check("operator<< and std::to_string == to_chars" + sstream.str(),
+	                       stream.str() == std::string(buffer, length) + a.display_quantification()
+	                       && std::to_string(b) == string_b); os_nline;
+}
+
+template <typename FP>
+bool Fixed_Point_Tests::to_chars_check(const FP& x)
+{
+	char buffer[FP_numeric::chars_size<FP>::value + 4];
+
+	// the exact expansion of data * 2^-F is the one of data * 5^F with F fractional digits
+	using wide_t = FP_numeric::multi_word<(FP::Tb + FP::Fb*7/3 + 63)/64 + 2, true>;
+	wide_t m(x.get_data());
+	m = (m < 0) ? -m : m;
+	for (size_t i = 0; i < FP::Fb; i++)
+		m = m * wide_t(5);
+
+	std::string digits = FP_numeric::to_string(m);
+	digits = std::string(digits.size() <= FP::Fb ? FP::Fb + 1 - digits.size() : 0, '0') + digits;
+
+	std::string exact = (x.is_sneg() ? "-" : "") + digits.substr(0, digits.size() - FP::Fb);
+	std::string fract = digits.substr(digits.size() - FP::Fb);
+	fract.erase(fract.find_last_not_of('0') + 1);
+	if (!fract.empty())
+		exact += "." + fract;
+
+	bool ok = std::string(buffer, FP_numeric::to_chars(std::begin(buffer), std::end(buffer), x).ptr) == exact;
+
+	// printf rounds the exact decimal value of the long double to the nearest, the ties to even
+	if (FP::Tb <= std::numeric_limits<long double>::digits)
+	{
+		char expected[FP_numeric::chars_size<FP>::value + 4];
+		const long double value = std::ldexp((long double)x.get_data(), -(int)FP::Fb);
+
+		for (size_t p = 0; p <= FP::Fb + 2; p++)
+		{
+			const FP_numeric::to_chars_result res = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), x, p);
+			const int length = std::snprintf(expected, sizeof(expected), "%.*Lf", (int)p, value);
+			ok &= res.ec == std::errc() && std::string(buffer, res.ptr) == std::string(expected, length);
+		}
+	}
+
+	return ok;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::from_chars(A a, B b)
+{
+	test_header("from_chars", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 103);
+	fill_random(vb, 107);
+	va.push_back(A::max()), va.push_back(A::min()), va.push_back(A());
+	vb.push_back(B::max()), vb.push_back(B::min()), vb.push_back(B());
+
+	// the raw data below the symmetric min of the saturated types is not a value (it is parsed as min)
+	for (A& x : va)
+		x.set_data(std::max(x.get_data(), A::min().get_data()));
+	for (B& x : vb)
+		x.set_data(std::max(x.get_data(), B::min().get_data()));
+
+	bool ok_a = true, ok_b = true;
+	for (const A& x : va)
+		ok_a &= from_chars_check(x);
+	for (const B& x : vb)
+		ok_b &= from_chars_check(x);
+
+	// the hexadecimal digits are exact
+	A ha;
+	B hb;
+	const std::string hex_a = "0x1.8", hex_b = "-0x.4";
+	const bool ok_hex = FP_numeric::from_chars(hex_a.data(), hex_a.data() + hex_a.size(), ha).ptr == hex_a.data() + hex_a.size()
+	                 && FP_numeric::from_chars(hex_b.data(), hex_b.data() + hex_b.size(), hb).ptr == hex_b.data() + hex_b.size()
+	                 && ha == A(1.5f) && hb == B(-0.25f);
+
+	// the columns of a CSV and of a whitespace delimited text with blanks, empty lines and \r\n
+	char buffer_a[FP_numeric::chars_size<A>::value], buffer_b[FP_numeric::chars_size<B>::value];
+	std::string csv, blanks;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const std::string sa(buffer_a, FP_numeric::to_chars(std::begin(buffer_a), std::end(buffer_a), va[i]).ptr);
+		const std::string sb(buffer_b, FP_numeric::to_chars(std::begin(buffer_b), std::end(buffer_b), vb[i]).ptr);
+		csv    += sa + ", " + sb + ((i % 3 == 0) ? "\r\n" : "\n") + ((i % 5 == 0) ? "\n" : "");
+		blanks += "  " + sb + "\t " + sa + "\n";
+	}
+
+	std::vector<A> ra(va.size()), rb_a(va.size());
+	std::vector<B> rb(vb.size()), ra_b(vb.size());
+	const size_t n_a = FP_numeric::read_column(csv.data(), csv.data() + csv.size(), ra.data(), ra.size(), 0);
+	const size_t n_b = FP_numeric::read_column(csv.data(), csv.data() + csv.size(), rb.data(), rb.size(), 1);
+	const size_t m_a = FP_numeric::read_column(blanks.data(), blanks.data() + blanks.size(), rb_a.data(), rb_a.size(), 1, ' ');
+	const size_t m_b = FP_numeric::read_column(blanks.data(), blanks.data() + blanks.size(), ra_b.data(), ra_b.size(), 0, ' ');
+
+	bool ok_column = n_a == va.size() && n_b == vb.size() && m_a == va.size() && m_b == vb.size();
+	for (size_t i = 0; i < va.size(); i++)
+		ok_column &= ra[i] == va[i] && rb[i] == vb[i] && rb_a[i] == va[i] && ra_b[i] == vb[i];
+
+	bool ok_throw = false;
+	const std::string header = "a, b\n" + csv;
+	try
+	{
+		FP_numeric::read_column(header.data(), header.data() + header.size(), ra.data(), ra.size(), 1);
+	}
+	catch (const std::invalid_argument&)
+	{
+		ok_throw = true;
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+
+	os << "\t"; test_check("exact, ties, rounded and out of range writings of a" + a.display_quantification(), ok_a); os_nline;
+	os << "\t"; test_check("exact, ties, rounded and out of range writings of b" + b.display_quantification(), ok_b); os_nline;
+	os << "\t"; test_check("hexadecimal writings" + sstream.str(), ok_hex); os_nline;
+	os << "\t"; test_check("read_column of a CSV and of a whitespace delimited text" + sstream.str(), ok_column); os_nline;
+	os << "\t"; test_check("read_column throws std::invalid_argument on a header" + sstream.str(), ok_throw); os_nline;
+}
+
+template <typename FP>
+bool Fixed_Point_Tests::from_chars_check(const FP& x)
+{
+	using R      = FP_numeric::Rounding_type;
+	using half_t = Fixed_Point_Static<FP::Tb + 1, FP::Fb + 1, FP::Ab>;
+	using wide_t = FP_numeric::multi_word<(FP::Tb + FP::Fb*13/3 + 73)/64 + 2, true>;
+
+	char buffer[FP_numeric::chars_size<half_t>::value + 16];
+	const auto parse = [](const char* first, const char* last, FP& y) { return FP_numeric::from_chars<R::ROUNDED_HALF_EVEN>(first, last, y); };
+
+	// the exact writing is read back whatever the rounding
+	FP y0, y1, y2, y3;
+	const char* end = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), x).ptr;
+	bool ok = FP_numeric::from_chars<R::TRUNCATED>(buffer, end, y0).ptr == end && FP_numeric::from_chars<R::ROUNDED_HALF_UP>(buffer, end, y1).ec == std::errc()
+	       && FP_numeric::from_chars<R::ROUNDED_HALF_EVEN>(buffer, end, y2).ec == std::errc() && FP_numeric::from_chars<R::ROUNDED_TO_ZERO>(buffer, end, y3).ec == std::errc()
+	       && y0 == x && y1 == x && y2 == x && y3 == x;
+
+	// the tie (2 * data + 1) * 2^-(F+1) is rounded as its signed value: floor, floor(x + 1/2), to even, toward zero
+	if (x != FP::max())
+	{
+		half_t tie;
+		tie.set_data((typename half_t::base_type(x.get_data()) << 1) + 1);
+		end = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), tie).ptr;
+
+		FP_numeric::from_chars<R::TRUNCATED>        (buffer, end, y0);
+		FP_numeric::from_chars<R::ROUNDED_HALF_UP>  (buffer, end, y1);
+		FP_numeric::from_chars<R::ROUNDED_HALF_EVEN>(buffer, end, y2);
+		FP_numeric::from_chars<R::ROUNDED_TO_ZERO>  (buffer, end, y3);
+
+		const typename FP::base_type data = x.get_data(), next = data + 1;
+		ok &= y0.get_data() == data && y1.get_data() == next && y2.get_data() == ((data & 1) ? next : data)
+		   && y3.get_data() == (x.is_sneg() ? next : data);
+	}
+
+	// the writings rounded at p digits are rounded to the nearest even of data * 2^F / 10^p (with the sticky digits)
+	for (size_t p = 0; p <= FP::Fb + 2; p += 1 + FP::Fb / 16)
+	{
+		end = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), x, p).ptr;
+
+		wide_t digits = 0, scale = 1;
+		for (const char* c = buffer; c != end; c++)
+			if (*c >= '0' && *c <= '9')
+				digits = digits * wide_t(10) + wide_t(*c - '0');
+		for (size_t i = 0; i < p; i++)
+			scale = scale * wide_t(10);
+
+		const wide_t n = digits << FP::Fb, q = n / scale, r2 = (n % scale) << 1;
+		const wide_t rounded = (r2 > scale || (r2 == scale && (q & wide_t(1)) != wide_t(0))) ? q + wide_t(1) : q;
+
+		const FP_numeric::from_chars_result res = parse(buffer, end, y2);
+		const wide_t expected = x.is_sneg() ? -rounded : rounded;
+		ok &= res.ptr == end && (res.ec == std::errc() ? wide_t(y2.get_data()) == expected
+		                                               : (y2 == FP::max() || y2 == FP::min()));
+	}
+
+	// out of range (a 9 before the integer digits of max and min)
+	const std::string above = "9" + std::string(buffer, FP_numeric::to_chars(std::begin(buffer), std::end(buffer), FP::max()).ptr);
+	const FP_numeric::from_chars_result res = parse(above.data(), above.data() + above.size(), y0);
+	ok &= res.ec == std::errc::result_out_of_range && y0 == FP::max();
+	if (FP::min().is_sneg())
+	{
+		const std::string below = "-9" + std::string(buffer + 1, FP_numeric::to_chars(std::begin(buffer), std::end(buffer), FP::min()).ptr);
+		ok &= parse(below.data(), below.data() + below.size(), y1).ec == std::errc::result_out_of_range && y1 == FP::min();
+	}
+
+	return ok;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::packed(A a, B b)
+{
+	test_header("packed", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 109);
+	fill_random(vb, 113);
+	va.push_back(A::max()), va.push_back(A::min()), va.push_back(A());
+	vb.push_back(B::max()), vb.push_back(B::min()), vb.push_back(B());
+
+	std::stringstream sstream_a, sstream_b;
+	sstream_a << " of a" << a.display_quantification() << " on " << A::Tb << " bits";
+	sstream_b << " of b" << b.display_quantification() << " on " << B::Tb << " bits";
+
+	os << "\t"; test_check("pack_n and unpack_n" + sstream_a.str(), packed_check(va, false)); os_nline;
+	os << "\t"; test_check("pack_n and unpack_n" + sstream_b.str(), packed_check(vb, false)); os_nline;
+	os << "\t"; test_check("get, set and push_back" + sstream_a.str(), packed_check(va, true)); os_nline;
+	os << "\t"; test_check("get, set and push_back" + sstream_b.str(), packed_check(vb, true)); os_nline;
+}
+
+template <typename FP>
+bool Fixed_Point_Tests::packed_check(std::vector<FP> v, bool access)
+{
+	using packed_t = FP_numeric::FP_packed<FP::Tb, FP::Fb, FP::Ab>;
+
+	// the values of FP only (the raw data below the symmetric min of the saturated types is not a value)
+	for (FP& x : v)
+		x.set_data(std::max(x.get_data(), FP::min().get_data()));
+
+	const size_t n = v.size();
+	packed_t p(v.data(), n);
+	std::vector<FP> r(n);
+
+	bool ok = p.size() == n && p.bytes() == (n * FP::Tb + 7) / 8;
+
+	if (!access)
+	{
+		// all the values, then the ranges from any offset (before and after the groups of the vector kernels)
+		ok &= p.unpack(0, n, r.data()) == r.data() + n && r == v;
+		for (size_t first : {1, 3, 7, 8, 13, 64, 129})
+		{
+			std::vector<FP> s(n - first);
+			p.unpack(first, s.size(), s.data());
+			ok &= std::equal(s.begin(), s.end(), v.begin() + first);
+		}
+
+		// a range packed from any offset keeps the values around it
+		for (size_t first : {0, 5, 9, 64, 200})
+		{
+			packed_t q(v.data(), n);
+			std::vector<FP> w(v.rbegin(), v.rbegin() + 300);
+			q.pack(first, w.data(), w.size());
+			q.unpack(0, n, r.data());
+			ok &= std::equal(w.begin(), w.end(), r.begin() + first)
+			   && std::equal(v.begin(), v.begin() + first, r.begin())
+			   && std::equal(v.begin() + first + w.size(), v.end(), r.begin() + first + w.size());
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < n; i++)
+			ok &= p.get(i) == v[i] && p[i] == v[i];
+
+		// the values set in any order, and the values appended one by one
+		packed_t q(n), e;
+		for (size_t i = 0; i < n; i++)
+			q.set((i * 7919) % n, v[(i * 7919) % n]);
+		for (const FP& x : v)
+			e.push_back(x);
+		q.unpack(0, n, r.data());
+		ok &= r == v && e.size() == n && std::equal(e.data(), e.data() + FP_numeric::packed_words(n, FP::Tb), p.data());
+
+		// the values removed by resize are zeros when they come back
+		e.resize(n / 2);
+		e.resize(n);
+		for (size_t i = 0; i < n; i++)
+			ok &= e[i] == ((i < n / 2) ? v[i] : FP());
+	}
+
+	return ok;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::file(A a, B b)
+{
+	test_header("file", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 127);
+	fill_random(vb, 131);
+
+	// a column of one quantification is not mapped as another one
+	bool ok_refused = false;
+	FP_numeric::write_file("Fixed_Point_Tests_a.fpc", va.data(), va.size());
+	try
+	{
+		FP_numeric::FP_mapped<B::Tb, B::Fb, B::Ab> m("Fixed_Point_Tests_a.fpc");
+	}
+	catch (const std::runtime_error&)
+	{
+		ok_refused = FP_numeric::file_header("Fixed_Point_Tests_a.fpc").display_quantification() == a.display_quantification();
+	}
+	std::remove("Fixed_Point_Tests_a.fpc");
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+
+	os << "\t"; test_check("write_file, FP_file_writer and FP_mapped of a" + a.display_quantification(), file_check(va, "Fixed_Point_Tests_a.fpc")); os_nline;
+	os << "\t"; test_check("write_file, FP_file_writer and FP_mapped of b" + b.display_quantification(), file_check(vb, "Fixed_Point_Tests_b.fpc")); os_nline;
+	os << "\t"; test_check("FP_mapped refuses another quantification" + sstream.str(), ok_refused); os_nline;
+}
+
+template <typename FP>
+bool Fixed_Point_Tests::file_check(const std::vector<FP>& v, const std::string& path)
+{
+	using mapped_t = FP_numeric::FP_mapped<FP::Tb, FP::Fb, FP::Ab>;
+
+	bool ok = true;
+
+	// all the values at once, then by blocks and one by one
+	FP_numeric::write_file(path, v.data(), v.size());
+	{
+		const mapped_t m(path);
+		ok &= m.size() == v.size() && std::equal(m.begin(), m.end(), v.begin()) && m.header().template holds<FP>()
+		   && reinterpret_cast<uintptr_t>(m.data()) % 64 == 0 && m.at(v.size() - 1) == v.back();
+	}
+	{
+		FP_numeric::FP_file_writer<FP::Tb, FP::Fb, FP::Ab> writer(path);
+		writer.append(v.data(), 500);
+		for (size_t i = 500; i < v.size(); i++)
+			writer.append(v[i]);
+		ok &= writer.size() == v.size();
+	}
+	mapped_t m(path), moved(std::move(m));
+	ok &= m.empty() && moved.size() == v.size() && std::equal(moved.begin(), moved.end(), v.begin())
+	   && FP_numeric::file_header(path).count == v.size();
+
+	// an empty column, then a truncated one
+	FP_numeric::write_file(path, v.data(), 0);
+	ok &= mapped_t(path).empty();
+
+	bool ok_truncated = false;
+	FP_numeric::write_file(path, v.data(), v.size());
+	std::vector<char> bytes(sizeof(FP_numeric::column_header) + (v.size() - 1) * sizeof(FP));
+	std::FILE* file = std::fopen(path.c_str(), "rb");
+	ok &= file != nullptr && std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size();
+	std::fclose(file);
+	file = std::fopen(path.c_str(), "wb");
+	ok &= file != nullptr && std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+	std::fclose(file);
+	try
+	{
+		mapped_t t(path);
+	}
+	catch (const std::runtime_error&)
+	{
+		ok_truncated = true;
+	}
+	std::remove(path.c_str());
+
+	return ok && ok_truncated;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::span(A a, B b)
+{
+	test_header("span", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 137);
+	fill_random(vb, 139);
+
+	// the batch kernels on the views of the raw words
+	using add_t = typename FP_numeric::add_res_type_d<A::Tb, A::Fb, B::Tb, B::Fb>::type;
+	std::vector<typename A::base_type> wa(va.size());
+	std::vector<typename B::base_type> wb(vb.size());
+	for (size_t i = 0; i < va.size(); i++)
+		wa[i] = va[i].get_data(), wb[i] = vb[i].get_data();
+
+	const FP_numeric::FP_cspan<A::Tb, A::Fb> sa(wa.data(), wa.size());
+	const FP_numeric::FP_cspan<B::Tb, B::Fb> sb(wb.data(), wb.size());
+	std::vector<add_t> res(va.size()), ref(va.size());
+	FP_numeric::add_n(sa.data(), sb.data(), sa.size(), res.data());
+	FP_numeric::add_n(va.data(), vb.data(), va.size(), ref.data());
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+
+	os << "\t"; test_check("views, sub views and copies of a" + a.display_quantification(), span_check(va)); os_nline;
+	os << "\t"; test_check("views, sub views and copies of b" + b.display_quantification(), span_check(vb)); os_nline;
+	os << "\t"; test_check("add_n on the views" + sstream.str(), res == ref); os_nline;
+}
+
+template <typename FP>
+bool Fixed_Point_Tests::span_check(const std::vector<FP>& v)
+{
+	using B = typename FP::base_type;
+
+	// the raw words of the values, then the same words with garbage on their unused bits
+	std::vector<B> words(v.size()), garbage(v.size());
+	for (size_t i = 0; i < v.size(); i++)
+	{
+		words[i]   = v[i].get_data();
+		garbage[i] = B(words[i] ^ ((FP::Tb < 64) ? (i * 0x9E3779B97F4A7C15ULL) << (FP::Tb % 64) : 0));
+	}
+
+	const FP_numeric::FP_span<FP::Tb, FP::Fb, FP::Ab> s(words.data(), words.size());
+	const FP_numeric::FP_cspan<FP::Tb, FP::Fb, FP::Ab> c = s;
+
+	bool ok = s.size() == v.size() && c.data() == s.data() && s.raw() == words.data() && s.canonical()
+	       && std::equal(s.begin(), s.end(), v.begin()) && s.front() == v.front() && s.back() == v.back()
+	       && std::equal(s.subspan(5, 100).begin(), s.subspan(5, 100).end(), v.begin() + 5)
+	       && std::equal(c.first(10).begin(), c.first(10).end(), v.begin())
+	       && c.last(10).data() == s.data() + v.size() - 10;
+
+	// a view writes in the words
+	s[3] = FP::max();
+	ok &= words[3] == FP::max().get_data();
+	s[3] = v[3];
+
+	// FP_numeric::copy from and into the views
+	std::vector<FP> copied(v.size());
+	std::vector<B> copied_words(v.size());
+	FP_numeric::copy(c.begin(), c.end(), copied.begin());
+	FP_numeric::copy(copied.begin(), copied.end(), FP_numeric::FP_span<FP::Tb, FP::Fb, FP::Ab>(copied_words.data(), v.size()).begin());
+	ok &= copied == v && copied_words == words;
+
+	bool ok_throw = false;
+	try
+	{
+		c.at(v.size());
+	}
+	catch (const std::out_of_range&)
+	{
+		ok_throw = true;
+	}
+
+	// the garbage words extended in place (the vector kernel then the scalar tail)
+	const FP_numeric::FP_span<FP::Tb, FP::Fb, FP::Ab> g(garbage.data(), garbage.size());
+	const bool dirty = FP::Tb < FP::capacity && !g.canonical();
+	g.sign_extend();
+
+	return ok && ok_throw && (dirty || FP::Tb == FP::capacity) && g.canonical() && garbage == words;
+}
+
+template <typename A, typename B>
+void Fixed_Point_Tests::dynamic(A a, B b)
+{
+	test_header("dynamic", a, b, "a", "b");
+
+	std::vector<A> va(1021, a);
+	std::vector<B> vb(1021, b);
+	fill_random(va, 149);
+	fill_random(vb, 151);
+
+	// the raw minimums out of the symmetric ranges are not given by the conversions of the floating points
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		va[i] = std::max(va[i], A::min());
+		vb[i] = std::max(vb[i], B::min());
+	}
+
+	using add_t = typename FP_numeric::add_res_type_d<A::Tb, A::Fb, B::Tb, B::Fb>::type;
+	using sub_t = typename FP_numeric::sub_res_type_d<A::Tb, A::Fb, B::Tb, B::Fb>::type;
+	using mul_t = typename FP_numeric::mul_res_type_d<A::Tb, A::Fb, B::Tb, B::Fb>::type;
+
+	// the same bits and the same quantification
+	auto same = [](const FP_D& d, auto s)
+	{
+		return d.get_data() == (FP_D::base_type)s.get_data() && d.get_total_bits() == s.Tb && d.get_fractional_bits() == s.Fb;
+	};
+
+	// the scalar operators
+	bool ok_scalar = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		const FP_D da(va[i].to_double(), A::Tb, A::Fb);
+		const FP_D db = vb[i];
+		B requantized;
+		requantized.change_data(va[i]);
+		FP_D dr = db;
+		dr.change_data(FP_D(va[i]));
+
+		ok_scalar &= same(da, va[i]) && same(da + db, va[i] + vb[i]) && same(da - db, va[i] - vb[i])
+		          && same(da * db, va[i] * vb[i]) && same(dr, requantized) && (da < db) == (va[i] < vb[i])
+		          && (da == db) == (va[i] == vb[i]) && da.to_double() == va[i].to_double();
+		if (!vb[i].is_zero())
+			ok_scalar &= same(da / db, va[i] / vb[i]);
+
+		// the postfix operators return the previous value
+		FP_D dx = da;
+		A    sx = va[i];
+		ok_scalar &= same(dx++, sx++) && same(dx, sx) && same(dx--, sx--) && same(dx, sx);
+	}
+
+	// the batch kernels
+	std::vector<double> fa(va.size()), fb(vb.size()), fda(va.size());
+	for (size_t i = 0; i < va.size(); i++)
+		fa[i] = va[i].to_double(), fb[i] = vb[i].to_double();
+
+	FP_numeric::FP_dynamic_array da(A::Tb, A::Fb), db(B::Tb, B::Fb), dr(1, 0), dq(B::Tb, B::Fb);
+	FP_numeric::convert_n(fa.data(), fa.size(), da);
+	FP_numeric::convert_n(fb.data(), fb.size(), db);
+	FP_numeric::convert_n(da, fda.data());
+	FP_numeric::requantize_n(da, dq);
+
+	std::vector<add_t> add_ref(va.size());
+	std::vector<sub_t> sub_ref(va.size());
+	std::vector<mul_t> mul_ref(va.size());
+	std::vector<B>     req_ref(va.size());
+	FP_numeric::add_n(va.data(), vb.data(), va.size(), add_ref.data());
+	FP_numeric::sub_n(va.data(), vb.data(), va.size(), sub_ref.data());
+	FP_numeric::mul_n(va.data(), vb.data(), va.size(), mul_ref.data());
+	FP_numeric::requantize_n(va.data(), va.size(), req_ref.data());
+
+	bool ok_convert = da.size() == va.size() && fda == fa;
+	bool ok_requantize = true;
+	for (size_t i = 0; i < va.size(); i++)
+	{
+		ok_convert    &= same(da[i], va[i]) && same(db[i], vb[i]);
+		ok_requantize &= same(dq[i], req_ref[i]);
+	}
+
+	// the huge, infinite and NaN doubles saturate (NaN gives 0) in the scalar and in the batch conversions
+	const double huge = std::numeric_limits<double>::max(), inf = std::numeric_limits<double>::infinity();
+	const std::vector<double> special     = {huge, -huge, 6e18, inf, -inf, std::numeric_limits<double>::quiet_NaN()};
+	const std::vector<A>      special_ref = {A::max(), A::min(), A::max(), A::max(), A::min(), A::zero()};
+	FP_numeric::FP_dynamic_array ds(A::Tb, A::Fb);
+	FP_numeric::convert_n(special.data(), special.size(), ds);
+	for (size_t i = 0; i < special.size(); i++)
+		ok_convert &= same(FP_D(special[i], A::Tb, A::Fb), special_ref[i]) && same(ds[i], special_ref[i]);
+
+	bool ok_add = true, ok_sub = true, ok_mul = true;
+	FP_numeric::add_n(da, db, dr);
+	for (size_t i = 0; i < va.size(); i++)
+		ok_add &= same(dr[i], add_ref[i]);
+	FP_numeric::sub_n(da, db, dr);
+	for (size_t i = 0; i < va.size(); i++)
+		ok_sub &= same(dr[i], sub_ref[i]);
+	FP_numeric::mul_n(da, db, dr);
+	for (size_t i = 0; i < va.size(); i++)
+		ok_mul &= same(dr[i], mul_ref[i]);
+
+	// the views on the words and the quantification errors
+	const FP_numeric::FP_cspan<A::Tb, A::Fb> view = static_cast<const FP_numeric::FP_dynamic_array&>(da).template view<A::Tb, A::Fb>();
+	const bool ok_view = std::equal(view.begin(), view.end(), va.begin());
+
+	bool ok_throw = false;
+	try
+	{
+		FP_D(a.to_float(), A::Tb, A::Tb);
+	}
+	catch (const std::invalid_argument&)
+	{
+		try
+		{
+			FP_numeric::FP_dynamic_array(64, 0, 1).view<64, 1>();
+		}
+		catch (const std::invalid_argument&)
+		{
+			ok_throw = true;
+		}
+	}
+
+	std::stringstream sstream;
+	sstream << " of a" << a.display_quantification() << " and b" << b.display_quantification();
+
+	os << "\t"; test_check("scalar operators" + sstream.str(), ok_scalar); os_nline;
+	os << "\t"; test_check("convert_n" + sstream.str(), ok_convert); os_nline;
+	os << "\t"; test_check("add_n" + sstream.str(), ok_add); os_nline;
+	os << "\t"; test_check("sub_n" + sstream.str(), ok_sub); os_nline;
+	os << "\t"; test_check("mul_n" + sstream.str(), ok_mul); os_nline;
+	os << "\t"; test_check("requantize_n of a" + a.display_quantification() + " in b" + b.display_quantification(), ok_requantize); os_nline;
+	os << "\t"; test_check("views of the words", ok_view); os_nline;
+	os << "\t"; test_check("invalid quantifications", ok_throw); os_nline;
+}
+
 #endif /* FIXED_POINT_TESTS_HXX_ */
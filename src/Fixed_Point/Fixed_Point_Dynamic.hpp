@@ -0,0 +1,251 @@
+#ifndef FIXED_POINT_DYNAMIC_HPP_
+#define FIXED_POINT_DYNAMIC_HPP_
+
+#include <stdexcept>
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Quantifications chosen at run time *********************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// total and fractional bits of a Fixed_Point_Dynamic
+	struct quantification
+	{
+		size_t total_bits;
+		size_t fractional_bits;
+	};
+
+	constexpr bool operator==(const quantification& lhs, const quantification& rhs);
+	constexpr bool operator!=(const quantification& lhs, const quantification& rhs);
+
+	// quantifications of the results of the operations on two signed saturated operands: the ones of add_res_type_d,
+	// sub_res_type_d, mul_res_type_d and div_res_type_d computed at run time
+	constexpr quantification add_res_quantification(const quantification& lhs, const quantification& rhs);
+	constexpr quantification sub_res_quantification(const quantification& lhs, const quantification& rhs);
+	constexpr quantification mul_res_quantification(const quantification& lhs, const quantification& rhs);
+	constexpr quantification div_res_quantification(const quantification& numerator, const quantification& denominator);
+}
+
+/// Fixed_Point_Dynamic class *****************************************************************************************
+// Fixed point number whose quantification (T total bits, F fractional bits) is given at run time, for the configurations
+// read from a file or a command line that would otherwise instantiate every Fixed_Point_Static<T,F> they may choose.
+// It behaves as a signed saturated FP_S<T,F> of up to 64 bits: its data is the same int64_t with its sign extended, and
+// the results of its operations take the quantifications of the Fixed_Point_Static results with the same bits.
+// The operations are straight-line integer code on the run time shifts (no dispatch on T and F). A result that would
+// need more than 64 bits throws std::domain_error.
+// Arrays of them are FP_numeric::FP_dynamic_array (Fixed_Point_Dynamic_array.hpp), whose kernels check the
+// quantification once per array then run the batch kernels of the Fixed_Point_Static for the common widths.
+class Fixed_Point_Dynamic
+{
+public:
+	using base_type = int64_t;
+
+	static const size_t max_total_bits = sizeof(base_type)*8;
+
+private: // the quantification
+	size_t __total_bits;
+	size_t __fractional_bits;
+
+private: // the data
+	base_type __data;
+
+public: // constructors
+	// zero on (1,0): a placeholder to be given a quantification by the assignment of another fixed point
+	Fixed_Point_Dynamic();
+
+	// the integral or floating point value saturated in the quantification (T, F), as the constructor of FP_S<T,F>
+	// throw std::invalid_argument if the quantification is not the one of a signed Fixed_Point_Static of up to 64 bits
+	template <typename type>
+	Fixed_Point_Dynamic(type value, size_t total_bits, size_t fractional_bits);
+
+	// the same value and the same quantification (an unsigned fixed point is promoted to one more bit)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	Fixed_Point_Dynamic(const Fixed_Point_Static<T,F,A>& o);
+
+	// raw data in the quantification q (its sign is extended from T bits, as set_data does)
+	static Fixed_Point_Dynamic from_raw(base_type data, const FP_numeric::quantification& q);
+
+public:
+	// return the given value val saturated in the quantification of this Fixed_Point_Dynamic
+	base_type saturate(base_type val) const;
+
+public: // relational operators (exact whatever the quantifications)
+	bool operator> (const Fixed_Point_Dynamic& o) const;
+	bool operator< (const Fixed_Point_Dynamic& o) const;
+	bool operator<=(const Fixed_Point_Dynamic& o) const;
+	bool operator>=(const Fixed_Point_Dynamic& o) const;
+	bool operator==(const Fixed_Point_Dynamic& o) const;
+	bool operator!=(const Fixed_Point_Dynamic& o) const;
+
+	// n is first saturated in the quantification of this fixed point, as the Fixed_Point_Static do
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator> (const type n) const;
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator< (const type n) const;
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator<=(const type n) const;
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator>=(const type n) const;
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator==(const type n) const;
+	template <typename type> typename std::enable_if<std::is_arithmetic<type>::value, bool>::type operator!=(const type n) const;
+
+	bool operator! ( ) const; // true if the this fixed point is null
+
+	// compare the quantification of this Fixed_Point_Dynamic with the given one
+	bool same_quantification(size_t total_bits, size_t fractional_bits) const;
+	bool same_quantification(const Fixed_Point_Dynamic& o             ) const;
+
+public: // basic math operators
+	const Fixed_Point_Dynamic& operator+ () const;
+	      Fixed_Point_Dynamic  operator- () const;
+
+	// the result is saturated in the quantification of this fixed point
+	Fixed_Point_Dynamic& operator++ (   );
+	Fixed_Point_Dynamic& operator-- (   );
+	Fixed_Point_Dynamic  operator++ (int); // return the previous value
+	Fixed_Point_Dynamic  operator-- (int);
+
+	// the result of the operation is saturated (and truncated toward zero) in the quantification of this fixed point
+	template <typename type> Fixed_Point_Dynamic& operator+= (const type n);
+	template <typename type> Fixed_Point_Dynamic& operator-= (const type n);
+	template <typename type> Fixed_Point_Dynamic& operator*= (const type n);
+	template <typename type> Fixed_Point_Dynamic& operator/= (const type n);
+
+public: // math functions
+	bool is_zero() const;
+	bool is_min () const;
+	bool is_max () const;
+
+	Fixed_Point_Dynamic abs () const;
+	int                 sign() const; // return 0 if positive else (-1)
+
+public: // conversion to common types
+	// same conversions than Fixed_Point_Static::convert
+	template <typename uintegral_t, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP>
+	typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
+	convert() const; // to unsigned integer
+
+	template <typename sintegral_t, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP>
+	typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
+	convert() const; // to signed integer
+
+	template <typename floating_t>
+	typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
+	convert() const; // to floating point number
+
+	// the value in the quantification of FP, as FP's operator= does (the dropped bits are rounded in function of R)
+	template <typename FP, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO>
+	FP to_static() const;
+
+	base_type to_raw   () const;
+	  int32_t to_int   () const;
+	  int64_t to_lint  () const;
+	    float to_float () const;
+	   double to_double() const;
+
+public: // basic getters
+	size_t    get_integer_bits   () const;
+	size_t    get_fractional_bits() const;
+	size_t    get_total_bits     () const;
+	base_type get_one            () const;
+	base_type get_max            () const;
+	base_type get_min            () const;
+	base_type get_data           () const;
+
+	FP_numeric::quantification  get_quantification () const;
+	FP_numeric::Arithmetic_type get_arithmetic_type() const;
+
+	// return min, max, one or zero values with the quantification of this fixed point
+	Fixed_Point_Dynamic min () const;
+	Fixed_Point_Dynamic max () const;
+	Fixed_Point_Dynamic one () const;
+	Fixed_Point_Dynamic zero() const;
+
+public: // setters
+	// the following operators change only the data value in function of the already set quantification
+	// (a Fixed_Point_Dynamic or a Fixed_Point_Static assigned to it gives it its quantification instead)
+	template <typename type>
+	typename std::enable_if <std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type&
+	operator=(const type& o);
+
+	// the following methods change only the data value with an original quantification in function of the already
+	// set quantification (as the change_data of the Fixed_Point_Static, toward zero by default)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO>
+	void change_data(base_type data, size_t data_total_bits, size_t data_fractional_bits);
+
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO>
+	void change_data(const Fixed_Point_Dynamic& o);
+
+	// set the given argument as new data without touching the quantification (its sign is extended from T bits)
+	void set_data(base_type data);
+
+public: // display methods
+	std::string display(int precision) const;
+
+	std::string display_quantification() const;
+};
+
+using FP_D = Fixed_Point_Dynamic;
+
+/// ********************************************************************************************************************
+/// Display and arithmetics ********************************************************************************************
+/// ********************************************************************************************************************
+
+// write the value with min(os.precision(), F) fractional digits (FP_numeric::to_chars, without floating point)
+std::ostream& operator<<(std::ostream& os, const Fixed_Point_Dynamic& f);
+
+namespace FP_numeric
+{
+	// same texts than the to_chars of the Fixed_Point_Static of the same quantification and value
+	to_chars_result to_chars(char* first, char* last, const Fixed_Point_Dynamic& x) noexcept;
+	to_chars_result to_chars(char* first, char* last, const Fixed_Point_Dynamic& x, const size_t precision) noexcept;
+
+	// add, sub, mul or div lhs and rhs
+	// return the result with the quantification of the Fixed_Point_Static result and the same bits
+	// throw std::domain_error if the result needs more than 64 bits (and on a division by zero)
+	Fixed_Point_Dynamic add(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+	Fixed_Point_Dynamic sub(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+	Fixed_Point_Dynamic mul(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+	Fixed_Point_Dynamic div(const Fixed_Point_Dynamic& numerator, const Fixed_Point_Dynamic& denominator);
+}
+
+Fixed_Point_Dynamic operator+ (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+Fixed_Point_Dynamic operator- (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+Fixed_Point_Dynamic operator* (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+Fixed_Point_Dynamic operator/ (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs);
+
+// the integral or floating point operand is first converted in the quantification of the fixed point one
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator+ (const Fixed_Point_Dynamic& lhs, const type rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator+ (const type lhs, const Fixed_Point_Dynamic& rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator- (const Fixed_Point_Dynamic& lhs, const type rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator- (const type lhs, const Fixed_Point_Dynamic& rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator* (const Fixed_Point_Dynamic& lhs, const type rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator* (const type lhs, const Fixed_Point_Dynamic& rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator/ (const Fixed_Point_Dynamic& lhs, const type rhs);
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator/ (const type lhs, const Fixed_Point_Dynamic& rhs);
+
+#include "Fixed_Point_Dynamic.hxx"
+
+#endif /* FIXED_POINT_DYNAMIC_HPP_ */
@@ -0,0 +1,698 @@
+#ifndef FIXED_POINT_DYNAMIC_HXX_
+#define FIXED_POINT_DYNAMIC_HXX_
+
+#include <utility>
+
+#include "Fixed_Point_Dynamic.hpp"
+
+/// ********************************************************************************************************************
+/// Quantifications chosen at run time *********************************************************************************
+/// ********************************************************************************************************************
+
+constexpr bool FP_numeric::operator==(const quantification& lhs, const quantification& rhs)
+{
+	return lhs.total_bits == rhs.total_bits && lhs.fractional_bits == rhs.fractional_bits;
+}
+
+constexpr bool FP_numeric::operator!=(const quantification& lhs, const quantification& rhs)
+{
+	return !(lhs == rhs);
+}
+
+constexpr FP_numeric::quantification FP_numeric::add_res_quantification(const quantification& lhs, const quantification& rhs)
+{
+	// as add_res_type_d: the largest integral part and the largest fractional part, plus one bit for the carry
+	return (lhs.total_bits - lhs.fractional_bits >= rhs.total_bits - rhs.fractional_bits)
+	     ? ((lhs.fractional_bits >= rhs.fractional_bits)
+	       ? quantification{lhs.total_bits + 1,                                          lhs.fractional_bits}
+	       : quantification{lhs.total_bits - lhs.fractional_bits + rhs.fractional_bits + 1, rhs.fractional_bits})
+	     : ((lhs.fractional_bits >= rhs.fractional_bits)
+	       ? quantification{rhs.total_bits - rhs.fractional_bits + lhs.fractional_bits + 1, lhs.fractional_bits}
+	       : quantification{rhs.total_bits + 1,                                          rhs.fractional_bits});
+}
+
+constexpr FP_numeric::quantification FP_numeric::sub_res_quantification(const quantification& lhs, const quantification& rhs)
+{
+	return FP_numeric::add_res_quantification(lhs, rhs);
+}
+
+constexpr FP_numeric::quantification FP_numeric::mul_res_quantification(const quantification& lhs, const quantification& rhs)
+{
+	return quantification{lhs.total_bits + rhs.total_bits - 1, lhs.fractional_bits + rhs.fractional_bits};
+}
+
+constexpr FP_numeric::quantification FP_numeric::div_res_quantification(const quantification& numerator,
+                                                                          const quantification& denominator)
+{
+	return quantification{numerator.total_bits + denominator.total_bits + 1,
+	                      numerator.fractional_bits + denominator.total_bits - denominator.fractional_bits};
+}
+
+/// ********************************************************************************************************************
+/// Run time shifts and saturations (not part of the API) **************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __dynamic
+{
+	using base_type = Fixed_Point_Dynamic::base_type;
+
+	// throw std::invalid_argument if (T, F) is not the quantification of a signed Fixed_Point_Static of up to 64 bits
+	inline void check(const size_t total_bits, const size_t fractional_bits)
+	{
+		if (total_bits == 0)
+			throw std::invalid_argument("Error in Fixed_Point_Dynamic : T == 0!");
+		if (total_bits > Fixed_Point_Dynamic::max_total_bits)
+			throw std::invalid_argument("Error in Fixed_Point_Dynamic : T > 64!");
+		if (total_bits <= fractional_bits)
+			throw std::invalid_argument("Error in Fixed_Point_Dynamic : T <= F!");
+	}
+
+	// throw std::domain_error if the result of op needs more than 64 bits, else return its quantification
+	inline quantification result(const quantification q, const char* op)
+	{
+		if (q.total_bits > Fixed_Point_Dynamic::max_total_bits)
+			throw std::domain_error(std::string("Error in FP_numeric::") + op + " : the result needs "
+			                        + std::to_string(q.total_bits) + " bits!");
+		return q;
+	}
+
+	// value of max() on T bits (the signed range is symmetric: min() is -max())
+	inline base_type max_of(const size_t total_bits)
+	{
+		return base_type(FP_numeric::low_mask<uint64_t>(total_bits - 1));
+	}
+
+	// true if data << s does not hold in base_type (its s+1 most significant bits are not all its sign)
+	inline bool overflows(const base_type data, const size_t s)
+	{
+		return data != 0 && s > 0 && (s >= 63 || (data >> (63 - s)) != (data >> 63));
+	}
+
+	// the temporary val (of the type of the Fixed_Point_Static conversions) saturated in [-max, max]
+	template <typename temp_type>
+	inline base_type clamp(const temp_type val, const base_type max)
+	{
+		return base_type(FP_numeric::saturate<FP_numeric::Arithmetic_type::SIGNED_SATURATED>(val, temp_type(-max), temp_type(max)));
+	}
+
+	// data with fractional_bits fractional bits moved to the quantification q and saturated, as change_data does
+	// (a left shift that does not hold in 64 bits is saturated instead of being computed on a wider temporary)
+	template <FP_numeric::Rounding_type R>
+	inline base_type requantize(const base_type data, const size_t fractional_bits, const quantification q)
+	{
+		const base_type max = max_of(q.total_bits);
+
+		if (q.fractional_bits > fractional_bits && overflows(data, q.fractional_bits - fractional_bits))
+			return (data < 0) ? -max : max;
+
+		return clamp(FP_numeric::shift_fract<R>(data, q.fractional_bits, fractional_bits), max);
+	}
+
+	// the floating point x rounded and saturated in the quantification q, with the temporaries of change_data
+	template <FP_numeric::Rounding_type R, typename floating_t>
+	inline base_type from_float(const floating_t x, const quantification q)
+	{
+		using temp_type = typename FP_numeric::next_type<floating_t>::type;
+		using wide_type = typename FP_numeric::matching_type<Fixed_Point_Dynamic::max_total_bits + 2>::type;
+
+		const floating_t scaled = x * FP_numeric::exp2i<floating_t>(q.fractional_bits);
+
+		// 2*x on T+2 bits does not hold in the built-in temporary
+		return (q.total_bits + 2 > 64) ? clamp(FP_numeric::round_float<R, wide_type>(scaled), max_of(q.total_bits))
+		                               : clamp(FP_numeric::round_float<R, temp_type>(scaled), max_of(q.total_bits));
+	}
+
+	// the integer o shifted of F bits and saturated in the quantification q, with the temporary of operator=
+	template <typename integral_t>
+	inline base_type from_value(const integral_t o, const quantification q, std::false_type)
+	{
+		using temp_type = typename FP_numeric::next_type<integral_t>::type;
+
+		return clamp(FP_numeric::shift_fract((temp_type)o, q.fractional_bits, 0), max_of(q.total_bits));
+	}
+
+	// the floating point x rounded to the nearest (the ties toward plus infinity) as operator= does
+	template <typename floating_t>
+	inline base_type from_value(const floating_t x, const quantification q, std::true_type)
+	{
+		return from_float<FP_numeric::Rounding_type::ROUNDED_HALF_UP>(x, q);
+	}
+
+	// -1, 0 or 1 as the exact value of a (on fa fractional bits) is lower, equal or greater than the one of b (on fb)
+	inline int compare(const base_type a, const size_t fa, const base_type b, const size_t fb)
+	{
+		if (fa < fb)
+			return -compare(b, fb, a, fa);
+
+		// b is aligned on the fa fractional bits of a: if it does not hold in 64 bits, its magnitude is above any a
+		if (overflows(b, fa - fb))
+			return (b < 0) ? 1 : -1;
+
+		const base_type c = FP_numeric::shift_fract(b, fa, fb);
+		return (a > c) - (a < c);
+	}
+
+	// write the decimal expansion of the raw data with F fractional bits, by the to_chars of FP_S<64,F>
+	using chars_writer = to_chars_result (*)(char*, char*, base_type, size_t, bool);
+
+	template <size_t F>
+	inline to_chars_result write_chars(char* first, char* last, const base_type data, const size_t precision,
+	                                   const bool exact) noexcept
+	{
+		Fixed_Point_Static<Fixed_Point_Dynamic::max_total_bits, F> x;
+		x.set_data(data);
+		return FP_numeric::__chars::write(first, last, x, precision, exact);
+	}
+
+	// table of the writers of the F from 0 to 63, built once
+	template <size_t... F>
+	inline chars_writer chars_writer_of(const size_t fractional_bits, std::index_sequence<F...>) noexcept
+	{
+		static const chars_writer writers[] = { &write_chars<F>... };
+		return writers[fractional_bits];
+	}
+
+	inline chars_writer chars_writer_of(const size_t fractional_bits) noexcept
+	{
+		return chars_writer_of(fractional_bits, std::make_index_sequence<Fixed_Point_Dynamic::max_total_bits>());
+	}
+}
+}
+
+/// ********************************************************************************************************************
+/// Fixed_Point_Dynamic class ******************************************************************************************
+/// ********************************************************************************************************************
+
+inline Fixed_Point_Dynamic::Fixed_Point_Dynamic() : __total_bits(1), __fractional_bits(0), __data(0)
+{
+}
+
+template <typename type>
+Fixed_Point_Dynamic::Fixed_Point_Dynamic(type value, size_t total_bits, size_t fractional_bits)
+	: __total_bits(total_bits), __fractional_bits(fractional_bits), __data(0)
+{
+	static_assert(std::is_arithmetic<type>::value, "Error in Fixed_Point_Dynamic : the value is not an integral or a floating point!");
+
+	FP_numeric::__dynamic::check(total_bits, fractional_bits);
+	*this = value;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+Fixed_Point_Dynamic::Fixed_Point_Dynamic(const Fixed_Point_Static<T,F,A>& o)
+	: __total_bits(FP_numeric::promoted_bits<T, A, true>::value), __fractional_bits(F), __data(base_type(o.get_data()))
+{
+	static_assert(FP_numeric::promoted_bits<T, A, true>::value <= max_total_bits, "Error in Fixed_Point_Dynamic : T > 64!");
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::from_raw(base_type data, const FP_numeric::quantification& q)
+{
+	FP_numeric::__dynamic::check(q.total_bits, q.fractional_bits);
+
+	Fixed_Point_Dynamic x;
+	x.__total_bits      = q.total_bits;
+	x.__fractional_bits = q.fractional_bits;
+	x.set_data(data);
+	return x;
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::saturate(base_type val) const
+{
+	return FP_numeric::__dynamic::clamp(val, get_max());
+}
+
+inline bool Fixed_Point_Dynamic::operator> (const Fixed_Point_Dynamic& o) const
+{
+	return FP_numeric::__dynamic::compare(__data, __fractional_bits, o.__data, o.__fractional_bits) > 0;
+}
+
+inline bool Fixed_Point_Dynamic::operator< (const Fixed_Point_Dynamic& o) const
+{
+	return o > *this;
+}
+
+inline bool Fixed_Point_Dynamic::operator<=(const Fixed_Point_Dynamic& o) const
+{
+	return !(*this > o);
+}
+
+inline bool Fixed_Point_Dynamic::operator>=(const Fixed_Point_Dynamic& o) const
+{
+	return !(*this < o);
+}
+
+inline bool Fixed_Point_Dynamic::operator==(const Fixed_Point_Dynamic& o) const
+{
+	return FP_numeric::__dynamic::compare(__data, __fractional_bits, o.__data, o.__fractional_bits) == 0;
+}
+
+inline bool Fixed_Point_Dynamic::operator!=(const Fixed_Point_Dynamic& o) const
+{
+	return !(*this == o);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator> (const type n) const
+{
+	return *this >  Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator< (const type n) const
+{
+	return *this <  Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator<=(const type n) const
+{
+	return *this <= Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator>=(const type n) const
+{
+	return *this >= Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator==(const type n) const
+{
+	return *this == Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, bool>::type Fixed_Point_Dynamic::operator!=(const type n) const
+{
+	return *this != Fixed_Point_Dynamic(n, __total_bits, __fractional_bits);
+}
+
+inline bool Fixed_Point_Dynamic::operator! ( ) const
+{
+	return __data == 0;
+}
+
+inline bool Fixed_Point_Dynamic::same_quantification(size_t total_bits, size_t fractional_bits) const
+{
+	return __total_bits == total_bits && __fractional_bits == fractional_bits;
+}
+
+inline bool Fixed_Point_Dynamic::same_quantification(const Fixed_Point_Dynamic& o) const
+{
+	return same_quantification(o.__total_bits, o.__fractional_bits);
+}
+
+inline const Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator+ () const
+{
+	return *this;
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::operator- () const
+{
+	Fixed_Point_Dynamic t(*this);
+	t.__data = -t.__data; // the range is symmetric
+	return t;
+}
+
+inline Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator++ (   )
+{
+	*this += one(); return *this;
+}
+
+inline Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator-- (   )
+{
+	*this -= one(); return *this;
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::operator++ (int)
+{
+	const Fixed_Point_Dynamic old = *this;
+	*this += one();
+	return old;
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::operator-- (int)
+{
+	const Fixed_Point_Dynamic old = *this;
+	*this -= one();
+	return old;
+}
+
+template <typename type>
+Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator+= (const type n)
+{
+	change_data((*this)+n); return *this;
+}
+
+template <typename type>
+Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator-= (const type n)
+{
+	change_data((*this)-n); return *this;
+}
+
+template <typename type>
+Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator*= (const type n)
+{
+	change_data((*this)*n); return *this;
+}
+
+template <typename type>
+Fixed_Point_Dynamic& Fixed_Point_Dynamic::operator/= (const type n)
+{
+	change_data((*this)/n); return *this;
+}
+
+inline bool Fixed_Point_Dynamic::is_zero() const
+{
+	return __data == 0;
+}
+
+inline bool Fixed_Point_Dynamic::is_min () const
+{
+	return __data == get_min();
+}
+
+inline bool Fixed_Point_Dynamic::is_max () const
+{
+	return __data == get_max();
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::abs () const
+{
+	return (__data < 0) ? -(*this) : *this;
+}
+
+inline int Fixed_Point_Dynamic::sign() const
+{
+	return (__data < 0) ? -1 : 0;
+}
+
+template <typename uintegral_t, FP_numeric::Rounding_type R>
+typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
+Fixed_Point_Dynamic::convert() const // to unsigned integer
+{
+	// the integer part is read as its unsigned T-F bits (its sign bit included) as Fixed_Point_Static::convert does
+	const base_type temp = FP_numeric::shift_fract<R>(__data, 0, __fractional_bits)
+	                     & FP_numeric::low_mask<base_type>(__total_bits - __fractional_bits);
+
+	return FP_numeric::saturate_cast<uintegral_t>(temp);
+}
+
+template <typename sintegral_t, FP_numeric::Rounding_type R>
+typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
+Fixed_Point_Dynamic::convert() const // to signed integer
+{
+	return FP_numeric::saturate_cast<sintegral_t>(FP_numeric::shift_fract<R>(__data, 0, __fractional_bits));
+}
+
+template <typename floating_t>
+typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
+Fixed_Point_Dynamic::convert() const // to floating point number
+{
+	return static_cast<floating_t>(__data) / FP_numeric::exp2i<floating_t>(__fractional_bits);
+}
+
+template <typename FP, FP_numeric::Rounding_type R>
+FP Fixed_Point_Dynamic::to_static() const
+{
+	static_assert(FP_numeric::is_FP_S<FP>::value, "Error in Fixed_Point_Dynamic::to_static : FP is not a Fixed_Point_Static!");
+
+	FP x;
+	x.template change_data<R>(__data, __total_bits, __fractional_bits);
+	return x;
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::to_raw() const
+{
+	return __data;
+}
+
+inline int32_t Fixed_Point_Dynamic::to_int() const
+{
+	return convert< int32_t>();
+}
+
+inline int64_t Fixed_Point_Dynamic::to_lint() const
+{
+	return convert< int64_t>();
+}
+
+inline float Fixed_Point_Dynamic::to_float() const
+{
+	return convert<   float>();
+}
+
+inline double Fixed_Point_Dynamic::to_double() const
+{
+	return convert<  double>();
+}
+
+inline size_t Fixed_Point_Dynamic::get_integer_bits() const
+{
+	return __total_bits - 1 - __fractional_bits; // minus the sign bit
+}
+
+inline size_t Fixed_Point_Dynamic::get_fractional_bits() const
+{
+	return __fractional_bits;
+}
+
+inline size_t Fixed_Point_Dynamic::get_total_bits() const
+{
+	return __total_bits;
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::get_one() const
+{
+	return base_type(FP_numeric::low_mask<uint64_t>(__fractional_bits) + 1);
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::get_max() const
+{
+	return FP_numeric::__dynamic::max_of(__total_bits);
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::get_min() const
+{
+	return -get_max();
+}
+
+inline Fixed_Point_Dynamic::base_type Fixed_Point_Dynamic::get_data() const
+{
+	return __data;
+}
+
+inline FP_numeric::quantification Fixed_Point_Dynamic::get_quantification() const
+{
+	return FP_numeric::quantification{__total_bits, __fractional_bits};
+}
+
+inline FP_numeric::Arithmetic_type Fixed_Point_Dynamic::get_arithmetic_type() const
+{
+	return FP_numeric::Arithmetic_type::SIGNED_SATURATED;
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::min () const
+{
+	return from_raw(get_min(), get_quantification());
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::max () const
+{
+	return from_raw(get_max(), get_quantification());
+}
+
+// as Fixed_Point_Static::one(): the sign of one is extended from T bits (it is -1 when F == T-1)
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::one () const
+{
+	return from_raw(get_one(), get_quantification());
+}
+
+inline Fixed_Point_Dynamic Fixed_Point_Dynamic::zero() const
+{
+	return from_raw(0, get_quantification());
+}
+
+template <typename type>
+typename std::enable_if <std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type&
+Fixed_Point_Dynamic::operator=(const type& o)
+{
+	__data = FP_numeric::__dynamic::from_value(o, get_quantification(), std::is_floating_point<type>());
+	return *this;
+}
+
+template <FP_numeric::Rounding_type R>
+void Fixed_Point_Dynamic::change_data(base_type data, size_t data_total_bits, size_t data_fractional_bits)
+{
+	data   = FP_numeric::sign_extension(data, data_total_bits);
+	__data = FP_numeric::__dynamic::requantize<R>(data, data_fractional_bits, get_quantification());
+}
+
+template <FP_numeric::Rounding_type R>
+void Fixed_Point_Dynamic::change_data(const Fixed_Point_Dynamic& o)
+{
+	change_data<R>(o.__data, o.__total_bits, o.__fractional_bits);
+}
+
+inline void Fixed_Point_Dynamic::set_data(base_type data)
+{
+	__data = FP_numeric::sign_extension(data, __total_bits);
+}
+
+inline std::string Fixed_Point_Dynamic::display(int precision) const
+{
+	return FP_numeric::display(*this, precision);
+}
+
+inline std::string Fixed_Point_Dynamic::display_quantification() const
+{
+	return FP_numeric::display_quantification(*this);
+}
+
+/// ********************************************************************************************************************
+/// Display and arithmetics ********************************************************************************************
+/// ********************************************************************************************************************
+
+inline std::ostream& operator<<(std::ostream& os, const Fixed_Point_Dynamic& f)
+{
+	const size_t precision = std::min(size_t(os.precision()), f.get_fractional_bits());
+
+	char buffer[FP_numeric::chars_size<FP_S<Fixed_Point_Dynamic::max_total_bits, 0>>::value + Fixed_Point_Dynamic::max_total_bits];
+	const FP_numeric::to_chars_result res = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), f, precision);
+
+	os.write(buffer, res.ptr - buffer);
+	os << f.display_quantification();
+
+	return os;
+}
+
+inline FP_numeric::to_chars_result FP_numeric::to_chars(char* first, char* last, const Fixed_Point_Dynamic& x) noexcept
+{
+	return FP_numeric::__dynamic::chars_writer_of(x.get_fractional_bits())(first, last, x.get_data(), x.get_fractional_bits(), true);
+}
+
+inline FP_numeric::to_chars_result FP_numeric::to_chars(char* first, char* last, const Fixed_Point_Dynamic& x,
+                                                        const size_t precision) noexcept
+{
+	return FP_numeric::__dynamic::chars_writer_of(x.get_fractional_bits())(first, last, x.get_data(), precision, false);
+}
+
+// the operands are exact on 64 bits and the results of the Fixed_Point_Static hold in their T bits: the operations
+// are the same on int64_t
+inline Fixed_Point_Dynamic FP_numeric::add(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	const quantification q = __dynamic::result(add_res_quantification(lhs.get_quantification(), rhs.get_quantification()), "add");
+
+	return Fixed_Point_Dynamic::from_raw(FP_numeric::shift_fract(lhs.get_data(), q.fractional_bits, lhs.get_fractional_bits())
+	                                   + FP_numeric::shift_fract(rhs.get_data(), q.fractional_bits, rhs.get_fractional_bits()), q);
+}
+
+inline Fixed_Point_Dynamic FP_numeric::sub(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	const quantification q = __dynamic::result(sub_res_quantification(lhs.get_quantification(), rhs.get_quantification()), "sub");
+
+	return Fixed_Point_Dynamic::from_raw(FP_numeric::shift_fract(lhs.get_data(), q.fractional_bits, lhs.get_fractional_bits())
+	                                   - FP_numeric::shift_fract(rhs.get_data(), q.fractional_bits, rhs.get_fractional_bits()), q);
+}
+
+inline Fixed_Point_Dynamic FP_numeric::mul(const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	const quantification q = __dynamic::result(mul_res_quantification(lhs.get_quantification(), rhs.get_quantification()), "mul");
+
+	return Fixed_Point_Dynamic::from_raw(lhs.get_data() * rhs.get_data(), q);
+}
+
+inline Fixed_Point_Dynamic FP_numeric::div(const Fixed_Point_Dynamic& numerator, const Fixed_Point_Dynamic& denominator)
+{
+	if(!denominator)
+		throw std::domain_error("Division by zero!");
+
+	const quantification q = __dynamic::result(div_res_quantification(numerator.get_quantification(),
+	                                                                  denominator.get_quantification()), "div");
+
+	// as FP_numeric::div: the numerator is shifted of Td bits and the quotient is truncated toward zero
+	const Fixed_Point_Dynamic::base_type num_data = FP_numeric::shift_fract(numerator.get_data(),
+	                                                                        q.fractional_bits + denominator.get_fractional_bits(),
+	                                                                        numerator.get_fractional_bits());
+
+	return Fixed_Point_Dynamic::from_raw(num_data / denominator.get_data(), q);
+}
+
+inline Fixed_Point_Dynamic operator+ (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return FP_numeric::add(lhs, rhs);
+}
+
+inline Fixed_Point_Dynamic operator- (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return FP_numeric::sub(lhs, rhs);
+}
+
+inline Fixed_Point_Dynamic operator* (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return FP_numeric::mul(lhs, rhs);
+}
+
+inline Fixed_Point_Dynamic operator/ (const Fixed_Point_Dynamic& lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return FP_numeric::div(lhs, rhs);
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator+ (const Fixed_Point_Dynamic& lhs, const type rhs)
+{
+	return lhs + Fixed_Point_Dynamic(rhs, lhs.get_total_bits(), lhs.get_fractional_bits());
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator+ (const type lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return Fixed_Point_Dynamic(lhs, rhs.get_total_bits(), rhs.get_fractional_bits()) + rhs;
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator- (const Fixed_Point_Dynamic& lhs, const type rhs)
+{
+	return lhs - Fixed_Point_Dynamic(rhs, lhs.get_total_bits(), lhs.get_fractional_bits());
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator- (const type lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return Fixed_Point_Dynamic(lhs, rhs.get_total_bits(), rhs.get_fractional_bits()) - rhs;
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator* (const Fixed_Point_Dynamic& lhs, const type rhs)
+{
+	return lhs * Fixed_Point_Dynamic(rhs, lhs.get_total_bits(), lhs.get_fractional_bits());
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator* (const type lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return Fixed_Point_Dynamic(lhs, rhs.get_total_bits(), rhs.get_fractional_bits()) * rhs;
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator/ (const Fixed_Point_Dynamic& lhs, const type rhs)
+{
+	return lhs / Fixed_Point_Dynamic(rhs, lhs.get_total_bits(), lhs.get_fractional_bits());
+}
+
+template <typename type>
+typename std::enable_if<std::is_arithmetic<type>::value, Fixed_Point_Dynamic>::type
+operator/ (const type lhs, const Fixed_Point_Dynamic& rhs)
+{
+	return Fixed_Point_Dynamic(lhs, rhs.get_total_bits(), rhs.get_fractional_bits()) / rhs;
+}
+
+#endif /* FIXED_POINT_DYNAMIC_HXX_ */
@@ -0,0 +1,114 @@
+#ifndef FIXED_POINT_DYNAMIC_ARRAY_HPP_
+#define FIXED_POINT_DYNAMIC_ARRAY_HPP_
+
+#include <vector>
+
+#include "Fixed_Point_Dynamic.hpp"
+#include "Fixed_Point_Static_array.hpp"
+#include "Fixed_Point_Static_span.hpp"
+
+/// ********************************************************************************************************************
+/// FP_dynamic_array class *********************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// contiguous array of fixed points of a single quantification chosen at run time, stored as the raw base_type words
+	// of the Fixed_Point_Static<T,F> of this quantification (an int8_t up to 8 bits, an int16_t up to 16 bits...) in
+	// aligned memory: view<T,F>() gives them to the static code without copy.
+	// The elements are values (no reference on them): they are read with get or operator[] and written with set
+	class FP_dynamic_array
+	{
+	public:
+		using value_type = Fixed_Point_Dynamic;
+		using base_type  = Fixed_Point_Dynamic::base_type;
+		using size_type  = size_t;
+
+	private:
+		FP_numeric::quantification __quantification;
+		size_t                     __word_size; // bytes of the raw words
+		size_type                  __size;
+		std::vector<unsigned char, FP_numeric::aligned_allocator<unsigned char>> __words;
+
+	public: // constructors
+		// n zeros in the quantification (T, F), throw std::invalid_argument as the Fixed_Point_Dynamic constructor
+		FP_dynamic_array(size_t total_bits, size_t fractional_bits, size_type n = 0);
+		explicit FP_dynamic_array(const FP_numeric::quantification& q, size_type n = 0);
+
+		// copy of [first, first + n) in their quantification
+		template <size_t T, size_t F>
+		FP_dynamic_array(const Fixed_Point_Static<T,F>* first, size_type n);
+
+	public: // quantification
+		size_t get_total_bits     () const;
+		size_t get_fractional_bits() const;
+		size_t word_size          () const; // sizeof the base_type of the Fixed_Point_Static of this quantification
+
+		FP_numeric::quantification  get_quantification () const;
+		FP_numeric::Arithmetic_type get_arithmetic_type() const;
+
+		std::string display_quantification() const;
+
+		// set the quantification and the size: the values are then unspecified (the results of a kernel are written in)
+		void reshape(const FP_numeric::quantification& q, size_type n);
+
+	public: // capacity
+		size_type size () const;
+		bool      empty() const;
+		size_type bytes() const;
+
+		void resize(size_type n); // the new values are zeros
+		void clear ();
+
+	public: // element access
+		value_type get(size_type i) const;
+		void       set(size_type i, const value_type& x); // x is saturated (truncated toward zero) in the quantification
+		value_type operator[](size_type i) const;
+
+		// raw words of the values
+		const void* data() const;
+		      void* data();
+
+		// the values as Fixed_Point_Static<T,F>, throw std::invalid_argument if it is not their quantification
+		template <size_t T, size_t F> FP_numeric::FP_span <T,F> view();
+		template <size_t T, size_t F> FP_numeric::FP_cspan<T,F> view() const;
+	};
+}
+
+/// ********************************************************************************************************************
+/// Batch kernels on arrays of a run time quantification **************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// add, sub or mul the fixed points of lhs and rhs element by element and write the results in res, reshaped to their
+	// size and to the quantification of the Fixed_Point_Dynamic results (the same bits than the scalar operators)
+	// The quantifications are checked once per call: when lhs and rhs share a quantification of 8, 16 or 32 bits (any F)
+	// the batch kernel of the Fixed_Point_Static of this quantification is called (precompiled for each one of them and
+	// vectorized), else the values are widened to int64_t by blocks, computed with the run time shifts and narrowed.
+	// throw std::invalid_argument if the sizes differ or if res is lhs or rhs, std::domain_error if the results need
+	// more than 64 bits
+	void add_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res);
+	void sub_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res);
+	void mul_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res);
+
+	// convert the n floating points of first in fixed points of the quantification of result, resized to n
+	// (same rounding and saturation than change_data<R>, operator= by default)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP, typename floating_t>
+	typename std::enable_if<std::is_floating_point<floating_t>::value, void>::type
+	convert_n(const floating_t* first, size_t n, FP_dynamic_array& result);
+
+	// convert the fixed points of first in floating points, write them in result and return result + first.size()
+	template <typename floating_t>
+	typename std::enable_if<std::is_floating_point<floating_t>::value, floating_t*>::type
+	convert_n(const FP_dynamic_array& first, floating_t* result);
+
+	// requantize the fixed points of first in the quantification of result, resized to their number
+	// (same rounding and saturation than change_data<R>, operator= by default)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO>
+	void requantize_n(const FP_dynamic_array& first, FP_dynamic_array& result);
+}
+
+#include "Fixed_Point_Dynamic_array.hxx"
+
+#endif /* FIXED_POINT_DYNAMIC_ARRAY_HPP_ */
@@ -0,0 +1,524 @@
+#ifndef FIXED_POINT_DYNAMIC_ARRAY_HXX_
+#define FIXED_POINT_DYNAMIC_ARRAY_HXX_
+
+#include <algorithm>
+#include <cstring>
+
+#include "Fixed_Point_Dynamic_array.hpp"
+
+/// ********************************************************************************************************************
+/// Dispatch of the run time quantifications (not part of the API) ****************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __dynamic
+{
+	// bytes of the base_type of a signed Fixed_Point_Static of T bits
+	inline size_t word_size(const size_t total_bits)
+	{
+		return (total_bits <= 8) ? 1 : (total_bits <= 16) ? 2 : (total_bits <= 32) ? 4 : 8;
+	}
+
+	template <typename B>
+	inline base_type read(const void* words, const size_t i)
+	{
+		return base_type(static_cast<const B*>(words)[i]);
+	}
+
+	template <typename B>
+	inline void write(void* words, const size_t i, const base_type v)
+	{
+		static_cast<B*>(words)[i] = B(v);
+	}
+
+	// widen the n words of first to int64_t, or narrow n int64_t to words (the values hold in them)
+	template <typename B>
+	void widen(const void* first, const size_t n, base_type* result)
+	{
+		const B* words = static_cast<const B*>(first);
+		for (size_t i = 0; i < n; i++)
+			result[i] = base_type(words[i]);
+	}
+
+	template <typename B>
+	void narrow(const base_type* first, const size_t n, void* result)
+	{
+		B* words = static_cast<B*>(result);
+		for (size_t i = 0; i < n; i++)
+			words[i] = B(first[i]);
+	}
+
+	using widener  = void (*)(const void*, size_t, base_type*);
+	using narrower = void (*)(const base_type*, size_t, void*);
+
+	inline widener widener_of(const size_t word_size)
+	{
+		return (word_size == 1) ? &widen<int8_t > : (word_size == 2) ? &widen<int16_t>
+		     : (word_size == 4) ? &widen<int32_t> :                    &widen<int64_t>;
+	}
+
+	inline narrower narrower_of(const size_t word_size)
+	{
+		return (word_size == 1) ? &narrow<int8_t > : (word_size == 2) ? &narrow<int16_t>
+		     : (word_size == 4) ? &narrow<int32_t> :                    &narrow<int64_t>;
+	}
+
+	// number of values widened at once on the stack by the generic kernels (4 KiB per operand)
+	static const size_t block = 512;
+
+	// the pointer on the i-th word of words
+	inline const void* at(const void* words, const size_t i, const size_t word_size)
+	{
+		return static_cast<const unsigned char*>(words) + i * word_size;
+	}
+
+	inline void* at(void* words, const size_t i, const size_t word_size)
+	{
+		return static_cast<unsigned char*>(words) + i * word_size;
+	}
+
+	// the operations of the kernels: run is the batch kernel of the Fixed_Point_Static<T,F> on raw words, apply
+	// computes n results in lhs from lhs and rhs widened (and shifted on the fractional bits of the result if aligned)
+	struct add_op
+	{
+		static quantification result(const quantification& lhs, const quantification& rhs) { return add_res_quantification(lhs, rhs); }
+		static const char* name() { return "add_n"; }
+		static const bool  aligned = true;
+
+		template <size_t T, size_t F>
+		static void run(const void* lhs, const void* rhs, size_t n, void* res)
+		{
+			FP_numeric::add_n(static_cast<const Fixed_Point_Static<T,F>*>(lhs), static_cast<const Fixed_Point_Static<T,F>*>(rhs), n,
+			                  static_cast<typename FP_numeric::add_res_type_d<T, F, T, F>::type*>(res));
+		}
+
+		static void apply(base_type* lhs, const base_type* rhs, size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+				lhs[i] += rhs[i];
+		}
+	};
+
+	struct sub_op
+	{
+		static quantification result(const quantification& lhs, const quantification& rhs) { return sub_res_quantification(lhs, rhs); }
+		static const char* name() { return "sub_n"; }
+		static const bool  aligned = true;
+
+		template <size_t T, size_t F>
+		static void run(const void* lhs, const void* rhs, size_t n, void* res)
+		{
+			FP_numeric::sub_n(static_cast<const Fixed_Point_Static<T,F>*>(lhs), static_cast<const Fixed_Point_Static<T,F>*>(rhs), n,
+			                  static_cast<typename FP_numeric::sub_res_type_d<T, F, T, F>::type*>(res));
+		}
+
+		static void apply(base_type* lhs, const base_type* rhs, size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+				lhs[i] -= rhs[i];
+		}
+	};
+
+	struct mul_op
+	{
+		static quantification result(const quantification& lhs, const quantification& rhs) { return mul_res_quantification(lhs, rhs); }
+		static const char* name() { return "mul_n"; }
+		static const bool  aligned = false;
+
+		template <size_t T, size_t F>
+		static void run(const void* lhs, const void* rhs, size_t n, void* res)
+		{
+			FP_numeric::mul_n(static_cast<const Fixed_Point_Static<T,F>*>(lhs), static_cast<const Fixed_Point_Static<T,F>*>(rhs), n,
+			                  static_cast<typename FP_numeric::mul_res_type_d<T, F, T, F>::type*>(res));
+		}
+
+		static void apply(base_type* lhs, const base_type* rhs, size_t n)
+		{
+			for (size_t i = 0; i < n; i++)
+				lhs[i] *= rhs[i];
+		}
+	};
+
+	// tables of the kernels precompiled for the common widths (T = 8, 16 or 32 and any F), indexed by F and built once
+	using binary_kernel = void (*)(const void*, const void*, size_t, void*);
+
+	template <typename Op, size_t T, size_t... F>
+	inline binary_kernel binary_kernel_of(const size_t fractional_bits, std::index_sequence<F...>)
+	{
+		static const binary_kernel kernels[] = { &Op::template run<T, F>... };
+		return kernels[fractional_bits];
+	}
+
+	// nullptr if the quantification has no precompiled kernel
+	template <typename Op>
+	inline binary_kernel binary_kernel_of(const quantification& q)
+	{
+		switch (q.total_bits)
+		{
+		case  8: return binary_kernel_of<Op,  8>(q.fractional_bits, std::make_index_sequence< 8>());
+		case 16: return binary_kernel_of<Op, 16>(q.fractional_bits, std::make_index_sequence<16>());
+		case 32: return binary_kernel_of<Op, 32>(q.fractional_bits, std::make_index_sequence<32>());
+		default: return nullptr;
+		}
+	}
+
+	template <FP_numeric::Rounding_type R, typename floating_t>
+	struct from_floats
+	{
+		template <size_t T, size_t F>
+		static void run(const floating_t* first, size_t n, void* result)
+		{
+			FP_numeric::convert_n<R>(first, n, static_cast<Fixed_Point_Static<T,F>*>(result));
+		}
+	};
+
+	template <typename floating_t>
+	struct to_floats
+	{
+		template <size_t T, size_t F>
+		static void run(const void* first, size_t n, floating_t* result)
+		{
+			FP_numeric::convert_n(static_cast<const Fixed_Point_Static<T,F>*>(first), n, result);
+		}
+	};
+
+	template <typename Op, typename Kernel, size_t T, size_t... F>
+	inline Kernel conversion_kernel_of(const size_t fractional_bits, std::index_sequence<F...>)
+	{
+		static const Kernel kernels[] = { &Op::template run<T, F>... };
+		return kernels[fractional_bits];
+	}
+
+	template <typename Op, typename Kernel>
+	inline Kernel conversion_kernel_of(const quantification& q)
+	{
+		switch (q.total_bits)
+		{
+		case  8: return conversion_kernel_of<Op, Kernel,  8>(q.fractional_bits, std::make_index_sequence< 8>());
+		case 16: return conversion_kernel_of<Op, Kernel, 16>(q.fractional_bits, std::make_index_sequence<16>());
+		case 32: return conversion_kernel_of<Op, Kernel, 32>(q.fractional_bits, std::make_index_sequence<32>());
+		default: return nullptr;
+		}
+	}
+
+	// lhs op rhs in res, by the precompiled kernel of their quantification or by blocks widened to int64_t
+	template <typename Op>
+	void binary(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res)
+	{
+		if (lhs.size() != rhs.size())
+			throw std::invalid_argument(std::string("Error in FP_numeric::") + Op::name() + " : lhs and rhs have different sizes!");
+		if (&res == &lhs || &res == &rhs)
+			throw std::invalid_argument(std::string("Error in FP_numeric::") + Op::name() + " : res is an operand!");
+
+		const quantification ql = lhs.get_quantification();
+		const quantification qr = rhs.get_quantification();
+		const quantification q  = result(Op::result(ql, qr), Op::name());
+		const size_t         n  = lhs.size();
+
+		res.reshape(q, n);
+
+		const binary_kernel kernel = (ql == qr) ? binary_kernel_of<Op>(ql) : nullptr;
+		if (kernel != nullptr)
+		{
+			kernel(lhs.data(), rhs.data(), n, res.data());
+			return;
+		}
+
+		const widener  wl = widener_of (lhs.word_size());
+		const widener  wr = widener_of (rhs.word_size());
+		const narrower nr = narrower_of(res.word_size());
+
+		// exact left shifts of the operands on the fractional bits of the result (add and sub), as products to vectorize them
+		const size_t    sl = Op::aligned ? q.fractional_bits - ql.fractional_bits : 0;
+		const size_t    sr = Op::aligned ? q.fractional_bits - qr.fractional_bits : 0;
+		const base_type ml = base_type(1) << sl;
+		const base_type mr = base_type(1) << sr;
+
+		base_type l[block], r[block];
+		for (size_t i = 0; i < n; i += block)
+		{
+			const size_t m = std::min(block, n - i);
+
+			wl(at(lhs.data(), i, lhs.word_size()), m, l);
+			wr(at(rhs.data(), i, rhs.word_size()), m, r);
+
+			if ((sl | sr) != 0)
+				for (size_t k = 0; k < m; k++)
+				{
+					l[k] *= ml;
+					r[k] *= mr;
+				}
+
+			Op::apply(l, r, m);
+
+			nr(l, m, at(res.data(), i, res.word_size()));
+		}
+	}
+}
+}
+
+/// ********************************************************************************************************************
+/// FP_dynamic_array class *********************************************************************************************
+/// ********************************************************************************************************************
+
+inline FP_numeric::FP_dynamic_array::FP_dynamic_array(size_t total_bits, size_t fractional_bits, size_type n)
+	: FP_dynamic_array(quantification{total_bits, fractional_bits}, n)
+{
+}
+
+inline FP_numeric::FP_dynamic_array::FP_dynamic_array(const FP_numeric::quantification& q, size_type n)
+	: __quantification(q), __word_size(__dynamic::word_size(q.total_bits)), __size(n), __words(n * __word_size)
+{
+	__dynamic::check(q.total_bits, q.fractional_bits);
+}
+
+template <size_t T, size_t F>
+FP_numeric::FP_dynamic_array::FP_dynamic_array(const Fixed_Point_Static<T,F>* first, size_type n)
+	: FP_dynamic_array(T, F, n)
+{
+	static_assert(T <= Fixed_Point_Dynamic::max_total_bits, "Error in FP_dynamic_array : T > 64!");
+
+	if (n > 0)
+		std::memcpy(data(), first, n * sizeof(Fixed_Point_Static<T,F>));
+}
+
+inline size_t FP_numeric::FP_dynamic_array::get_total_bits() const
+{
+	return __quantification.total_bits;
+}
+
+inline size_t FP_numeric::FP_dynamic_array::get_fractional_bits() const
+{
+	return __quantification.fractional_bits;
+}
+
+inline size_t FP_numeric::FP_dynamic_array::word_size() const
+{
+	return __word_size;
+}
+
+inline FP_numeric::quantification FP_numeric::FP_dynamic_array::get_quantification() const
+{
+	return __quantification;
+}
+
+inline FP_numeric::Arithmetic_type FP_numeric::FP_dynamic_array::get_arithmetic_type() const
+{
+	return FP_numeric::Arithmetic_type::SIGNED_SATURATED;
+}
+
+inline std::string FP_numeric::FP_dynamic_array::display_quantification() const
+{
+	return FP_numeric::display_quantification(*this);
+}
+
+inline void FP_numeric::FP_dynamic_array::reshape(const FP_numeric::quantification& q, size_type n)
+{
+	__dynamic::check(q.total_bits, q.fractional_bits);
+
+	__quantification = q;
+	__word_size      = __dynamic::word_size(q.total_bits);
+	__size           = n;
+	__words.resize(n * __word_size);
+}
+
+inline FP_numeric::FP_dynamic_array::size_type FP_numeric::FP_dynamic_array::size() const
+{
+	return __size;
+}
+
+inline bool FP_numeric::FP_dynamic_array::empty() const
+{
+	return __size == 0;
+}
+
+inline FP_numeric::FP_dynamic_array::size_type FP_numeric::FP_dynamic_array::bytes() const
+{
+	return __size * __word_size;
+}
+
+inline void FP_numeric::FP_dynamic_array::resize(size_type n)
+{
+	__words.resize(n * __word_size, 0);
+	__size = n;
+}
+
+inline void FP_numeric::FP_dynamic_array::clear()
+{
+	__words.clear();
+	__size = 0;
+}
+
+inline FP_numeric::FP_dynamic_array::value_type FP_numeric::FP_dynamic_array::get(size_type i) const
+{
+	const base_type v = (__word_size == 1) ? __dynamic::read<int8_t >(data(), i) : (__word_size == 2) ? __dynamic::read<int16_t>(data(), i)
+	                  : (__word_size == 4) ? __dynamic::read<int32_t>(data(), i) :                      __dynamic::read<int64_t>(data(), i);
+
+	return value_type::from_raw(v, __quantification);
+}
+
+inline void FP_numeric::FP_dynamic_array::set(size_type i, const value_type& x)
+{
+	value_type v = value_type::from_raw(0, __quantification);
+	v.change_data(x);
+
+	switch (__word_size)
+	{
+	case 1 : __dynamic::write<int8_t >(data(), i, v.get_data()); break;
+	case 2 : __dynamic::write<int16_t>(data(), i, v.get_data()); break;
+	case 4 : __dynamic::write<int32_t>(data(), i, v.get_data()); break;
+	default: __dynamic::write<int64_t>(data(), i, v.get_data()); break;
+	}
+}
+
+inline FP_numeric::FP_dynamic_array::value_type FP_numeric::FP_dynamic_array::operator[](size_type i) const
+{
+	return get(i);
+}
+
+inline const void* FP_numeric::FP_dynamic_array::data() const
+{
+	return __words.data();
+}
+
+inline void* FP_numeric::FP_dynamic_array::data()
+{
+	return __words.data();
+}
+
+template <size_t T, size_t F>
+FP_numeric::FP_span<T,F> FP_numeric::FP_dynamic_array::view()
+{
+	if (!(__quantification == quantification{T, F}))
+		throw std::invalid_argument("Error in FP_dynamic_array::view : the quantification is " + display_quantification()
+		                            + " instead of " + FP_numeric::display_quantification(Fixed_Point_Static<T,F>()) + "!");
+
+	return FP_numeric::FP_span<T,F>(static_cast<typename Fixed_Point_Static<T,F>::base_type*>(data()), __size);
+}
+
+template <size_t T, size_t F>
+FP_numeric::FP_cspan<T,F> FP_numeric::FP_dynamic_array::view() const
+{
+	return const_cast<FP_dynamic_array&>(*this).view<T,F>();
+}
+
+/// ********************************************************************************************************************
+/// Batch kernels on arrays of a run time quantification **************************************************************
+/// ********************************************************************************************************************
+
+inline void FP_numeric::add_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res)
+{
+	__dynamic::binary<__dynamic::add_op>(lhs, rhs, res);
+}
+
+inline void FP_numeric::sub_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res)
+{
+	__dynamic::binary<__dynamic::sub_op>(lhs, rhs, res);
+}
+
+inline void FP_numeric::mul_n(const FP_dynamic_array& lhs, const FP_dynamic_array& rhs, FP_dynamic_array& res)
+{
+	__dynamic::binary<__dynamic::mul_op>(lhs, rhs, res);
+}
+
+template <FP_numeric::Rounding_type R, typename floating_t>
+typename std::enable_if<std::is_floating_point<floating_t>::value, void>::type
+FP_numeric::convert_n(const floating_t* first, size_t n, FP_dynamic_array& result)
+{
+	using kernel_t = void (*)(const floating_t*, size_t, void*);
+
+	const quantification q = result.get_quantification();
+	result.reshape(q, n);
+
+	const kernel_t kernel = __dynamic::conversion_kernel_of<__dynamic::from_floats<R, floating_t>, kernel_t>(q);
+	if (kernel != nullptr)
+	{
+		kernel(first, n, result.data());
+		return;
+	}
+
+	const __dynamic::narrower nr = __dynamic::narrower_of(result.word_size());
+
+	__dynamic::base_type v[__dynamic::block];
+	for (size_t i = 0; i < n; i += __dynamic::block)
+	{
+		const size_t m = std::min(__dynamic::block, n - i);
+
+		for (size_t k = 0; k < m; k++)
+			v[k] = __dynamic::from_float<R>(first[i + k], q);
+
+		nr(v, m, __dynamic::at(result.data(), i, result.word_size()));
+	}
+}
+
+template <typename floating_t>
+typename std::enable_if<std::is_floating_point<floating_t>::value, floating_t*>::type
+FP_numeric::convert_n(const FP_dynamic_array& first, floating_t* result)
+{
+	using kernel_t = void (*)(const void*, size_t, floating_t*);
+
+	const quantification q = first.get_quantification();
+	const size_t         n = first.size();
+
+	const kernel_t kernel = __dynamic::conversion_kernel_of<__dynamic::to_floats<floating_t>, kernel_t>(q);
+	if (kernel != nullptr)
+	{
+		kernel(first.data(), n, result);
+		return result + n;
+	}
+
+	const __dynamic::widener wf    = __dynamic::widener_of(first.word_size());
+	const floating_t         scale = FP_numeric::exp2i<floating_t>(q.fractional_bits);
+
+	__dynamic::base_type v[__dynamic::block];
+	for (size_t i = 0; i < n; i += __dynamic::block)
+	{
+		const size_t m = std::min(__dynamic::block, n - i);
+
+		wf(__dynamic::at(first.data(), i, first.word_size()), m, v);
+
+		for (size_t k = 0; k < m; k++)
+			result[i + k] = static_cast<floating_t>(v[k]) / scale;
+	}
+
+	return result + n;
+}
+
+template <FP_numeric::Rounding_type R>
+void FP_numeric::requantize_n(const FP_dynamic_array& first, FP_dynamic_array& result)
+{
+	const quantification qi = first .get_quantification();
+	const quantification qo = result.get_quantification();
+	const size_t         n  = first.size();
+
+	if (&first == &result)
+		return;
+
+	result.reshape(qo, n);
+
+	if (qi == qo)
+	{
+		if (n > 0)
+			std::memcpy(result.data(), first.data(), first.bytes());
+		return;
+	}
+
+	const __dynamic::widener  wf = __dynamic::widener_of (first .word_size());
+	const __dynamic::narrower nr = __dynamic::narrower_of(result.word_size());
+
+	__dynamic::base_type v[__dynamic::block];
+	for (size_t i = 0; i < n; i += __dynamic::block)
+	{
+		const size_t m = std::min(__dynamic::block, n - i);
+
+		wf(__dynamic::at(first.data(), i, first.word_size()), m, v);
+
+		for (size_t k = 0; k < m; k++)
+			v[k] = __dynamic::requantize<R>(v[k], qi.fractional_bits, qo);
+
+		nr(v, m, __dynamic::at(result.data(), i, result.word_size()));
+	}
+}
+
+#endif /* FIXED_POINT_DYNAMIC_ARRAY_HXX_ */
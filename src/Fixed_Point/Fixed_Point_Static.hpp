@@ -13,44 +13,64 @@
 
 #include "Fixed_Point_utils.hpp"
 
+namespace FP_numeric
+{
+	// true for the lazy expressions of Fixed_Point_Static_expressions.hpp
+	template <typename E>
+	struct is_expression : public std::false_type { };
+}
+
 /// Fixed_Point_Static class ******************************************************************************************
-template <size_t T, size_t F>
+// A is the overflow policy applied when a value is stored in the quantification (constructors, assignments, compound
+// assignments, increments and left shifts): see FP_numeric::Arithmetic_type
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
 class Fixed_Point_Static
 {
 public:
-	using base_type = typename FP_numeric::matching_type<T>::type;
+	// intN_t for the signed arithmetic types, uintN_t for the unsigned ones (no sign bit: FP_U<8,8> holds in an uint8_t)
+	using base_type = typename std::conditional<FP_numeric::is_signed_type(A), typename FP_numeric::matching_type <T>::type,
+	                                                                           typename FP_numeric::matching_utype<T>::type>::type;
 
-	static_assert(!std::is_void<base_type>::value, "Error in Fixed_Point_Static : T > "
-	                                 #if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
-	                                        "128"
-	                                 #else
-	                                        "64"
-	                                 #endif
-	                                        " bits! T"
-	);
+	// (from 65 to 128 bits base_type is __int128 if ENABLE_128_BITS is defined, else the portable FP_numeric::int128_t,
+	// then the FP_numeric::multi_word of N 64 bits words up to FP_numeric::max_words)
+	static_assert(!std::is_void<base_type>::value, "Error in Fixed_Point_Static : T > 1024 bits! T");
 
 	static_assert(T > 0, "Error in Fixed_Point_Static : T == 0!");
-	static_assert(T > F, "Error in Fixed_Point_Static : T <= F!"); // TODO: if signed, else can be ==
+	static_assert(T > F || (T == F && !FP_numeric::is_signed_type(A)), "Error in Fixed_Point_Static : T <= F!");
 
 	static const size_t Tb       = T;
 	static const size_t Fb       = F;
+	static const FP_numeric::Arithmetic_type Ab = A;
 	static const size_t capacity = sizeof(base_type)*8; // maximum size of T before needing to rise the size of base_type
 
 private: //given
 	static const size_t __total_bits      = Tb;
 	static const size_t __fractional_bits = Fb;
 
-	static const FP_numeric::Arithmetic_type __ar_type  = FP_numeric::Arithmetic_type::SIGNED_SATURATED;
+	static const FP_numeric::Arithmetic_type __ar_type  = A;
 
 private: //automatically calculated
-	static const base_type __one             =      base_type(1)  << __fractional_bits;
-	static const size_t    __integer_bits    = __total_bits - __fractional_bits - ((__ar_type == FP_numeric::Arithmetic_type::SIGNED_SATURATED)?1:0);
-	static const base_type __fractional_mask =  ~((~base_type(0)) << __fractional_bits);
-	static const base_type __integer_mask    = (~((~base_type(0)) << __integer_bits   )) << __fractional_bits;
-	static const base_type __max_            = __integer_mask | __fractional_mask;
-	static const base_type __min_            = ((__ar_type == FP_numeric::Arithmetic_type::SIGNED_SATURATED)? -__max_ : 0); // symmetric value range dynamic
-	static const base_type __number_mask     = ((__ar_type == FP_numeric::Arithmetic_type::SIGNED_SATURATED)? ((__integer_mask | __fractional_mask) << 1) +1
-	                                                                                                        :  (__integer_mask | __fractional_mask));
+	// masks are built on the unsigned type: no shift of a negative value, so they are valid constant expressions
+	using __ubase_type = typename FP_numeric::unsigned_type<base_type>::type;
+
+	static const bool      __has_sign        = FP_numeric::is_signed_type(__ar_type);
+	static const size_t    __value_bits      = __total_bits - (__has_sign ? 1 : 0); // minus the sign bit
+	static const size_t    __integer_bits    = __value_bits - __fractional_bits;
+	static constexpr base_type __fractional_mask = base_type(FP_numeric::low_mask<__ubase_type>(__fractional_bits));
+	static constexpr base_type __max_            = base_type(FP_numeric::low_mask<__ubase_type>(__value_bits));
+	static constexpr base_type __integer_mask    = base_type(__ubase_type(__max_) & ~__ubase_type(__fractional_mask));
+	static constexpr base_type __min_            = (!__has_sign) ? base_type(0) // unsigned value range
+	                                         : (FP_numeric::is_wrapped_type(__ar_type)) ? base_type(-__max_ - 1) // full two's complement range
+	                                                                                    : base_type(-__max_);    // symmetric value range dynamic
+	static constexpr base_type __number_mask     = base_type(FP_numeric::low_mask<__ubase_type>(__total_bits));
+	// one is saturated at max when it can not be represented (unsigned types with T == F)
+	static constexpr base_type __one             = (__has_sign || __fractional_bits < __value_bits)
+	                                         ? base_type(__ubase_type(__fractional_mask) + 1) : __max_;
+	// weight of the most significant fractional bit (null if there is no fractional part)
+	static constexpr base_type __half            = base_type(__ubase_type(__fractional_mask) - (__ubase_type(__fractional_mask) >> 1));
+
+	// numbers are compared in the saturated type of the same signedness
+	using __saturated_type = Fixed_Point_Static<T, F, FP_numeric::result_type(A, A)>;
 
 	//static_assert(__integer_bits >  0, "Error in Fixed_Point_Static : __integer_bits == 0!");
 	static_assert(__integer_bits <= T, "Error in Fixed_Point_Static : __integer_bits > T!" );
@@ -60,137 +80,143 @@ private : //the data
 	base_type __data;
 
 public: // constructors
-	Fixed_Point_Static();
+	constexpr Fixed_Point_Static();
 
-	template <typename type> Fixed_Point_Static(type data);
+	template <typename type> constexpr Fixed_Point_Static(type data);
 
-	virtual ~Fixed_Point_Static();
+	// no user-declared destructor nor copy/move operations: a Fixed_Point_Static is stored exactly as its
+	// base_type (no vtable pointer) and stays trivially copyable so arrays of it can be memcpy'd and vectorized
 
 public:
-	// return the given value val saturated (if needed) with the configuration of this Fixed_Point_Static
-	template <typename type> base_type saturate(const type val) const;
+	// return the given value val saturated, wrapped or checked (if needed) with the configuration of this Fixed_Point_Static
+	// (with its arithmetic type A by default or with the given one Ar)
+	template <FP_numeric::Arithmetic_type Ar = A, typename type> constexpr base_type saturate(const type val) const;
 
 	// return the __data value of this Fixed_Point_Static with the point set at the new_fract_bits position
-	base_type shift_fract(const size_t new_fract_bits) const;
+	// (the dropped fractional bits are rounded in function of R)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::TRUNCATED>
+	constexpr base_type shift_fract(const size_t new_fract_bits) const;
 
 public: // relational operators : TODO : manage risks of overflow in extrem cases
-	template <size_t To, size_t Fo> bool operator> (const Fixed_Point_Static<To, Fo>& o) const;
-	template <size_t To           > bool operator> (const Fixed_Point_Static<To, F >& o) const;
-	template <size_t To, size_t Fo> bool operator< (const Fixed_Point_Static<To, Fo>& o) const;
-	template <size_t To, size_t Fo> bool operator<=(const Fixed_Point_Static<To, Fo>& o) const;
-	template <size_t To, size_t Fo> bool operator>=(const Fixed_Point_Static<To, Fo>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator> (const Fixed_Point_Static<To, Fo, Ao>& o) const;
+	template <size_t To           , FP_numeric::Arithmetic_type Ao> constexpr bool operator> (const Fixed_Point_Static<To, F , Ao>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator< (const Fixed_Point_Static<To, Fo, Ao>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator<=(const Fixed_Point_Static<To, Fo, Ao>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator>=(const Fixed_Point_Static<To, Fo, Ao>& o) const;
 
-	template <typename type> bool operator> (const type n) const;
-	template <typename type> bool operator< (const type n) const;
-	template <typename type> bool operator<=(const type n) const;
-	template <typename type> bool operator>=(const type n) const;
+	template <typename type> constexpr bool operator> (const type n) const;
+	template <typename type> constexpr bool operator< (const type n) const;
+	template <typename type> constexpr bool operator<=(const type n) const;
+	template <typename type> constexpr bool operator>=(const type n) const;
 
-	template <size_t To, size_t Fo> bool operator==(const Fixed_Point_Static<To, Fo>& o) const;
-	template <size_t To           > bool operator==(const Fixed_Point_Static<To, F >& o) const;
-	template <size_t To, size_t Fo> bool operator!=(const Fixed_Point_Static<To, Fo>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator==(const Fixed_Point_Static<To, Fo, Ao>& o) const;
+	template <size_t To           , FP_numeric::Arithmetic_type Ao> constexpr bool operator==(const Fixed_Point_Static<To, F , Ao>& o) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr bool operator!=(const Fixed_Point_Static<To, Fo, Ao>& o) const;
 
-	template <typename type> bool operator==(const type n) const;
-	template <typename type> bool operator!=(const type n) const;
+	template <typename type> constexpr bool operator==(const type n) const;
+	template <typename type> constexpr bool operator!=(const type n) const;
 
-	bool operator! ( ) const; // true if the this fixed point is null
+	constexpr bool operator! ( ) const; // true if the this fixed point is null
 
 	// compare the quantification of this Fixed_Point_Static with the given one
-	bool same_quantification(size_t total_bits, size_t fractional_bits) const;
-	template <size_t To, size_t Fo>
-	bool same_quantification(const Fixed_Point_Static<To, Fo>& o      ) const;
+	constexpr bool same_quantification(size_t total_bits, size_t fractional_bits) const;
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+	constexpr bool same_quantification(const Fixed_Point_Static<To, Fo, Ao>& o      ) const;
 
 public: // binary operators: they do not care about the quantification of the number in __data
-	Fixed_Point_Static<T,F>  operator~  ( ) const;
+	constexpr Fixed_Point_Static<T,F,A>  operator~  ( ) const;
 
-	template <size_t To, size_t Fo> Fixed_Point_Static<T,F>& operator&= (const Fixed_Point_Static<To, Fo>& n);
-	template <size_t To, size_t Fo> Fixed_Point_Static<T,F>& operator|= (const Fixed_Point_Static<To, Fo>& n);
-	template <size_t To, size_t Fo> Fixed_Point_Static<T,F>& operator^= (const Fixed_Point_Static<To, Fo>& n);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr Fixed_Point_Static<T,F,A>& operator&= (const Fixed_Point_Static<To, Fo, Ao>& n);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr Fixed_Point_Static<T,F,A>& operator|= (const Fixed_Point_Static<To, Fo, Ao>& n);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr Fixed_Point_Static<T,F,A>& operator^= (const Fixed_Point_Static<To, Fo, Ao>& n);
 
-	template <typename type> Fixed_Point_Static<T,F>& operator&= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator|= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator^= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator&= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator|= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator^= (const type n);
 
-	template <size_t To, size_t Fo>	Fixed_Point_Static<T,F>& operator>>=(const Fixed_Point_Static<To, Fo>& n);
-	template <size_t To, size_t Fo>	Fixed_Point_Static<T,F>& operator<<=(const Fixed_Point_Static<To, Fo>& n);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>	constexpr Fixed_Point_Static<T,F,A>& operator>>=(const Fixed_Point_Static<To, Fo, Ao>& n);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>	constexpr Fixed_Point_Static<T,F,A>& operator<<=(const Fixed_Point_Static<To, Fo, Ao>& n);
 
 
 	template <typename integral_t>
-	typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator>>=(const integral_t n);
 
 	template <typename integral_t>
-	typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator<<=(const integral_t n);
 
 	template <typename floating_t>
-	typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator>>=(const floating_t n);
 
 	template <typename floating_t>
-	typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator<<=(const floating_t n);
 
 public: // basic math operators
-	const Fixed_Point_Static<T,F>& operator+ () const;
-	      Fixed_Point_Static<T,F>  operator- () const;
+	constexpr const Fixed_Point_Static<T,F,A>& operator+ () const;
+	constexpr       Fixed_Point_Static<T,F,A>  operator- () const;
 
 	// if __total_bits is null then takes the quantification of the result of the operation
-	Fixed_Point_Static<T,F>& operator++ (   );
-	Fixed_Point_Static<T,F>& operator-- (   );
-	Fixed_Point_Static<T,F>& operator++ (int);
-	Fixed_Point_Static<T,F>& operator-- (int);
+	constexpr Fixed_Point_Static<T,F,A>& operator++ (   );
+	constexpr Fixed_Point_Static<T,F,A>& operator-- (   );
+	constexpr Fixed_Point_Static<T,F,A>  operator++ (int); // return the previous value
+	constexpr Fixed_Point_Static<T,F,A>  operator-- (int);
 
 	// if __total_bits is null then takes the quantification of the result of the operation
-	template <typename type> Fixed_Point_Static<T,F>& operator+= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator-= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator*= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator/= (const type n);
-	template <typename type> Fixed_Point_Static<T,F>& operator%= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator+= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator-= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator*= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator/= (const type n);
+	template <typename type> constexpr Fixed_Point_Static<T,F,A>& operator%= (const type n);
 
 public: // math functions
 	// check if this fixed point is (positive or null) or is (strictly positive)
-	bool is_pos () const;
-	bool is_spos() const;
+	constexpr bool is_pos () const;
+	constexpr bool is_spos() const;
 
 	// check if this fixed point is (negative or null) or (strictly negative)
-	bool is_neg () const;
-	bool is_sneg() const;
+	constexpr bool is_neg () const;
+	constexpr bool is_sneg() const;
 
 	// check if this fixed point equals zero, or one, or if it's saturated at max or min
-	bool is_zero() const;
-	bool is_one () const;
-	bool is_min () const;
-	bool is_max () const;
-	bool is_sat () const;
+	constexpr bool is_zero() const;
+	constexpr bool is_one () const;
+	constexpr bool is_min () const;
+	constexpr bool is_max () const;
+	constexpr bool is_sat () const;
 
-	Fixed_Point_Static<T,F> abs () const;
-	int                     sign() const; // return 0 if positive else (-1)
+	constexpr Fixed_Point_Static<T,F,A> abs () const;
+	constexpr int                     sign() const; // return 0 if positive else (-1)
 
 public: // conversion to common types
 	//convert properly __data taking into account the comma position
-	template <typename uintegral_t>
-	typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
+	// (the fractional part is rounded in function of R then the result is saturated in the integer type)
+	template <typename uintegral_t, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP>
+	constexpr typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
 	convert() const; // to unsigned integer
 
-	template <typename sintegral_t>
-	typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
+	template <typename sintegral_t, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP>
+	constexpr typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
 	convert() const; // to signed integer
 
 	template <typename floating_t>
-	typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
+	constexpr typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
 	convert() const; // to floating point number
 
+public:
 	// directly cast __data to the given type
-	template <typename type>     type cast() const;
-	template <typename type> operator type() const; // static cast
+	template <typename type> constexpr type cast() const;
+	template <typename type> constexpr operator type() const; // static cast
 
-	base_type to_raw   () const;
-	  int32_t to_int   () const;
-	 uint32_t to_uint  () const;
-	  int64_t to_lint  () const;
-	 uint64_t to_luint () const;
-	    float to_float () const;
-	   double to_double() const;
+	constexpr base_type to_raw   () const;
+	constexpr   int32_t to_int   () const;
+	constexpr  uint32_t to_uint  () const;
+	constexpr   int64_t to_lint  () const;
+	constexpr  uint64_t to_luint () const;
+	constexpr     float to_float () const;
+	constexpr    double to_double() const;
 
 	// return a binary representation of the data value.
 	// to_bin  return a sizeof(base_type)*8 bits length number
@@ -205,65 +231,71 @@ public: // conversion to common types
 	std::string  to_shex() const;
 
 public: // basic getters
-	size_t    get_integer_bits   () const;
-	size_t    get_fractional_bits() const;
-	size_t    get_total_bits     () const;
-	base_type get_number_mask    () const;
-	base_type get_fractional_mask() const;
-	base_type get_integer_mask   () const;
-	base_type get_one            () const;
-	base_type get_max            () const;
-	base_type get_min            () const;
-	base_type get_data           () const;
-
-	FP_numeric::Arithmetic_type get_arithmetic_type() const;
+	constexpr size_t    get_integer_bits   () const;
+	constexpr size_t    get_fractional_bits() const;
+	constexpr size_t    get_total_bits     () const;
+	constexpr base_type get_number_mask    () const;
+	constexpr base_type get_fractional_mask() const;
+	constexpr base_type get_integer_mask   () const;
+	constexpr base_type get_one            () const;
+	constexpr base_type get_max            () const;
+	constexpr base_type get_min            () const;
+	constexpr base_type get_data           () const;
+
+	constexpr FP_numeric::Arithmetic_type get_arithmetic_type() const;
 
 	// return min, max, one or zero values with the quantification of this fixed point
 	// if there is none then return an empty Fixed_Point_Static
-	static constexpr Fixed_Point_Static<T,F> min ();
-	static constexpr Fixed_Point_Static<T,F> max ();
-	static constexpr Fixed_Point_Static<T,F> one ();
-	static constexpr Fixed_Point_Static<T,F> zero();
+	static constexpr Fixed_Point_Static<T,F,A> min ();
+	static constexpr Fixed_Point_Static<T,F,A> max ();
+	static constexpr Fixed_Point_Static<T,F,A> one ();
+	static constexpr Fixed_Point_Static<T,F,A> zero();
 
 public: // setters
 	// the following methods and operators change only the data value in function of the already set quantification
 	template <typename integral_t>
-	typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator=(const integral_t& o);
 
 	template <typename floating_t>
-	typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
+	constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
 	operator=(const floating_t& o);
 
-	template <size_t To, size_t Fo>
-	Fixed_Point_Static<T,F>&
-	operator=(const Fixed_Point_Static<To,Fo>& o);
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+	constexpr Fixed_Point_Static<T,F,A>&
+	operator=(const Fixed_Point_Static<To,Fo,Ao>& o);
+
+	// evaluate the lazy expression once then saturate it in this quantification
+	template <typename expression_t>
+	constexpr typename std::enable_if <FP_numeric::is_expression<expression_t>::value, Fixed_Point_Static<T,F,A>>::type&
+	operator=(const expression_t& e);
 
 	// the following methods and operators change only the data value with an original quantification
 	// in function of the already set quantification (manage the possible need of a sign extension with the input data)
+	// the dropped fractional bits are rounded in function of R: toward zero by default for the fixed point data,
+	// to the nearest for the floating point ones
 	template <typename type>
-	void
+	constexpr void
 	change_data(const type data);
 
-	template <typename integral_t>
-	typename std::enable_if <std::is_integral<integral_t>::value, void>::type
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO, typename integral_t>
+	constexpr typename std::enable_if <FP_numeric::is_integral<integral_t>::value, void>::type
 	change_data(      integral_t data, size_t data_total_bits, size_t data_fractional_bits);
 
-	template <typename floating_t>
-	typename std::enable_if <std::is_floating_point<floating_t>::value, void>::type&
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP, typename floating_t>
+	constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, void>::type
 	change_data(const floating_t data, size_t data_total_bits, size_t data_fractional_bits);
 
-	                                void change_data(const Fixed_Point_Static<T ,F >& o);
-	template <size_t To           > void change_data(const Fixed_Point_Static<To,F >& o);
-	template <size_t To, size_t Fo> void change_data(const Fixed_Point_Static<To,Fo>& o);
+	constexpr void change_data(const Fixed_Point_Static<T ,F ,A >& o);
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO, size_t To, FP_numeric::Arithmetic_type Ao>
+	constexpr void change_data(const Fixed_Point_Static<To,F ,Ao>& o);
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO, size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+	constexpr void change_data(const Fixed_Point_Static<To,Fo,Ao>& o);
 
-	// the following methods set the given argument as new quantification OR arithmetic type OR data
-	// without touching the others
-	template <typename integer_t  > void set_data(integer_t data                     );
-	template <size_t To, size_t Fo> void set_data(const Fixed_Point_Static<To, Fo>& o);
-
-	                                void set_arithmetic_type(FP_numeric::Arithmetic_type ar_type);
-	template <size_t To, size_t Fo>	void set_arithmetic_type(const Fixed_Point_Static<To, Fo>& o);
+	// the following methods set the given argument as new data without touching the quantification
+	// (the arithmetic type is the template parameter A)
+	template <typename integer_t  > constexpr void set_data(integer_t data                     );
+	template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao> constexpr void set_data(const Fixed_Point_Static<To, Fo, Ao>& o);
 
 public: // display methods
 	std::string display(int precision) const;
@@ -281,23 +313,28 @@ public: // display methods
 
 namespace FP_numeric
 {
-	// TODO: take care of the arithmetic type in the computation of the result size
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	// the results are saturated. They are unsigned when both operands are unsigned (but for a subtraction), else an
+	// unsigned operand is first promoted to a signed type of one more bit (same range) and the signed sizes are used.
+	// the total bits T of an operand once promoted to the signedness of the result
+	template <size_t T, Arithmetic_type A, bool signed_result>
+	struct promoted_bits;
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, Arithmetic_type Al = SIGNED_SATURATED, Arithmetic_type Ar = SIGNED_SATURATED>
 	struct add_res_type_d;
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, Arithmetic_type Al = SIGNED_SATURATED, Arithmetic_type Ar = SIGNED_SATURATED>
 	struct sub_res_type_d;
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, Arithmetic_type Al = SIGNED_SATURATED, Arithmetic_type Ar = SIGNED_SATURATED>
 	struct mul_res_type_d;
 
-	template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, Arithmetic_type An = SIGNED_SATURATED, Arithmetic_type Ad = SIGNED_SATURATED>
 	struct div_res_type_d;
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, Arithmetic_type Al = SIGNED_SATURATED, Arithmetic_type Ar = SIGNED_SATURATED>
 	struct mod_res_type_d;
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, Arithmetic_type Al = SIGNED_SATURATED, Arithmetic_type Ar = SIGNED_SATURATED>
 	struct comp_res_type_d;
 
 
@@ -320,8 +357,24 @@ namespace FP_numeric
 	struct comp_res_type;
 }
 
-template <size_t T, size_t F>
-using FP_S = Fixed_Point_Static<T,F>;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+using FP_S = Fixed_Point_Static<T,F,A>;
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::UNSIGNED_SATURATED>
+using FP_U = Fixed_Point_Static<T,F,A>;
+
+namespace FP_numeric
+{
+	// check at compile time that a Fixed_Point_Static has exactly the layout of its base_type
+	template <typename FP>
+	struct has_raw_layout
+	{
+		static const bool value = sizeof (FP) == sizeof (typename FP::base_type)
+		                       && alignof(FP) == alignof(typename FP::base_type)
+		                       && std::is_standard_layout  <FP>::value
+		                       && std::is_trivially_copyable<FP>::value;
+	};
+}
 
 #include "Fixed_Point_Static.hxx"
 #include "Fixed_Point_Static_operators.hpp"
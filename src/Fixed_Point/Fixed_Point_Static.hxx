@@ -1,60 +1,107 @@
 #ifndef FIXED_POINT_STATIC_HXX_
 #define FIXED_POINT_STATIC_HXX_
 
-// TODO: take care of the arithmetic type in the computation of the result size
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+// definitions of the constants (needed when a double_word base_type is passed by reference before C++17)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__fractional_mask;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__max_;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__integer_mask;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__min_;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__number_mask;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__one;
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::__half;
+
+template <size_t T, FP_numeric::Arithmetic_type A, bool signed_result>
+struct FP_numeric::promoted_bits
+{
+	static const size_t value = T + ((signed_result && !FP_numeric::is_signed_type(A)) ? 1 : 0);
+};
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
 struct FP_numeric::add_res_type_d
 {
-	using type = typename std::conditional<(Tl - Fl) >= (Tr - Fr), // compare integral part
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tl+1,       Fl>,
-	                                                                          Fixed_Point_Static<Tl-Fl+Fr+1, Fr>>::type,
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tr-Fr+Fl+1, Fl>,
-	                                                                          Fixed_Point_Static<Tr+1,       Fr>>::type
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::result_type(Al, Ar);
+	static const size_t Tlp = FP_numeric::promoted_bits<Tl, Al, FP_numeric::is_signed_type(Ab)>::value;
+	static const size_t Trp = FP_numeric::promoted_bits<Tr, Ar, FP_numeric::is_signed_type(Ab)>::value;
+
+	using type = typename std::conditional<(Tlp - Fl) >= (Trp - Fr), // compare integral part
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tlp+1,        Fl, Ab>,
+	                                                                          Fixed_Point_Static<Tlp-Fl+Fr+1,  Fr, Ab>>::type,
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Trp-Fr+Fl+1,  Fl, Ab>,
+	                                                                          Fixed_Point_Static<Trp+1,        Fr, Ab>>::type
 	                                      >::type;
 };
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+// the difference of two unsigned numbers can be negative: the result is always signed
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
 struct FP_numeric::sub_res_type_d
 {
-	using type = typename std::conditional<(Tl - Fl) >= (Tr - Fr), // compare integral part
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tl+1,       Fl>,
-	                                                                          Fixed_Point_Static<Tl-Fl+Fr+1, Fr>>::type,
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tr-Fr+Fl+1, Fl>,
-	                                                                          Fixed_Point_Static<Tr+1,       Fr>>::type
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::Arithmetic_type::SIGNED_SATURATED;
+	static const size_t Tlp = FP_numeric::promoted_bits<Tl, Al, true>::value;
+	static const size_t Trp = FP_numeric::promoted_bits<Tr, Ar, true>::value;
+
+	using type = typename std::conditional<(Tlp - Fl) >= (Trp - Fr), // compare integral part
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tlp+1,        Fl, Ab>,
+	                                                                          Fixed_Point_Static<Tlp-Fl+Fr+1,  Fr, Ab>>::type,
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Trp-Fr+Fl+1,  Fl, Ab>,
+	                                                                          Fixed_Point_Static<Trp+1,        Fr, Ab>>::type
 	                                      >::type;
 };
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
 struct FP_numeric::mul_res_type_d
 {
-	using type = Fixed_Point_Static<Tl+Tr-1, Fl+Fr>; // "-1" if SIGNED_SATURATED
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::result_type(Al, Ar);
+	static const size_t Tlp = FP_numeric::promoted_bits<Tl, Al, FP_numeric::is_signed_type(Ab)>::value;
+	static const size_t Trp = FP_numeric::promoted_bits<Tr, Ar, FP_numeric::is_signed_type(Ab)>::value;
+
+	using type = Fixed_Point_Static<Tlp+Trp-(FP_numeric::is_signed_type(Ab) ? 1 : 0), Fl+Fr, Ab>; // "-1" if signed
 };
 
-template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, FP_numeric::Arithmetic_type An, FP_numeric::Arithmetic_type Ad>
 struct FP_numeric::div_res_type_d
 {
-	using type = Fixed_Point_Static<Tn+Td+1, Fn+Td-Fd>; // I = Tn-Fn+Fd+1 ; F = Fn+Td-Fd ; T = I+F = Tn+Td+1
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::result_type(An, Ad);
+	static const size_t Tnp = FP_numeric::promoted_bits<Tn, An, FP_numeric::is_signed_type(Ab)>::value;
+	static const size_t Tdp = FP_numeric::promoted_bits<Td, Ad, FP_numeric::is_signed_type(Ab)>::value;
+
+	// I = Tn-Fn+Fd+1 ; F = Fn+Td-Fd ; T = I+F = Tn+Td+1 ("+1" if signed)
+	using type = Fixed_Point_Static<Tnp+Tdp+(FP_numeric::is_signed_type(Ab) ? 1 : 0), Fn+Tdp-Fd, Ab>;
 };
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
 struct FP_numeric::mod_res_type_d
 {
-	using type = typename std::conditional<(Tl - Fl) >= (Tr - Fr), // compare integral part
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tl+1,       Fl>,
-	                                                                          Fixed_Point_Static<Tl-Fl+Fr+1, Fr>>::type,
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tr-Fr+Fl+1, Fl>,
-	                                                                          Fixed_Point_Static<Tr+1,       Fr>>::type
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::result_type(Al, Ar);
+	static const size_t Tlp = FP_numeric::promoted_bits<Tl, Al, FP_numeric::is_signed_type(Ab)>::value;
+	static const size_t Trp = FP_numeric::promoted_bits<Tr, Ar, FP_numeric::is_signed_type(Ab)>::value;
+
+	using type = typename std::conditional<(Tlp - Fl) >= (Trp - Fr), // compare integral part
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tlp+1,        Fl, Ab>,
+	                                                                          Fixed_Point_Static<Tlp-Fl+Fr+1,  Fr, Ab>>::type,
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Trp-Fr+Fl+1,  Fl, Ab>,
+	                                                                          Fixed_Point_Static<Trp+1,        Fr, Ab>>::type
 	                                      >::type;
 };
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
 struct FP_numeric::comp_res_type_d
 {
-	using type = typename std::conditional<(Tl - Fl) >= (Tr - Fr), // compare integral part
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tl,       Fl>,
-	                                                                          Fixed_Point_Static<Tl-Fl+Fr, Fr>>::type,
-	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tr-Fr+Fl, Fl>,
-	                                                                          Fixed_Point_Static<Tr,       Fr>>::type
+	static const FP_numeric::Arithmetic_type Ab = FP_numeric::result_type(Al, Ar);
+	static const size_t Tlp = FP_numeric::promoted_bits<Tl, Al, FP_numeric::is_signed_type(Ab)>::value;
+	static const size_t Trp = FP_numeric::promoted_bits<Tr, Ar, FP_numeric::is_signed_type(Ab)>::value;
+
+	using type = typename std::conditional<(Tlp - Fl) >= (Trp - Fr), // compare integral part
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Tlp,        Fl, Ab>,
+	                                                                          Fixed_Point_Static<Tlp-Fl+Fr,  Fr, Ab>>::type,
+	                                      typename std::conditional<Fl >= Fr, Fixed_Point_Static<Trp-Fr+Fl,  Fl, Ab>,
+	                                                                          Fixed_Point_Static<Trp,        Fr, Ab>>::type
 	                                      >::type;
 };
 
@@ -62,77 +109,99 @@ struct FP_numeric::comp_res_type_d
 template <typename FPl, typename FPr>
 struct FP_numeric::add_res_type
 {
-	using type = typename add_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename add_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 template <typename FPl, typename FPr>
 struct FP_numeric::sub_res_type
 {
-	using type = typename sub_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename sub_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 template <typename FPl, typename FPr>
 struct FP_numeric::mul_res_type
 {
-	using type = typename mul_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename mul_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 template <typename FPl, typename FPr>
 struct FP_numeric::div_res_type
 {
-	using type = typename div_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename div_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 template <typename FPl, typename FPr>
 struct FP_numeric::mod_res_type
 {
-	using type = typename mod_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename mod_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 template <typename FPl, typename FPr>
 struct FP_numeric::comp_res_type
 {
-	using type = typename comp_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+	using type = typename comp_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, FPl::Ab, FPr::Ab>::type;
 };
 
 
 // contructors
-template <size_t T, size_t F>
-Fixed_Point_Static<T,F>::Fixed_Point_Static()
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A>::Fixed_Point_Static()
 : __data(base_type(0))
-{ }
+{
+	static_assert(FP_numeric::has_raw_layout<Fixed_Point_Static<T,F,A>>::value,
+	              "Error in Fixed_Point_Static : the layout is not the one of base_type!");
+}
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-Fixed_Point_Static<T,F>::Fixed_Point_Static(type data)
-{ change_data(data); }
-
-template <size_t T, size_t F>
-Fixed_Point_Static<T,F>::~Fixed_Point_Static()
-{ }
+constexpr Fixed_Point_Static<T,F,A>::Fixed_Point_Static(type data)
+: __data(base_type(0))
+{
+	static_assert(FP_numeric::has_raw_layout<Fixed_Point_Static<T,F,A>>::value,
+	              "Error in Fixed_Point_Static : the layout is not the one of base_type!");
+	change_data(data);
+}
 
-// return the given value val saturated (if needed) with the configuration of this Fixed_Point_Static
-template <size_t T, size_t F>
-template <typename type>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::saturate(const type val) const
+// return the given value val saturated, wrapped or checked (if needed) with the configuration of this Fixed_Point_Static
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::saturate(const type val) const
 {
-	using big_type = typename FP_numeric::biggest_type<base_type, type>::type;
+	using big_type  = typename FP_numeric::biggest_type<base_type, type>::type;
+	using big_utype = typename FP_numeric::unsigned_type<big_type>::type;
 
-	return (base_type)FP_numeric::saturate((big_type)val, (big_type)__min_, (big_type)__max_, __ar_type);
+	if(FP_numeric::is_wrapped_type(Ar)) // truncated in base_type: only the sign (or zero) extension is left
+		return __has_sign ? FP_numeric::sign_extension((base_type)val, __total_bits)
+		                : base_type((base_type)val & __number_mask);
+
+	if(FP_numeric::is_signed<type>::value == FP_numeric::is_signed<base_type>::value)
+		return (base_type)FP_numeric::saturate<Ar>((big_type)val, (big_type)__min_, (big_type)__max_);
+
+	// mixed signedness: a negative val is below the unsigned min (0), else the bounds are compared on the unsigned type
+	if(val < type(0))
+	{
+		if(FP_numeric::is_checked_type(Ar))
+			throw std::overflow_error("Fixed point overflow!");
+
+		return __min_;
+	}
+
+	return (base_type)FP_numeric::saturate<Ar>((big_utype)val, big_utype(0), (big_utype)__max_);
 }
 
 // return the __data value of this Fixed_Point_Static with the point set at the new_fract_bits position
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::shift_fract(const size_t new_fract_bits) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Rounding_type R>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::shift_fract(const size_t new_fract_bits) const
 {
-	return FP_numeric::shift_fract(__data, new_fract_bits, __fractional_bits);
+	return FP_numeric::shift_fract<R>(__data, new_fract_bits, __fractional_bits);
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator> (const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator> (const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
-	using comp_type = typename FP_numeric::comp_res_type_d<T, F, To, Fo>::type;
+	using comp_type = typename FP_numeric::comp_res_type_d<T, F, To, Fo, A, Ao>::type;
 	using big_type  = typename comp_type::base_type;
 
 	big_type t_d = FP_numeric::shift_fract(big_type(__data      ), comp_type::Fb, F );
@@ -140,69 +209,71 @@ inline bool Fixed_Point_Static<T,F>::operator> (const Fixed_Point_Static<To, Fo>
 	return (t_d > o_d);
 }
 
-template <size_t T, size_t F>
-template <size_t To>
-inline bool Fixed_Point_Static<T,F>::operator> (const Fixed_Point_Static<To, F >& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator> (const Fixed_Point_Static<To, F , Ao>& o) const
 {
-	using big_type = typename FP_numeric::biggest_type<base_type, typename Fixed_Point_Static<To, F>::base_type>::type;
+	using big_type = typename FP_numeric::comp_res_type_d<T, F, To, F, A, Ao>::type::base_type;
 	return ((big_type)__data > (big_type)o.get_data());
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator< (const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator< (const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
 	return o > *this;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator<=(const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator<=(const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
 	return !(*this > o);
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator>=(const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator>=(const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
 	return !(*this < o);
 }
 
 // TODO : manage risk of overflow
-template <size_t T, size_t F>
+// n is saturated in the quantification (and the signedness) whatever the arithmetic type A: a comparison never wraps
+// nor throws
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator> (const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator> (const type n) const
 {
-	Fixed_Point_Static<T,F> t(n); return *this >  t;
+	__saturated_type t(n); return *this >  t;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator< (const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator< (const type n) const
 {
-	Fixed_Point_Static<T,F> t(n); return *this <  t;
+	__saturated_type t(n); return *this <  t;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator<=(const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator<=(const type n) const
 {
-	Fixed_Point_Static<T,F> t(n); return *this <= t;
+	__saturated_type t(n); return *this <= t;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator>=(const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator>=(const type n) const
 {
-	Fixed_Point_Static<T,F> t(n); return *this >= t;
+	__saturated_type t(n); return *this >= t;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator==(const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator==(const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
-	using comp_type = typename FP_numeric::comp_res_type_d<T, F, To, Fo>::type;
+	using comp_type = typename FP_numeric::comp_res_type_d<T, F, To, Fo, A, Ao>::type;
 	using big_type  = typename comp_type::base_type;
 
 	big_type t_d = FP_numeric::shift_fract(big_type(__data      ), comp_type::Fb, F );
@@ -228,108 +299,109 @@ inline bool Fixed_Point_Static<T,F>::operator==(const Fixed_Point_Static<To, Fo>
 //		return (this_f == o_f);
 }
 
-template <size_t T, size_t F>
-template <size_t To>
-inline bool Fixed_Point_Static<T,F>::operator==(const Fixed_Point_Static<To, F >& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator==(const Fixed_Point_Static<To, F , Ao>& o) const
 {
-	return (__data == o.get_data());
+	using big_type = typename FP_numeric::comp_res_type_d<T, F, To, F, A, Ao>::type::base_type;
+	return ((big_type)__data == (big_type)o.get_data());
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::operator!=(const Fixed_Point_Static<To, Fo>& o) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::operator!=(const Fixed_Point_Static<To, Fo, Ao>& o) const
 {
 	return !(*this == o);
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator==(const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator==(const type n) const
 {
-	Fixed_Point_Static<T, F> t(n); return *this == t;
+	__saturated_type t(n); return *this == t;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline bool Fixed_Point_Static<T,F>::operator!=(const type n) const
+constexpr bool Fixed_Point_Static<T,F,A>::operator!=(const type n) const
 {
-	Fixed_Point_Static<T, F> t(n); return *this != t;
+	__saturated_type t(n); return *this != t;
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::operator! ( ) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::operator! ( ) const
 {
 	return !__data;
 }
 
 // compare the quantification of this Fixed_Point_Static with the given one
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::same_quantification(size_t total_bits, size_t fractional_bits) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::same_quantification(size_t total_bits, size_t fractional_bits) const
 {
 	return (total_bits == __total_bits && fractional_bits == __fractional_bits);
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline bool Fixed_Point_Static<T,F>::same_quantification(const Fixed_Point_Static<To, Fo>& o      ) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr bool Fixed_Point_Static<T,F,A>::same_quantification(const Fixed_Point_Static<To, Fo, Ao>& o      ) const
 {
-	return std::is_same<Fixed_Point_Static<T, F>,Fixed_Point_Static<To, Fo>>::value;
+	return (T == To && F == Fo);
 }
 
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::operator~  ( ) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::operator~  ( ) const
 {
-	Fixed_Point_Static<T,F> t(*this);
+	Fixed_Point_Static<T,F,A> t(*this);
 	t.__data = ~t.__data;
 	return t;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator&= (const Fixed_Point_Static<To, Fo>& n)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator&= (const Fixed_Point_Static<To, Fo, Ao>& n)
 {
 	__data &= n.get_data(); return *this;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator|= (const Fixed_Point_Static<To, Fo>& n)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator|= (const Fixed_Point_Static<To, Fo, Ao>& n)
 {
 	__data |= n.get_data(); return *this;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator^= (const Fixed_Point_Static<To, Fo>& n)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator^= (const Fixed_Point_Static<To, Fo, Ao>& n)
 {
 	__data ^= n.get_data(); return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator&= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator&= (const type n)
 {
 	__data &= (base_type)n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator|= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator|= (const type n)
 {
  	__data |= (base_type)n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator^= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator^= (const type n)
 {
 	__data ^= (base_type)n; return *this;
 }
 
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator>>=(const Fixed_Point_Static<To, Fo>& n)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator>>=(const Fixed_Point_Static<To, Fo, Ao>& n)
 {
 	if(n.is_pos())
 		__data >>=  n.to_int();
@@ -342,9 +414,9 @@ inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator>>=(const Fixed
 	return *this;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator<<=(const Fixed_Point_Static<To, Fo>& n)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator<<=(const Fixed_Point_Static<To, Fo, Ao>& n)
 {
 	if(n.is_pos())
 	{
@@ -358,569 +430,554 @@ inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator<<=(const Fixed
 }
 
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename integral_t>
-inline typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator>>=(const integral_t n)
+constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator>>=(const integral_t n)
 {
 	__data >>= n;
 	return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename integral_t>
-inline typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator<<=(const integral_t n)
+constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator<<=(const integral_t n)
 {
 	__data <<= n; __data = saturate(__data);
 	return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename floating_t>
-inline typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator>>=(const floating_t n)
+constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator>>=(const floating_t n)
 {
 	 *this >>= ((n>0)? (int)n : -(int)n);
 	 return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename floating_t>
-inline typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator<<=(const floating_t n)
+constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator<<=(const floating_t n)
 {
 	 *this <<= ((n>0)? (int)n : -(int)n);
 	 return *this;
 }
 
-template <size_t T, size_t F>
-inline const Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator+ () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr const Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator+ () const
 {
 	return *this;
 }
 
-template <size_t T, size_t F>
-inline       Fixed_Point_Static<T,F>  Fixed_Point_Static<T,F>::operator- () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr       Fixed_Point_Static<T,F,A>  Fixed_Point_Static<T,F,A>::operator- () const
 {
-	Fixed_Point_Static<T,F> t(*this);
-	t.__data = -t.__data;
+	Fixed_Point_Static<T,F,A> t(*this);
+	if(FP_numeric::is_wrapped_type(A)) // -min() is wrapped at min() (negated on the unsigned type)
+		t.__data = saturate(base_type(__ubase_type(0) - __ubase_type(t.__data)));
+	else if(!__has_sign) // the opposite of a strictly positive unsigned number is below min: saturated at 0 or checked
+	{
+		if(FP_numeric::is_checked_type(A) && __data)
+			throw std::overflow_error("Fixed point overflow!");
+
+		t.__data = base_type(0);
+	}
+	else
+		t.__data = -t.__data;
 	return t;
 }
 
 // if __total_bits is null then takes the quantification of the result of the operation
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator++ (   )
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator++ (   )
 {
 	*this += one(); return *this;
 }
 
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator-- (   )
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator-- (   )
 {
 	*this -= one(); return *this;
 }
 
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator++ (int)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::operator++ (int)
 {
-	*this += one(); return *this;
+	const Fixed_Point_Static<T,F,A> old = *this;
+	*this += one();
+	return old;
 }
 
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator-- (int)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::operator-- (int)
 {
-	*this -= one(); return *this;
+	const Fixed_Point_Static<T,F,A> old = *this;
+	*this -= one();
+	return old;
 }
 
 // if __total_bits is null then takes the quantification of the result of the operation
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator+= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator+= (const type n)
 {
 	*this = (*this)+n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator-= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator-= (const type n)
 {
 	*this = (*this)-n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator*= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator*= (const type n)
 {
 	*this = (*this)*n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator/= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator/= (const type n)
 {
 	*this = (*this)/n; return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline Fixed_Point_Static<T,F>& Fixed_Point_Static<T,F>::operator%= (const type n)
+constexpr Fixed_Point_Static<T,F,A>& Fixed_Point_Static<T,F,A>::operator%= (const type n)
 {
 	*this = (*this)%n; return *this;
 }
 
 
 // check if this fixed point is (positive or null) or is (strictly positive)
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_pos () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_pos () const
 {
 	return ( *this >= 0);
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_spos() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_spos() const
 {
 	return ( *this >  0);
 }
 
 
 // check if this fixed point is (negative or null) or (strictly negative)
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_neg () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_neg () const
 {
 	return ( *this <= 0);
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_sneg() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_sneg() const
 {
 	return ( *this <  0);
 }
 
 // check if this fixed point equals zero, or one, or if it's saturated at max or min
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_zero() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_zero() const
 {
 	return   __data ==   0  ;
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_one () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_one () const
 {
 	return   __data == __one;
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_min () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_min () const
 {
 	return   __data == __min_;
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_max () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_max () const
 {
 	return   __data == __max_;
 }
 
-template <size_t T, size_t F>
-inline bool Fixed_Point_Static<T,F>::is_sat () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr bool Fixed_Point_Static<T,F,A>::is_sat () const
 {
 	return is_max() || is_min();
 }
 
-template <size_t T, size_t F>
-inline Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::abs () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::abs () const
 {
 	return is_sneg() ? -(*this) : *this;
 }
 
-template <size_t T, size_t F>
-inline int Fixed_Point_Static<T,F>::sign() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr int Fixed_Point_Static<T,F,A>::sign() const
 {
 	return is_sneg() ? -1 : 0;
 }
 
 
 //convert properly __data taking into account the comma position
-template <size_t T, size_t F>
-template <typename uintegral_t>
-inline typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
-Fixed_Point_Static<T,F>::convert() const // to unsigned integer
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <typename uintegral_t, FP_numeric::Rounding_type R>
+constexpr typename std::enable_if< std::is_integral<uintegral_t>::value && std::is_unsigned<uintegral_t>::value, uintegral_t>::type
+Fixed_Point_Static<T,F,A>::convert() const // to unsigned integer
 {
-	base_type temp;
-
-	if(__data & (__one >> 1)) // check the most significant fractional bit is 1
-		temp = ((saturate(__data + __one) & __number_mask) >> __fractional_bits); // rounded upper
-
-	else // if the most significant fractional bit is 0 or if fractional part size is null
-		temp = ((__data & __number_mask) >> __fractional_bits); // rounded lower
+	// the rounding can not overflow base_type (at least one bit is dropped, or none is); the integer part of a signed
+	// number is read as its unsigned T-F bits (its sign bit included) like its raw bits would be
+	const base_type temp = FP_numeric::shift_fract<R>(__data, 0, __fractional_bits)
+	                     & (__has_sign ? FP_numeric::low_mask<base_type>(__total_bits - __fractional_bits) : base_type(~base_type(0)));
 
-	if(sizeof(uintegral_t) < sizeof(base_type))
-		return (uintegral_t)FP_numeric::saturate_max(temp, (base_type)std::numeric_limits<uintegral_t>::max(), FP_numeric::Arithmetic_type::SIGNED_SATURATED);
-
-	else
-		return (uintegral_t)temp;
+	return FP_numeric::saturate_cast<uintegral_t>(temp);
 }
 
-template <size_t T, size_t F>
-template <typename sintegral_t>
-inline typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
-Fixed_Point_Static<T,F>::convert() const // to signed integer
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <typename sintegral_t, FP_numeric::Rounding_type R>
+constexpr typename std::enable_if< std::is_integral<sintegral_t>::value && std::is_signed<sintegral_t>::value, sintegral_t>::type
+Fixed_Point_Static<T,F,A>::convert() const // to signed integer
 {
-	base_type temp;
-
-	if(__data & (__one >> 1)) // check the most significant fractional bit is 1
-		temp = (saturate(__data + __one) >> __fractional_bits); // rounded upper
-	else // if the most significant fractional bit is 0 or if fractional part size is null
-		temp = (__data >> __fractional_bits); // rounded lower
-
-	if(sizeof(sintegral_t) < sizeof(base_type))
-		return (sintegral_t)FP_numeric::saturate(temp, (base_type)std::numeric_limits<sintegral_t>::min(), (base_type)std::numeric_limits<sintegral_t>::max(), FP_numeric::Arithmetic_type::SIGNED_SATURATED);
-
-	else
-		return (sintegral_t)temp;
+	return FP_numeric::saturate_cast<sintegral_t>(FP_numeric::shift_fract<R>(__data, 0, __fractional_bits));
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename floating_t>
-inline typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
-Fixed_Point_Static<T,F>::convert() const // to floating point number
+constexpr typename std::enable_if< std::is_floating_point<floating_t>::value, floating_t>::type
+Fixed_Point_Static<T,F,A>::convert() const // to floating point number
 {
-	return static_cast<floating_t>(__data) / static_cast<floating_t>(__one);
+	return static_cast<floating_t>(__data) / FP_numeric::exp2i<floating_t>(__fractional_bits);
 }
 
 // directly cast __data to the given type
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline type Fixed_Point_Static<T,F>::cast() const
+constexpr type Fixed_Point_Static<T,F,A>::cast() const
 {
 	return (type)__data;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-Fixed_Point_Static<T,F>::operator type() const // static cast
+constexpr Fixed_Point_Static<T,F,A>::operator type() const // static cast
 {
 	return cast<type>();
 }
 
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::to_raw   () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::to_raw   () const
 {
 	return __data;
 }
 
-template <size_t T, size_t F>
-inline   int32_t Fixed_Point_Static<T,F>::to_int() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr   int32_t Fixed_Point_Static<T,F,A>::to_int() const
 {
 	return convert< int32_t>();
 }
 
-template <size_t T, size_t F>
-inline  uint32_t Fixed_Point_Static<T,F>::to_uint() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr  uint32_t Fixed_Point_Static<T,F,A>::to_uint() const
 {
 	return convert<uint32_t>();
 }
 
-template <size_t T, size_t F>
-inline   int64_t Fixed_Point_Static<T,F>::to_lint() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr   int64_t Fixed_Point_Static<T,F,A>::to_lint() const
 {
 	return convert< int64_t>();
 }
 
-template <size_t T, size_t F>
-inline  uint64_t Fixed_Point_Static<T,F>::to_luint() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr  uint64_t Fixed_Point_Static<T,F,A>::to_luint() const
 {
 	return convert<uint64_t>();
 }
 
-template <size_t T, size_t F>
-inline     float Fixed_Point_Static<T,F>::to_float() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr     float Fixed_Point_Static<T,F,A>::to_float() const
 {
 	return convert<   float>();
 }
 
-template <size_t T, size_t F>
-inline    double Fixed_Point_Static<T,F>::to_double() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr    double Fixed_Point_Static<T,F,A>::to_double() const
 {
 	return convert<  double>();
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::to_bin() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::to_bin() const
 {
 	return FP_numeric::to_bin(__data);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::to_sbin() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::to_sbin() const
 {
 	return FP_numeric::to_bin(__data, __total_bits);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::to_hex() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::to_hex() const
 {
 	return FP_numeric::to_hex(__data);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::to_shex() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::to_shex() const
 {
 	return FP_numeric::to_hex(__data, __total_bits);
 }
 
-template <size_t T, size_t F>
-inline size_t Fixed_Point_Static<T,F>::get_integer_bits() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr size_t Fixed_Point_Static<T,F,A>::get_integer_bits() const
 {
 	return __integer_bits;
 }
 
-template <size_t T, size_t F>
-inline size_t Fixed_Point_Static<T,F>::get_fractional_bits() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr size_t Fixed_Point_Static<T,F,A>::get_fractional_bits() const
 {
 	return __fractional_bits;
 }
 
-template <size_t T, size_t F>
-inline size_t Fixed_Point_Static<T,F>::get_total_bits() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr size_t Fixed_Point_Static<T,F,A>::get_total_bits() const
 {
 	return __total_bits;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_number_mask() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_number_mask() const
 {
 	return __number_mask;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_fractional_mask() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_fractional_mask() const
 {
 	return __fractional_mask;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_integer_mask   () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_integer_mask   () const
 {
 	return __integer_mask;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_one            () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_one            () const
 {
 	return __one;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_max            () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_max            () const
 {
 	return __max_;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_min            () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_min            () const
 {
 	return __min_;
 }
 
-template <size_t T, size_t F>
-inline typename Fixed_Point_Static<T,F>::base_type Fixed_Point_Static<T,F>::get_data           () const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr typename Fixed_Point_Static<T,F,A>::base_type Fixed_Point_Static<T,F,A>::get_data           () const
 {
 	return __data;
 }
 
-template <size_t T, size_t F>
-inline FP_numeric::Arithmetic_type Fixed_Point_Static<T,F>::get_arithmetic_type() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr FP_numeric::Arithmetic_type Fixed_Point_Static<T,F,A>::get_arithmetic_type() const
 {
 	return __ar_type;
 }
 
 
-template <size_t T, size_t F>
-constexpr Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::min ()
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::min ()
 {
-	Fixed_Point_Static<T,F> min;
+	Fixed_Point_Static<T,F,A> min;
 	min.set_data(__min_);
 	return min;
 }
 
-template <size_t T, size_t F>
-constexpr Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::max ()
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::max ()
 {
-	Fixed_Point_Static<T,F> max;
+	Fixed_Point_Static<T,F,A> max;
 	max.set_data(__max_);
 	return max;
 }
 
-template <size_t T, size_t F>
-constexpr Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::one ()
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::one ()
 {
-	Fixed_Point_Static<T,F> one;
+	Fixed_Point_Static<T,F,A> one;
 	one.set_data(__one);
 	return one;
 }
 
-template <size_t T, size_t F>
-constexpr Fixed_Point_Static<T,F> Fixed_Point_Static<T,F>::zero()
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr Fixed_Point_Static<T,F,A> Fixed_Point_Static<T,F,A>::zero()
 {
-	Fixed_Point_Static<T,F> zero;
-	zero.set_data((Fixed_Point_Static<T,F>::base_type)0);
+	Fixed_Point_Static<T,F,A> zero;
+	zero.set_data((Fixed_Point_Static<T,F,A>::base_type)0);
 	return zero;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename integral_t>
-inline typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator=(const integral_t& o)
+constexpr typename std::enable_if <std::is_integral<integral_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator=(const integral_t& o)
 {
 	using temp_type = typename FP_numeric::next_type<integral_t>::type;
 	// Warning: if temp_type is same size as integral_t then there is a risk of overflow
 
-	temp_type temp = (temp_type)o << __fractional_bits;
+	temp_type temp = FP_numeric::shift_fract((temp_type)o, __fractional_bits, 0);
 
 	__data = saturate(temp);
 	return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename floating_t>
-inline typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>>::type&
-Fixed_Point_Static<T,F>::operator=(const floating_t& o)
+constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator=(const floating_t& o)
 {
-	using temp_type = typename FP_numeric::next_type<floating_t>::type;
-	// Warning: if temp_type is same size as floating_t then there is a risk of overflow
-
-	temp_type cast = static_cast<temp_type> (o * (__one<<1));
-	cast = (cast >> 1) + (cast & (temp_type)1);
-
-	__data = saturate(cast);
+	change_data(o, __total_bits, __fractional_bits);
 	return *this;
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline Fixed_Point_Static<T,F>&
-Fixed_Point_Static<T,F>::operator=(const Fixed_Point_Static<To,Fo>& o)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr Fixed_Point_Static<T,F,A>&
+Fixed_Point_Static<T,F,A>::operator=(const Fixed_Point_Static<To,Fo,Ao>& o)
 {
 	change_data(o);
 	return *this;
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <typename expression_t>
+constexpr typename std::enable_if <FP_numeric::is_expression<expression_t>::value, Fixed_Point_Static<T,F,A>>::type&
+Fixed_Point_Static<T,F,A>::operator=(const expression_t& e)
+{
+	change_data(e.eval());
+	return *this;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename type>
-inline void
-Fixed_Point_Static<T,F>::change_data(const type data)
+constexpr void
+Fixed_Point_Static<T,F,A>::change_data(const type data)
 {
 	*this = data;
 }
 
-template <size_t T, size_t F>
-template <typename integral_t>
-inline typename std::enable_if <std::is_integral<integral_t>::value, void>::type
-Fixed_Point_Static<T,F>::change_data(integral_t data, size_t data_total_bits, size_t data_fractional_bits)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Rounding_type R, typename integral_t>
+constexpr typename std::enable_if <FP_numeric::is_integral<integral_t>::value, void>::type
+Fixed_Point_Static<T,F,A>::change_data(integral_t data, size_t data_total_bits, size_t data_fractional_bits)
 {
-	using temp_type = typename FP_numeric::next_type<integral_t>::type;
-	using big_type  = typename FP_numeric::biggest_type<temp_type, base_type>::type;
+	// an unsigned data (the raw of an unsigned Fixed_Point_Static) is never extended with a sign
+	using temp_type = typename std::conditional<(!FP_numeric::is_signed<integral_t>::value && sizeof(integral_t) >= sizeof(uint64_t))
+	                                            || (sizeof(integral_t) > sizeof(uint64_t)), // no built-in type above a double word
+	                                            integral_t, typename FP_numeric::next_type<integral_t>::type>::type;
 	// Warning: if temp_type is same size as integral_t then there is a risk of overflow
 
-	data = FP_numeric::sign_extension(data, data_total_bits);
+	if(FP_numeric::is_signed<integral_t>::value)
+		data = FP_numeric::sign_extension(data, data_total_bits);
 
-	temp_type temp = data;
-	if(data < 0)
-		temp = -temp;
+	// resize fractional part (the dropped bits are rounded without any branch)
+	const temp_type temp = FP_numeric::shift_fract<R>((temp_type)data, __fractional_bits, data_fractional_bits);
 
-	if(data_fractional_bits != __fractional_bits)
-		temp = FP_numeric::shift_fract(temp, __fractional_bits, data_fractional_bits); // resize fractional part
-
-	// here temp is >= 0
-	__data = (base_type)FP_numeric::saturate_max((big_type)temp, (big_type)__max_, FP_numeric::Arithmetic_type::SIGNED_SATURATED);
-
-	if(data < 0)
-		__data = -__data;
+	__data = saturate(temp);
 }
 
-template <size_t T, size_t F>
-template <typename floating_t>
-inline typename std::enable_if <std::is_floating_point<floating_t>::value, void>::type&
-Fixed_Point_Static<T,F>::change_data(const floating_t data, size_t data_total_bits, size_t data_fractional_bits)
+// the floating point data is already a real value: its quantification is the one of this Fixed_Point_Static
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Rounding_type R, typename floating_t>
+constexpr typename std::enable_if <std::is_floating_point<floating_t>::value, void>::type
+Fixed_Point_Static<T,F,A>::change_data(const floating_t data, size_t data_total_bits, size_t data_fractional_bits)
 {
-	*this = data;
+	// 2*data on T+2 bits when it does not hold in the built-in temporary (the double_word and multi_word base_type)
+	using temp_type = typename std::conditional<(T + 2 > 64), typename FP_numeric::matching_type<T + 2>::type,
+	                                            typename FP_numeric::next_type<floating_t>::type>::type;
+	// Warning: if temp_type is same size as floating_t then there is a risk of overflow
+	// 2^F is scaled in double when it is above the float range (F >= 128)
+	using scale_type = typename std::conditional<(F >= 128 && sizeof(floating_t) < sizeof(double)), double, floating_t>::type;
+
+	__data = saturate(FP_numeric::round_float<R, temp_type>(data * FP_numeric::exp2i<scale_type>(__fractional_bits)));
 }
 
-template <size_t T, size_t F>
-inline void Fixed_Point_Static<T,F>::change_data(const Fixed_Point_Static<T ,F >& o)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+constexpr void Fixed_Point_Static<T,F,A>::change_data(const Fixed_Point_Static<T ,F ,A >& o)
 {
 	__data = o.get_data();
 }
 
-template <size_t T, size_t F>
-template <size_t To>
-inline void Fixed_Point_Static<T,F>::change_data(const Fixed_Point_Static<To,F >& o)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Rounding_type R, size_t To, FP_numeric::Arithmetic_type Ao>
+constexpr void Fixed_Point_Static<T,F,A>::change_data(const Fixed_Point_Static<To,F ,Ao>& o)
 {
-	using big_type = typename FP_numeric::biggest_type<base_type, typename Fixed_Point_Static<To,F>::base_type>::type;
-
-	__data = (base_type)FP_numeric::saturate((big_type)o.get_data(),
-	                                         (big_type)__min_,
-	                                         (big_type)__max_,
-	                                         FP_numeric::Arithmetic_type::SIGNED_SATURATED);
+	__data = saturate(o.get_data());
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline void Fixed_Point_Static<T,F>::change_data(const Fixed_Point_Static<To,Fo>& o)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <FP_numeric::Rounding_type R, size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr void Fixed_Point_Static<T,F,A>::change_data(const Fixed_Point_Static<To,Fo,Ao>& o)
 {
-	change_data(o.get_data(), To, Fo);
+	change_data<R>(o.get_data(), To, Fo);
 }
 
-template <size_t T, size_t F>
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
 template <typename integer_t>
-inline void Fixed_Point_Static<T,F>::set_data(integer_t data)
+constexpr void Fixed_Point_Static<T,F,A>::set_data(integer_t data)
 {
-	__data = FP_numeric::sign_extension((base_type)data, __total_bits);
+	__data = __has_sign ? FP_numeric::sign_extension((base_type)data, __total_bits)
+	                  : base_type((base_type)data & __number_mask);
 }
 
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline void Fixed_Point_Static<T,F>::set_data(const Fixed_Point_Static<To, Fo>& o)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+template <size_t To, size_t Fo, FP_numeric::Arithmetic_type Ao>
+constexpr void Fixed_Point_Static<T,F,A>::set_data(const Fixed_Point_Static<To, Fo, Ao>& o)
 {
 	set_data(o.get_data());
 }
 
-template <size_t T, size_t F>
-inline void Fixed_Point_Static<T,F>::set_arithmetic_type(FP_numeric::Arithmetic_type ar_type)
-{
-	__ar_type = ar_type;
-}
-
-template <size_t T, size_t F>
-template <size_t To, size_t Fo>
-inline void Fixed_Point_Static<T,F>::set_arithmetic_type(const Fixed_Point_Static<To, Fo>& o)
-{
-	set_arithmetic_type(o.get_arithmetic_type());
-}
-
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::display(int precision) const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::display(int precision) const
 {
 	return FP_numeric::display(*this, precision);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::display_quantification() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::display_quantification() const
 {
 	return FP_numeric::display_quantification(*this);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::resume() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::resume() const
 {
 	return FP_numeric::resume(*this);
 }
 
-template <size_t T, size_t F>
-inline std::string Fixed_Point_Static<T,F>::short_resume() const
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::string Fixed_Point_Static<T,F,A>::short_resume() const
 {
 	return FP_numeric::short_resume(*this);
 }
@@ -0,0 +1,71 @@
+#ifndef FIXED_POINT_STATIC_ACCUMULATOR_HPP_
+#define FIXED_POINT_STATIC_ACCUMULATOR_HPP_
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Multiply-accumulate register with guard bits ***********************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// DSP accumulator: the products (or values) of T bits with F fractional bits are summed exactly in a register of
+	// T+N bits, the N guard bits allow 2^N accumulations without overflow (beyond that the behavior is undefined).
+	// Nothing is rounded nor saturated while accumulating: it is done only once, when result<To,Fo>() is called.
+	template <size_t T, size_t F, size_t N>
+	class accumulator
+	{
+	public:
+		using value_type = Fixed_Point_Static<T+N, F>; // full precision register (static_assert if more than 64/128 bits)
+		using base_type  = typename value_type::base_type;
+
+		static const size_t Tb = T;
+		static const size_t Fb = F;
+		static const size_t Gb = N; // guard bits
+
+	private:
+		base_type __data;
+
+	public: // constructors
+		constexpr accumulator();
+
+		// start the accumulation with the value x (exact, as add)
+		template <size_t Tx, size_t Fx> constexpr explicit accumulator(const Fixed_Point_Static<Tx, Fx>& x);
+
+	public: // accumulation
+		// accumulate the exact product a*b: it must fit in T bits with F fractional bits (checked at compile time)
+		template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+		constexpr accumulator& mac(const Fixed_Point_Static<Tl, Fl>& a, const Fixed_Point_Static<Tr, Fr>& b);
+
+		// subtract the exact product a*b
+		template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+		constexpr accumulator& msu(const Fixed_Point_Static<Tl, Fl>& a, const Fixed_Point_Static<Tr, Fr>& b);
+
+		// accumulate or subtract the exact value x: it must fit in T bits with F fractional bits
+		template <size_t Tx, size_t Fx> constexpr accumulator& add(const Fixed_Point_Static<Tx, Fx>& x);
+		template <size_t Tx, size_t Fx> constexpr accumulator& sub(const Fixed_Point_Static<Tx, Fx>& x);
+
+		// accumulate the register of another accumulator of the same quantification
+		constexpr accumulator& add(const accumulator& o);
+
+		constexpr void reset();
+
+	public: // results
+		// return the accumulated value rounded in function of R (by default to the nearest with the ties rounded up, as
+		// operator=(floating_t) and convert()) then saturated in the Fixed_Point_Static<To,Fo> quantification
+		template <size_t To, size_t Fo, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP>
+		constexpr Fixed_Point_Static<To, Fo> result() const;
+
+		// return the full precision accumulated value
+		constexpr value_type value () const;
+		constexpr base_type  to_raw() const;
+
+	private:
+		// return the raw value x aligned on F fractional bits, after the checks that it fits in T bits
+		template <size_t Tx, size_t Fx, typename type> static constexpr base_type align(type x);
+	};
+}
+
+#include "Fixed_Point_Static_accumulator.hxx"
+
+#endif /* FIXED_POINT_STATIC_ACCUMULATOR_HPP_ */
@@ -0,0 +1,129 @@
+#ifndef FIXED_POINT_STATIC_ACCUMULATOR_HXX_
+#define FIXED_POINT_STATIC_ACCUMULATOR_HXX_
+
+#include "Fixed_Point_Static_accumulator.hpp"
+
+template <size_t T, size_t F, size_t N>
+constexpr FP_numeric::accumulator<T,F,N>::accumulator()
+: __data(0)
+{
+}
+
+template <size_t T, size_t F, size_t N>
+template <size_t Tx, size_t Fx>
+constexpr FP_numeric::accumulator<T,F,N>::accumulator(const Fixed_Point_Static<Tx, Fx>& x)
+: __data(align<Tx, Fx>(x.get_data()))
+{
+}
+
+// the shift amount is known at compile time: the product is moved on F fractional bits without loss
+template <size_t T, size_t F, size_t N>
+template <size_t Tx, size_t Fx, typename type>
+constexpr typename FP_numeric::accumulator<T,F,N>::base_type FP_numeric::accumulator<T,F,N>::align(type x)
+{
+	static_assert(Fx <= F,          "Error in accumulator : the accumulated value has more fractional bits than F!");
+	static_assert(Tx - Fx <= T - F, "Error in accumulator : the accumulated value has more integer bits than T - F!");
+
+	return FP_numeric::shift_fract((base_type)x, F, Fx);
+}
+
+template <size_t T, size_t F, size_t N>
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+constexpr FP_numeric::accumulator<T,F,N>& FP_numeric::accumulator<T,F,N>::mac(const Fixed_Point_Static<Tl, Fl>& a, const Fixed_Point_Static<Tr, Fr>& b)
+{
+	using mul_type = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using mul_base = typename mul_type::base_type;
+
+	__data += align<mul_type::Tb, mul_type::Fb>((mul_base)a.get_data() * (mul_base)b.get_data());
+	return *this;
+}
+
+template <size_t T, size_t F, size_t N>
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+constexpr FP_numeric::accumulator<T,F,N>& FP_numeric::accumulator<T,F,N>::msu(const Fixed_Point_Static<Tl, Fl>& a, const Fixed_Point_Static<Tr, Fr>& b)
+{
+	using mul_type = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using mul_base = typename mul_type::base_type;
+
+	__data -= align<mul_type::Tb, mul_type::Fb>((mul_base)a.get_data() * (mul_base)b.get_data());
+	return *this;
+}
+
+template <size_t T, size_t F, size_t N>
+template <size_t Tx, size_t Fx>
+constexpr FP_numeric::accumulator<T,F,N>& FP_numeric::accumulator<T,F,N>::add(const Fixed_Point_Static<Tx, Fx>& x)
+{
+	__data += align<Tx, Fx>(x.get_data());
+	return *this;
+}
+
+template <size_t T, size_t F, size_t N>
+template <size_t Tx, size_t Fx>
+constexpr FP_numeric::accumulator<T,F,N>& FP_numeric::accumulator<T,F,N>::sub(const Fixed_Point_Static<Tx, Fx>& x)
+{
+	__data -= align<Tx, Fx>(x.get_data());
+	return *this;
+}
+
+template <size_t T, size_t F, size_t N>
+constexpr FP_numeric::accumulator<T,F,N>& FP_numeric::accumulator<T,F,N>::add(const accumulator& o)
+{
+	__data += o.__data;
+	return *this;
+}
+
+template <size_t T, size_t F, size_t N>
+constexpr void FP_numeric::accumulator<T,F,N>::reset()
+{
+	__data = 0;
+}
+
+// less fractional bits: the dropped bits are rounded in function of R by round_shift (at most one is added to the
+// shifted register), so the register can not overflow. More fractional bits: the register is saturated before the
+// shift, so it can not either.
+template <size_t T, size_t F, size_t N>
+template <size_t To, size_t Fo, FP_numeric::Rounding_type R>
+constexpr Fixed_Point_Static<To, Fo> FP_numeric::accumulator<T,F,N>::result() const
+{
+	using res_type = Fixed_Point_Static<To, Fo>;
+	using big_type = typename FP_numeric::biggest_type<base_type, typename res_type::base_type>::type;
+
+	const size_t shift = (F > Fo) ? F - Fo : Fo - F;
+
+	res_type res;
+	if (F > Fo)
+	{
+		base_type temp = FP_numeric::round_shift<R>(__data, shift);
+		res.set_data(res.saturate(temp));
+	}
+	else
+	{
+		const big_type max = (big_type)res_type::max().get_data() >> shift;
+		big_type temp = (big_type)__data;
+
+		if (temp > max)
+			res = res_type::max();
+		else if (temp < -max)
+			res = res_type::min();
+		else
+			res.set_data(FP_numeric::shift_fract(temp, Fo, F));
+	}
+
+	return res;
+}
+
+template <size_t T, size_t F, size_t N>
+constexpr typename FP_numeric::accumulator<T,F,N>::value_type FP_numeric::accumulator<T,F,N>::value() const
+{
+	value_type res;
+	res.set_data(__data);
+	return res;
+}
+
+template <size_t T, size_t F, size_t N>
+constexpr typename FP_numeric::accumulator<T,F,N>::base_type FP_numeric::accumulator<T,F,N>::to_raw() const
+{
+	return __data;
+}
+
+#endif /* FIXED_POINT_STATIC_ACCUMULATOR_HXX_ */
@@ -0,0 +1,142 @@
+#ifndef FIXED_POINT_STATIC_ARRAY_HPP_
+#define FIXED_POINT_STATIC_ARRAY_HPP_
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <initializer_list>
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// Allocator of aligned memory ****************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// allocate memory aligned on Align bytes: a cache line by default, which is also enough for any SIMD vector
+	template <typename U, size_t Align = 64>
+	struct aligned_allocator
+	{
+		static_assert(Align >= alignof(void*) && (Align & (Align - 1)) == 0,
+		              "Error in aligned_allocator : Align is not a power of 2 at least aligned as a pointer!");
+
+		using value_type = U;
+
+		static const size_t alignment = Align;
+
+		template <typename V>
+		struct rebind
+		{
+			using other = aligned_allocator<V, Align>;
+		};
+
+		aligned_allocator() noexcept = default;
+		template <typename V> aligned_allocator(const aligned_allocator<V, Align>&) noexcept {}
+
+		U*   allocate  (size_t n);
+		void deallocate(U* p, size_t n) noexcept;
+	};
+
+	template <typename U, typename V, size_t Align>
+	bool operator==(const aligned_allocator<U, Align>&, const aligned_allocator<V, Align>&) noexcept;
+
+	template <typename U, typename V, size_t Align>
+	bool operator!=(const aligned_allocator<U, Align>&, const aligned_allocator<V, Align>&) noexcept;
+}
+
+/// ********************************************************************************************************************
+/// FP_array class *****************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// contiguous array of Fixed_Point_Static<T,F> stored as raw base_type words (no padding) in memory aligned by the
+	// allocator, so it can be given as is to the batch kernels, memcpy'd or mapped for I/O
+	// Elements are accessed as Fixed_Point_Static<T,F> values or references
+	template <size_t T, size_t F, typename Allocator = FP_numeric::aligned_allocator<Fixed_Point_Static<T,F>>>
+	class FP_array
+	{
+	public:
+		using value_type      = Fixed_Point_Static<T,F>;
+		using base_type       = typename value_type::base_type;
+		using allocator_type  = Allocator;
+		using size_type       = size_t;
+		using reference       =       value_type&;
+		using const_reference = const value_type&;
+		using pointer         =       value_type*;
+		using const_pointer   = const value_type*;
+		using iterator        =       value_type*;
+		using const_iterator  = const value_type*;
+
+		static_assert(FP_numeric::has_raw_layout<value_type>::value, "Error in FP_array : the layout is not the one of base_type!");
+
+	private:
+		std::vector<value_type, Allocator> __data;
+
+	public: // constructors
+		explicit FP_array(const Allocator& alloc = Allocator());
+		explicit FP_array(size_type n, const Allocator& alloc = Allocator());
+		         FP_array(size_type n, const value_type& value, const Allocator& alloc = Allocator());
+		         FP_array(std::initializer_list<value_type> values, const Allocator& alloc = Allocator());
+
+		// convert the n floating points of first with FP_numeric::convert_n
+		template <typename floating_t>
+		FP_array(const floating_t* first, size_type n, const Allocator& alloc = Allocator(),
+		         typename std::enable_if<std::is_floating_point<floating_t>::value, bool>::type = 0);
+
+	public: // capacity
+		size_type size    () const;
+		size_type capacity() const;
+		bool      empty   () const;
+
+		void reserve(size_type n);
+		void resize (size_type n);
+		void resize (size_type n, const value_type& value);
+		void clear  ();
+		void shrink_to_fit();
+
+	public: // modifiers
+		void push_back(const value_type& value);
+		void pop_back ();
+
+		template <typename floating_t>
+		typename std::enable_if<std::is_floating_point<floating_t>::value, void>::type
+		assign(const floating_t* first, size_type n); // convert with FP_numeric::convert_n
+
+		void swap(FP_array& o);
+
+	public: // element access
+		      reference operator[](size_type i);
+		const_reference operator[](size_type i) const;
+		      reference at        (size_type i); // throw std::out_of_range
+		const_reference at        (size_type i) const;
+
+		      reference front();
+		const_reference front() const;
+		      reference back ();
+		const_reference back () const;
+
+		      pointer   data ();
+		const_pointer   data () const;
+
+		// the raw base_type words of the fixed points
+		      base_type* raw ();
+		const base_type* raw () const;
+
+		allocator_type get_allocator() const;
+
+	public: // iterators
+		      iterator begin ();
+		const_iterator begin () const;
+		      iterator end   ();
+		const_iterator end   () const;
+		const_iterator cbegin() const;
+		const_iterator cend  () const;
+	};
+}
+
+#include "Fixed_Point_Static_array.hxx"
+
+#endif /* FIXED_POINT_STATIC_ARRAY_HPP_ */
@@ -0,0 +1,272 @@
+#ifndef FIXED_POINT_STATIC_ARRAY_HXX_
+#define FIXED_POINT_STATIC_ARRAY_HXX_
+
+#include "Fixed_Point_Static_array.hpp"
+
+/// ********************************************************************************************************************
+/// Allocator of aligned memory ****************************************************************************************
+/// ********************************************************************************************************************
+
+// the block is over allocated by Align bytes: the pointer returned by malloc is saved just before the aligned one
+template <typename U, size_t Align>
+U* FP_numeric::aligned_allocator<U, Align>::allocate(size_t n)
+{
+	if(n > (std::numeric_limits<size_t>::max() - Align) / sizeof(U))
+		throw std::bad_alloc();
+
+	void* block = std::malloc(n * sizeof(U) + Align);
+	if(!block)
+		throw std::bad_alloc();
+
+	uintptr_t aligned = (reinterpret_cast<uintptr_t>(block) + Align) & ~(uintptr_t)(Align - 1);
+	reinterpret_cast<void**>(aligned)[-1] = block;
+
+	return reinterpret_cast<U*>(aligned);
+}
+
+template <typename U, size_t Align>
+void FP_numeric::aligned_allocator<U, Align>::deallocate(U* p, size_t) noexcept
+{
+	if(p)
+		std::free(reinterpret_cast<void**>(p)[-1]);
+}
+
+template <typename U, typename V, size_t Align>
+bool FP_numeric::operator==(const aligned_allocator<U, Align>&, const aligned_allocator<V, Align>&) noexcept
+{
+	return true;
+}
+
+template <typename U, typename V, size_t Align>
+bool FP_numeric::operator!=(const aligned_allocator<U, Align>&, const aligned_allocator<V, Align>&) noexcept
+{
+	return false;
+}
+
+/// ********************************************************************************************************************
+/// FP_array class *****************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F, typename Allocator>
+FP_numeric::FP_array<T,F,Allocator>::FP_array(const Allocator& alloc)
+: __data(alloc)
+{
+}
+
+template <size_t T, size_t F, typename Allocator>
+FP_numeric::FP_array<T,F,Allocator>::FP_array(size_type n, const Allocator& alloc)
+: __data(n, value_type(), alloc)
+{
+}
+
+template <size_t T, size_t F, typename Allocator>
+FP_numeric::FP_array<T,F,Allocator>::FP_array(size_type n, const value_type& value, const Allocator& alloc)
+: __data(n, value, alloc)
+{
+}
+
+template <size_t T, size_t F, typename Allocator>
+FP_numeric::FP_array<T,F,Allocator>::FP_array(std::initializer_list<value_type> values, const Allocator& alloc)
+: __data(values, alloc)
+{
+}
+
+template <size_t T, size_t F, typename Allocator>
+template <typename floating_t>
+FP_numeric::FP_array<T,F,Allocator>::FP_array(const floating_t* first, size_type n, const Allocator& alloc,
+	typename std::enable_if<std::is_floating_point<floating_t>::value, bool>::type)
+: __data(alloc)
+{
+	assign(first, n);
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::size_type FP_numeric::FP_array<T,F,Allocator>::size() const
+{
+	return __data.size();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::size_type FP_numeric::FP_array<T,F,Allocator>::capacity() const
+{
+	return __data.capacity();
+}
+
+template <size_t T, size_t F, typename Allocator>
+bool FP_numeric::FP_array<T,F,Allocator>::empty() const
+{
+	return __data.empty();
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::reserve(size_type n)
+{
+	__data.reserve(n);
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::resize(size_type n)
+{
+	__data.resize(n);
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::resize(size_type n, const value_type& value)
+{
+	__data.resize(n, value);
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::clear()
+{
+	__data.clear();
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::shrink_to_fit()
+{
+	__data.shrink_to_fit();
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::push_back(const value_type& value)
+{
+	__data.push_back(value);
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::pop_back()
+{
+	__data.pop_back();
+}
+
+template <size_t T, size_t F, typename Allocator>
+template <typename floating_t>
+typename std::enable_if<std::is_floating_point<floating_t>::value, void>::type
+FP_numeric::FP_array<T,F,Allocator>::assign(const floating_t* first, size_type n)
+{
+	__data.resize(n);
+	FP_numeric::convert_n(first, n, __data.data());
+}
+
+template <size_t T, size_t F, typename Allocator>
+void FP_numeric::FP_array<T,F,Allocator>::swap(FP_array& o)
+{
+	__data.swap(o.__data);
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::reference FP_numeric::FP_array<T,F,Allocator>::operator[](size_type i)
+{
+	return __data[i];
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_reference FP_numeric::FP_array<T,F,Allocator>::operator[](size_type i) const
+{
+	return __data[i];
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::reference FP_numeric::FP_array<T,F,Allocator>::at(size_type i)
+{
+	return __data.at(i);
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_reference FP_numeric::FP_array<T,F,Allocator>::at(size_type i) const
+{
+	return __data.at(i);
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::reference FP_numeric::FP_array<T,F,Allocator>::front()
+{
+	return __data.front();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_reference FP_numeric::FP_array<T,F,Allocator>::front() const
+{
+	return __data.front();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::reference FP_numeric::FP_array<T,F,Allocator>::back()
+{
+	return __data.back();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_reference FP_numeric::FP_array<T,F,Allocator>::back() const
+{
+	return __data.back();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::pointer FP_numeric::FP_array<T,F,Allocator>::data()
+{
+	return __data.data();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_pointer FP_numeric::FP_array<T,F,Allocator>::data() const
+{
+	return __data.data();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::base_type* FP_numeric::FP_array<T,F,Allocator>::raw()
+{
+	return reinterpret_cast<base_type*>(__data.data());
+}
+
+template <size_t T, size_t F, typename Allocator>
+const typename FP_numeric::FP_array<T,F,Allocator>::base_type* FP_numeric::FP_array<T,F,Allocator>::raw() const
+{
+	return reinterpret_cast<const base_type*>(__data.data());
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::allocator_type FP_numeric::FP_array<T,F,Allocator>::get_allocator() const
+{
+	return __data.get_allocator();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::iterator FP_numeric::FP_array<T,F,Allocator>::begin()
+{
+	return __data.data();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_iterator FP_numeric::FP_array<T,F,Allocator>::begin() const
+{
+	return __data.data();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::iterator FP_numeric::FP_array<T,F,Allocator>::end()
+{
+	return __data.data() + __data.size();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_iterator FP_numeric::FP_array<T,F,Allocator>::end() const
+{
+	return __data.data() + __data.size();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_iterator FP_numeric::FP_array<T,F,Allocator>::cbegin() const
+{
+	return begin();
+}
+
+template <size_t T, size_t F, typename Allocator>
+typename FP_numeric::FP_array<T,F,Allocator>::const_iterator FP_numeric::FP_array<T,F,Allocator>::cend() const
+{
+	return end();
+}
+
+#endif /* FIXED_POINT_STATIC_ARRAY_HXX_ */
@@ -0,0 +1,78 @@
+#ifndef FIXED_POINT_STATIC_BATCH_HPP_
+#define FIXED_POINT_STATIC_BATCH_HPP_
+
+#include "Fixed_Point_Static.hpp"
+
+// The batch kernels are vectorized with the best instruction set enabled at compile time (-mavx2, -msse4.1 or the
+// x86_64 default SSE2). Define FP_BATCH_NO_SIMD to force the scalar kernels.
+#if !defined(FP_BATCH_NO_SIMD) && defined(__AVX2__)
+	#include <immintrin.h>
+	#define FP_BATCH_SIMD
+#elif !defined(FP_BATCH_NO_SIMD) && defined(__SSE4_1__)
+	#include <smmintrin.h>
+	#define FP_BATCH_SIMD
+#elif !defined(FP_BATCH_NO_SIMD) && defined(__SSE2__)
+	#include <emmintrin.h>
+	#define FP_BATCH_SIMD
+#endif
+
+/// ********************************************************************************************************************
+/// Fixed point batch kernels on contiguous arrays *********************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// add, sub or mul the n fixed points of lhs and rhs element by element, write the results in res
+	// and return res + n
+	// the results have the same quantification and the same bits than the scalar operators
+	// res may be lhs or rhs only if it has the same quantification
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type*
+	add_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+	      typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type* res);
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type*
+	sub_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+	      typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type* res);
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type*
+	mul_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+	      typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type* res);
+
+	// multiply the n fixed points of lhs by the same factor k
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type*
+	scale_n(const Fixed_Point_Static<Tl, Fl>* lhs, size_t n, const Fixed_Point_Static<Tr, Fr>& k,
+	        typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type* res);
+
+	// add the n fixed points of lhs and rhs element by element and saturate the results in the same quantification
+	// (same result than res[i] = lhs[i] + rhs[i])
+	template <size_t T, size_t F>
+	Fixed_Point_Static<T,F>*
+	saturating_add_n(const Fixed_Point_Static<T,F>* lhs, const Fixed_Point_Static<T,F>* rhs, size_t n,
+	                       Fixed_Point_Static<T,F>* res);
+
+	// convert the n floating points of first in fixed points, write them in result and return result + n
+	// (same rounding and saturation than change_data<R>, operator= by default)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP, typename floating_t, size_t T, size_t F>
+	typename std::enable_if<std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>*>::type
+	convert_n(const floating_t* first, size_t n, Fixed_Point_Static<T,F>* result);
+
+	// convert the n fixed points of first in floating points, write them in result and return result + n
+	// (same result than convert<floating_t>())
+	template <size_t T, size_t F, typename floating_t>
+	typename std::enable_if<std::is_floating_point<floating_t>::value, floating_t*>::type
+	convert_n(const Fixed_Point_Static<T,F>* first, size_t n, floating_t* result);
+
+	// requantize the n fixed points of first in the quantification of result, write them in result and return result + n
+	// (same rounding and saturation than change_data<R>, operator= by default)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_TO_ZERO, size_t Ti, size_t Fi, size_t To, size_t Fo>
+	Fixed_Point_Static<To,Fo>*
+	requantize_n(const Fixed_Point_Static<Ti,Fi>* first, size_t n, Fixed_Point_Static<To,Fo>* result);
+}
+
+#include "Fixed_Point_Static_batch.hxx"
+
+#endif /* FIXED_POINT_STATIC_BATCH_HPP_ */
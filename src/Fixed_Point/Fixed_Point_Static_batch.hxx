@@ -0,0 +1,649 @@
+#ifndef FIXED_POINT_STATIC_BATCH_HXX_
+#define FIXED_POINT_STATIC_BATCH_HXX_
+
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// Vector tools on the raw data of the fixed points (not part of the API) *********************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __batch
+{
+	// the arrays are accessed as arrays of their base_type as Fixed_Point_Static is stored exactly as its base_type
+	template <size_t T, size_t F>
+	inline const typename Fixed_Point_Static<T,F>::base_type* raw(const Fixed_Point_Static<T,F>* p)
+	{
+		static_assert(FP_numeric::has_raw_layout<Fixed_Point_Static<T,F>>::value, "Error in __batch::raw : the layout is not the one of base_type!");
+		return reinterpret_cast<const typename Fixed_Point_Static<T,F>::base_type*>(p);
+	}
+
+	template <size_t T, size_t F>
+	inline typename Fixed_Point_Static<T,F>::base_type* raw(Fixed_Point_Static<T,F>* p)
+	{
+		static_assert(FP_numeric::has_raw_layout<Fixed_Point_Static<T,F>>::value, "Error in __batch::raw : the layout is not the one of base_type!");
+		return reinterpret_cast<typename Fixed_Point_Static<T,F>::base_type*>(p);
+	}
+
+	enum class Op {ADD, SUB, MUL, SAT_ADD};
+
+	// true if the operation op from FPl and FPr to FPo has a vector kernel:
+	// same base_type for both operands, a result on the same (not for MUL) or the twice bigger base_type
+	// (no 32 bits to 64 bits multiplication with SSE2 only, its emulation is slower than the scalar one)
+	template <Op op, typename FPl, typename FPr, typename FPo>
+	struct has_kernel
+	{
+		using Bl = typename FPl::base_type;
+		using Br = typename FPr::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const bool value =
+		#if defined(FP_BATCH_SIMD)
+		                          std::is_same<Bl, Br>::value && sizeof(Bo) <= sizeof(int64_t)
+		                       && ((op == Op::SAT_ADD) ? sizeof(Bo) <= sizeof(int32_t) && std::is_same<Bl, Bo>::value
+		                                               : sizeof(Bo) == 2*sizeof(Bl) || (op != Op::MUL && sizeof(Bo) == sizeof(Bl)))
+		#if !defined(__AVX2__) && !defined(__SSE4_1__)
+		                       && !(op == Op::MUL && sizeof(Bo) == sizeof(int64_t))
+		#endif
+		                       ;
+		#else
+		                          false;
+		#endif
+	};
+
+	// true if the conversions between floating points and FP have a vector kernel: the doubled data
+	// (rounding bit of operator=) must fit in 32 bits lanes
+	template <typename FP>
+	struct has_conversion
+	{
+		static const bool value =
+		#if defined(FP_BATCH_SIMD)
+		                          sizeof(typename FP::base_type) <= sizeof(int32_t) && FP::Tb <= 30;
+		#else
+		                          false;
+		#endif
+	};
+
+#if defined(FP_BATCH_SIMD)
+
+	#if defined(__AVX2__)
+		#define FP_MM(intrinsic) _mm256_##intrinsic
+
+		using vec = __m256i;
+		inline vec     load     (const void* p) { return _mm256_loadu_si256((const __m256i*)p); }
+		inline __m128i load_half(const void* p) { return _mm_loadu_si128   ((const __m128i*)p); }
+		inline void    store    (void* p, vec v){ _mm256_storeu_si256((__m256i*)p, v); }
+		inline vec     zero     ()              { return _mm256_setzero_si256(); }
+		inline vec     v_and    (vec a, vec b)  { return _mm256_and_si256   (a, b); }
+		inline vec     v_andnot (vec a, vec b)  { return _mm256_andnot_si256(a, b); }
+		inline vec     v_or     (vec a, vec b)  { return _mm256_or_si256    (a, b); }
+		inline vec     v_xor    (vec a, vec b)  { return _mm256_xor_si256   (a, b); }
+	#else
+		#define FP_MM(intrinsic) _mm_##intrinsic
+
+		using vec = __m128i;
+		inline vec     load     (const void* p) { return _mm_loadu_si128((const __m128i*)p); }
+		inline __m128i load_half(const void* p) { return _mm_loadl_epi64((const __m128i*)p); }
+		inline void    store    (void* p, vec v){ _mm_storeu_si128((__m128i*)p, v); }
+		inline vec     zero     ()              { return _mm_setzero_si128(); }
+		inline vec     v_and    (vec a, vec b)  { return _mm_and_si128   (a, b); }
+		inline vec     v_andnot (vec a, vec b)  { return _mm_andnot_si128(a, b); }
+		inline vec     v_or     (vec a, vec b)  { return _mm_or_si128    (a, b); }
+		inline vec     v_xor    (vec a, vec b)  { return _mm_xor_si128   (a, b); }
+	#endif
+
+	// return x where mask is set, else y
+	inline vec select(vec mask, vec x, vec y) { return v_or(v_and(mask, x), v_andnot(mask, y)); }
+
+	// sign extend the low half of h on lanes twice bigger
+	template <typename B>
+	inline vec widen(__m128i h);
+
+	#if defined(__AVX2__) || defined(__SSE4_1__)
+		template <> inline vec widen<int8_t >(__m128i h) { return FP_MM(cvtepi8_epi16 )(h); }
+		template <> inline vec widen<int16_t>(__m128i h) { return FP_MM(cvtepi16_epi32)(h); }
+		template <> inline vec widen<int32_t>(__m128i h) { return FP_MM(cvtepi32_epi64)(h); }
+	#else
+		template <> inline vec widen<int8_t >(__m128i h) { return _mm_unpacklo_epi8 (h, _mm_cmpgt_epi8 (zero(), h)); }
+		template <> inline vec widen<int16_t>(__m128i h) { return _mm_unpacklo_epi16(h, _mm_cmpgt_epi16(zero(), h)); }
+		template <> inline vec widen<int32_t>(__m128i h) { return _mm_unpacklo_epi32(h, _mm_srai_epi32 (h, 31)); }
+	#endif
+
+	// load one vector of Bo lanes from an array of Bi
+	template <typename Bi, typename Bo, bool widening = (sizeof(Bi) != sizeof(Bo))>
+	struct loader
+	{
+		static vec load(const Bi* p) { return __batch::load(static_cast<const void*>(p)); }
+	};
+
+	template <typename Bi, typename Bo>
+	struct loader<Bi, Bo, true>
+	{
+		static vec load(const Bi* p) { return widen<Bi>(load_half(p)); }
+	};
+
+	// lane operations in function of the base_type of the lanes
+	template <typename B>
+	struct ops;
+
+	template <>
+	struct ops<int8_t>
+	{
+		static vec set1(int8_t v)     { return FP_MM(set1_epi8)(v); }
+		static vec add (vec a, vec b) { return FP_MM(add_epi8 )(a, b); }
+		static vec sub (vec a, vec b) { return FP_MM(sub_epi8 )(a, b); }
+		static vec adds(vec a, vec b) { return FP_MM(adds_epi8)(a, b); }
+	#if defined(__AVX2__) || defined(__SSE4_1__)
+		static vec min (vec a, vec b) { return FP_MM(min_epi8 )(a, b); }
+		static vec max (vec a, vec b) { return FP_MM(max_epi8 )(a, b); }
+	#else
+		static vec min (vec a, vec b) { return select(_mm_cmpgt_epi8(a, b), b, a); }
+		static vec max (vec a, vec b) { return select(_mm_cmpgt_epi8(a, b), a, b); }
+	#endif
+
+		// no 8 bits shift: shift the 16 bits lanes and clear the bits coming from the neighbour byte
+		template <size_t n>
+		static vec slli(vec a) { return (n == 0)? a : v_and(FP_MM(slli_epi16)(a, n), set1(int8_t(0xFF << n))); }
+
+		template <size_t s>
+		static vec sign_extension(vec a) { static_assert(s == 0, "Error in __batch::ops : no 8 bits multiplication kernel!"); return a; }
+	};
+
+	template <>
+	struct ops<int16_t>
+	{
+		static vec set1(int16_t v)    { return FP_MM(set1_epi16 )(v); }
+		static vec add (vec a, vec b) { return FP_MM(add_epi16  )(a, b); }
+		static vec sub (vec a, vec b) { return FP_MM(sub_epi16  )(a, b); }
+		static vec adds(vec a, vec b) { return FP_MM(adds_epi16 )(a, b); }
+		static vec min (vec a, vec b) { return FP_MM(min_epi16  )(a, b); }
+		static vec max (vec a, vec b) { return FP_MM(max_epi16  )(a, b); }
+		// lanes are sign extended int8_t: exact product
+		static vec mul (vec a, vec b) { return FP_MM(mullo_epi16)(a, b); }
+
+		template <size_t n>
+		static vec slli(vec a) { return (n == 0)? a : FP_MM(slli_epi16)(a, n); }
+
+		template <size_t s>
+		static vec sign_extension(vec a) { return (s == 0)? a : FP_MM(srai_epi16)(FP_MM(slli_epi16)(a, s), s); }
+	};
+
+	template <>
+	struct ops<int32_t>
+	{
+		static vec set1(int32_t v)    { return FP_MM(set1_epi32)(v); }
+		static vec add (vec a, vec b) { return FP_MM(add_epi32 )(a, b); }
+		static vec sub (vec a, vec b) { return FP_MM(sub_epi32 )(a, b); }
+		// lanes are sign extended int16_t: the high 16 bits of b are cleared so that madd computes a*b + sign(a)*0
+		static vec mul (vec a, vec b) { return FP_MM(madd_epi16)(a, v_and(b, set1(0xFFFF))); }
+
+		// no saturated 32 bits addition: on overflow a and b have the same sign and the sum has the other one
+		static vec adds(vec a, vec b)
+		{
+			vec sum      = add(a, b);
+			vec overflow = FP_MM(srai_epi32)(v_and(v_xor(a, sum), v_xor(b, sum)), 31);
+			vec sat      = v_xor(FP_MM(srai_epi32)(a, 31), set1(std::numeric_limits<int32_t>::max()));
+			return select(overflow, sat, sum);
+		}
+
+	#if defined(__AVX2__) || defined(__SSE4_1__)
+		static vec min (vec a, vec b) { return FP_MM(min_epi32)(a, b); }
+		static vec max (vec a, vec b) { return FP_MM(max_epi32)(a, b); }
+	#else
+		static vec min (vec a, vec b) { return select(_mm_cmpgt_epi32(a, b), b, a); }
+		static vec max (vec a, vec b) { return select(_mm_cmpgt_epi32(a, b), a, b); }
+	#endif
+
+		template <size_t n>
+		static vec slli(vec a) { return (n == 0)? a : FP_MM(slli_epi32)(a, n); }
+
+		template <size_t s>
+		static vec sign_extension(vec a) { return (s == 0)? a : FP_MM(srai_epi32)(FP_MM(slli_epi32)(a, s), s); }
+	};
+
+	template <>
+	struct ops<int64_t>
+	{
+		static vec set1(int64_t v)    { return FP_MM(set1_epi64x)(v); }
+		static vec add (vec a, vec b) { return FP_MM(add_epi64  )(a, b); }
+		static vec sub (vec a, vec b) { return FP_MM(sub_epi64  )(a, b); }
+		// no adds, min nor max: there is no 64 bits saturated kernel (has_kernel)
+
+		// lanes are sign extended int32_t: the 32 bits signed multiplication is exact
+		// (no SSE2 64 bits multiplication kernel)
+	#if defined(__AVX2__) || defined(__SSE4_1__)
+		static vec mul (vec a, vec b) { return FP_MM(mul_epi32)(a, b); }
+	#endif
+
+		template <size_t n>
+		static vec slli(vec a) { return (n == 0)? a : FP_MM(slli_epi64)(a, n); }
+
+		// no 64 bits arithmetic shift: logical shift then extend the sign bit with (x ^ m) - m
+		template <size_t s>
+		static vec sign_extension(vec a)
+		{
+			if(s == 0)
+				return a;
+
+			vec x = FP_MM(srli_epi64)(FP_MM(slli_epi64)(a, s), s);
+			vec m = set1(int64_t(uint64_t(1) << (63 - s)));
+			return sub(v_xor(x, m), m);
+		}
+	};
+
+	// the operation on the aligned lanes of lhs and rhs
+	template <Op op, typename B>
+	struct lanes_op;
+
+	template <typename B>
+	struct lanes_op<Op::ADD, B>     { static vec apply(vec a, vec b, vec, vec) { return ops<B>::add(a, b); } };
+
+	template <typename B>
+	struct lanes_op<Op::SUB, B>     { static vec apply(vec a, vec b, vec, vec) { return ops<B>::sub(a, b); } };
+
+	template <typename B>
+	struct lanes_op<Op::MUL, B>     { static vec apply(vec a, vec b, vec, vec) { return ops<B>::mul(a, b); } };
+
+	template <typename B>
+	struct lanes_op<Op::SAT_ADD, B> { static vec apply(vec a, vec b, vec lo, vec hi) { return ops<B>::min(ops<B>::max(ops<B>::adds(a, b), lo), hi); } };
+
+#endif // FP_BATCH_SIMD
+
+	// compute the first elements of res by whole vectors and return the number of computed elements
+	// (the scalar kernel computes none of them)
+	template <Op op, typename FPl, typename FPr, typename FPo, bool broadcast,
+	          bool vectorized = has_kernel<op, FPl, FPr, FPo>::value>
+	struct kernel
+	{
+		static size_t run(const FPl*, const FPr*, size_t, FPo*) { return 0; }
+	};
+
+#if defined(FP_BATCH_SIMD)
+	template <Op op, typename FPl, typename FPr, typename FPo, bool broadcast>
+	struct kernel<op, FPl, FPr, FPo, broadcast, true>
+	{
+		using Bi = typename FPl::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const size_t lanes = sizeof(vec) / sizeof(Bo);
+
+		// alignment of the fractional parts (as FP_numeric::shift_fract) for add and sub
+		static const size_t dl = (op == Op::MUL || FPl::Fb >= FPr::Fb)? 0 : FPr::Fb - FPl::Fb;
+		static const size_t dr = (op == Op::MUL || FPr::Fb >= FPl::Fb)? 0 : FPl::Fb - FPr::Fb;
+
+		// sign extension of the result on its total bits (as set_data), only needed after a multiplication
+		static const size_t s  = (op == Op::MUL)? FPo::capacity - FPo::Tb : 0;
+
+		static size_t run(const FPl* lhs, const FPr* rhs, size_t n, FPo* res)
+		{
+			const Bi* l = raw(lhs);
+			const Bi* r = raw(rhs);
+			      Bo* o = raw(res);
+
+			const vec lo = ops<Bo>::set1((Bo)FPo::min().to_raw());
+			const vec hi = ops<Bo>::set1((Bo)FPo::max().to_raw());
+			const vec k  = broadcast? ops<Bo>::template slli<dr>(ops<Bo>::set1((Bo)r[0])) : zero();
+
+			size_t i = 0;
+			for(; i + lanes <= n; i += lanes)
+			{
+				vec a = ops<Bo>::template slli<dl>(loader<Bi,Bo>::load(l + i));
+				vec b = broadcast? k : ops<Bo>::template slli<dr>(loader<Bi,Bo>::load(r + i));
+
+				store(o + i, ops<Bo>::template sign_extension<s>(lanes_op<op, Bo>::apply(a, b, lo, hi)));
+			}
+
+			return i;
+		}
+	};
+
+	// floating point lanes: each vector of floating_t is converted from or into one vector of int32_t lanes
+	template <typename floating_t>
+	struct fops;
+
+	template <>
+	struct fops<float>
+	{
+	#if defined(__AVX2__)
+		using fvec = __m256;
+	#else
+		using fvec = __m128;
+	#endif
+
+		static fvec set1(float v) { return FP_MM(set1_ps)(v); }
+
+	#if defined(__AVX2__)
+		static fvec gt(fvec a, fvec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static fvec eq(fvec a, fvec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+	#else
+		static fvec gt(fvec a, fvec b) { return _mm_cmpgt_ps(a, b); }
+		static fvec eq(fvec a, fvec b) { return _mm_cmpeq_ps(a, b); }
+	#endif
+
+		// (value * scale) once clamped between lo and hi (NaN gives lo) split in its truncation t, its floor f and e,
+		// 1 if it is an integer else 0 (the floor is computed on the exact floating point value of t)
+		static void to_int(const float* p, fvec scale, fvec lo, fvec hi, vec& t, vec& f, vec& e)
+		{
+			const fvec one = set1(1.f);
+			const fvec s   = FP_MM(min_ps)(FP_MM(max_ps)(FP_MM(mul_ps)(FP_MM(loadu_ps)(p), scale), lo), hi);
+
+			t = FP_MM(cvttps_epi32)(s);
+			const fvec tf = FP_MM(cvtepi32_ps)(t);
+			const fvec ff = FP_MM(sub_ps)(tf, FP_MM(and_ps)(gt(tf, s), one));
+			f = FP_MM(cvttps_epi32)(ff);
+			e = FP_MM(cvttps_epi32)(FP_MM(and_ps)(eq(ff, s), one));
+		}
+
+		static void from_int(float* p, vec v, fvec inv_one)
+		{
+			FP_MM(storeu_ps)(p, FP_MM(mul_ps)(FP_MM(cvtepi32_ps)(v), inv_one));
+		}
+	};
+
+	template <>
+	struct fops<double>
+	{
+	#if defined(__AVX2__)
+		using fvec = __m256d;
+		static vec     combine(__m128i lo, __m128i hi) { return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1); }
+		static __m128i half   (vec v, int i)           { return i? _mm256_extracti128_si256(v, 1) : _mm256_castsi256_si128(v); }
+	#else
+		using fvec = __m128d;
+		static vec     combine(__m128i lo, __m128i hi) { return _mm_unpacklo_epi64(lo, hi); }
+		static __m128i half   (vec v, int i)           { return i? _mm_srli_si128(v, 8) : v; }
+	#endif
+
+		static const size_t half_lanes = sizeof(fvec) / sizeof(double);
+
+		static fvec set1(double v) { return FP_MM(set1_pd)(v); }
+
+	#if defined(__AVX2__)
+		static fvec gt(fvec a, fvec b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+		static fvec eq(fvec a, fvec b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	#else
+		static fvec gt(fvec a, fvec b) { return _mm_cmpgt_pd(a, b); }
+		static fvec eq(fvec a, fvec b) { return _mm_cmpeq_pd(a, b); }
+	#endif
+
+		static void to_int_half(const double* p, fvec scale, fvec lo, fvec hi, __m128i& t, __m128i& f, __m128i& e)
+		{
+			const fvec one = set1(1.);
+			const fvec s   = FP_MM(min_pd)(FP_MM(max_pd)(FP_MM(mul_pd)(FP_MM(loadu_pd)(p), scale), lo), hi);
+
+			t = FP_MM(cvttpd_epi32)(s);
+			const fvec tf = FP_MM(cvtepi32_pd)(t);
+			const fvec ff = FP_MM(sub_pd)(tf, FP_MM(and_pd)(gt(tf, s), one));
+			f = FP_MM(cvttpd_epi32)(ff);
+			e = FP_MM(cvttpd_epi32)(FP_MM(and_pd)(eq(ff, s), one));
+		}
+
+		// same as fops<float>::to_int
+		static void to_int(const double* p, fvec scale, fvec lo, fvec hi, vec& t, vec& f, vec& e)
+		{
+			__m128i t0, f0, e0, t1, f1, e1;
+			to_int_half(p,              scale, lo, hi, t0, f0, e0);
+			to_int_half(p + half_lanes, scale, lo, hi, t1, f1, e1);
+
+			t = combine(t0, t1);
+			f = combine(f0, f1);
+			e = combine(e0, e1);
+		}
+
+		static void from_int(double* p, vec v, fvec inv_one)
+		{
+			FP_MM(storeu_pd)(p,              FP_MM(mul_pd)(FP_MM(cvtepi32_pd)(half(v, 0)), inv_one));
+			FP_MM(storeu_pd)(p + half_lanes, FP_MM(mul_pd)(FP_MM(cvtepi32_pd)(half(v, 1)), inv_one));
+		}
+	};
+
+	// load or store groups of int32_t lanes from or into an array of B
+	template <typename B>
+	struct lanes32;
+
+	template <>
+	struct lanes32<int32_t>
+	{
+		static const size_t group = 1;
+
+		static vec  load (const int32_t* p)         { return __batch::load(static_cast<const void*>(p)); }
+		static void store(int32_t* p, const vec* v) { __batch::store(p, v[0]); }
+	};
+
+	template <>
+	struct lanes32<int16_t>
+	{
+		static const size_t group = 2;
+
+		static vec  load (const int16_t* p)         { return widen<int16_t>(load_half(p)); }
+	#if defined(__AVX2__)
+		// packs works on 128 bits lanes: put the 64 bits blocks back in order
+		static void store(int16_t* p, const vec* v) { __batch::store(p, _mm256_permute4x64_epi64(_mm256_packs_epi32(v[0], v[1]), 0xD8)); }
+	#else
+		static void store(int16_t* p, const vec* v) { __batch::store(p, _mm_packs_epi32(v[0], v[1])); }
+	#endif
+	};
+
+	template <>
+	struct lanes32<int8_t>
+	{
+		static const size_t group = 4;
+
+	#if defined(__AVX2__)
+		static vec  load (const int8_t* p)          { return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)p)); }
+		// packs works on 128 bits lanes: put the 32 bits blocks back in order
+		static void store(int8_t* p, const vec* v)
+		{
+			vec packed = _mm256_packs_epi16(_mm256_packs_epi32(v[0], v[1]), _mm256_packs_epi32(v[2], v[3]));
+			__batch::store(p, _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+		}
+	#else
+		#if defined(__SSE4_1__)
+		static vec  load (const int8_t* p)          { return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(*(const int32_t*)p)); }
+		#else
+		static vec  load (const int8_t* p)          { return widen<int16_t>(widen<int8_t>(_mm_cvtsi32_si128(*(const int32_t*)p))); }
+		#endif
+		static void store(int8_t* p, const vec* v)  { __batch::store(p, _mm_packs_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]))); }
+	#endif
+	};
+
+	// round the doubled values of the lanes (split by fops::to_int) in function of R as FP_numeric::round_float
+	template <FP_numeric::Rounding_type R>
+	inline vec round_half(vec t, vec f, vec e)
+	{
+		const vec h = FP_MM(srai_epi32)(ops<int32_t>::add(f, ops<int32_t>::set1(1)), 1);
+
+		return (R == FP_numeric::Rounding_type::TRUNCATED)         ? FP_MM(srai_epi32)(f, 1)
+		     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_UP)   ? h
+		     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_EVEN) ? ops<int32_t>::sub(h, v_and(v_and(h, f), e))
+		                                                           : FP_MM(srai_epi32)(ops<int32_t>::add(t, FP_MM(srli_epi32)(t, 31)), 1);
+	}
+#endif // FP_BATCH_SIMD
+
+	// convert the first elements by whole vectors and return the number of converted elements
+	// (the scalar conversion converts none of them)
+	template <typename floating_t, typename FP, FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP,
+	          bool vectorized = has_conversion<FP>::value>
+	struct conversion
+	{
+		static size_t run(const floating_t*, size_t, FP*) { return 0; }
+		static size_t run(const FP*, size_t, floating_t*) { return 0; }
+	};
+
+#if defined(FP_BATCH_SIMD)
+	template <typename floating_t, typename FP, FP_numeric::Rounding_type R>
+	struct conversion<floating_t, FP, R, true>
+	{
+		using B    = typename FP::base_type;
+		using fvec = typename fops<floating_t>::fvec;
+
+		static const size_t lanes = sizeof(vec) / sizeof(int32_t);
+		static const size_t group = lanes32<B>::group;
+
+		// as change_data<R>: the value is scaled with one rounding bit more, split, rounded then saturated.
+		// The scaled value is first clamped between 2*min and 2*max so that it always fits in the 32 bits lanes
+		// and still saturates as in the scalar conversion
+		static size_t run(const floating_t* in, size_t n, FP* out)
+		{
+			B* o = raw(out);
+
+			const fvec scale = fops<floating_t>::set1(FP_numeric::exp2i<floating_t>(FP::Fb + 1));
+			const fvec lo    = fops<floating_t>::set1(static_cast<floating_t>(int64_t(FP::min().to_raw()) * 2));
+			const fvec hi    = fops<floating_t>::set1(static_cast<floating_t>(int64_t(FP::max().to_raw()) * 2));
+			const vec  min   = ops<int32_t>::set1(FP::min().to_raw());
+			const vec  max   = ops<int32_t>::set1(FP::max().to_raw());
+
+			size_t i = 0;
+			for(; i + lanes * group <= n; i += lanes * group)
+			{
+				vec v[group];
+				for(size_t g = 0; g < group; g++)
+				{
+					vec t, f, e;
+					fops<floating_t>::to_int(in + i + g * lanes, scale, lo, hi, t, f, e);
+					v[g] = ops<int32_t>::min(ops<int32_t>::max(round_half<R>(t, f, e), min), max);
+				}
+				lanes32<B>::store(o + i, v);
+			}
+
+			return i;
+		}
+
+		// as convert<floating_t>(): the division by 2^F is an exact multiplication by its inverse
+		static size_t run(const FP* in, size_t n, floating_t* out)
+		{
+			const B* p = raw(in);
+
+			const fvec inv_one = fops<floating_t>::set1(floating_t(1) / FP_numeric::exp2i<floating_t>(FP::Fb));
+
+			size_t i = 0;
+			for(; i + lanes <= n; i += lanes)
+				fops<floating_t>::from_int(out + i, lanes32<B>::load(p + i), inv_one);
+
+			return i;
+		}
+	};
+
+	#undef FP_MM
+#endif // FP_BATCH_SIMD
+}
+}
+
+/// ********************************************************************************************************************
+/// Fixed point batch kernels on contiguous arrays *********************************************************************
+/// ********************************************************************************************************************
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type*
+FP_numeric::add_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+                  typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type* res)
+{
+	using __res_t = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type;
+
+	size_t i = __batch::kernel<__batch::Op::ADD, Fixed_Point_Static<Tl, Fl>, Fixed_Point_Static<Tr, Fr>, __res_t, false>
+	           ::run(lhs, rhs, n, res);
+
+	for(; i < n; i++)
+		res[i] = FP_numeric::add(lhs[i], rhs[i]);
+
+	return res + n;
+}
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type*
+FP_numeric::sub_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+                  typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type* res)
+{
+	using __res_t = typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type;
+
+	size_t i = __batch::kernel<__batch::Op::SUB, Fixed_Point_Static<Tl, Fl>, Fixed_Point_Static<Tr, Fr>, __res_t, false>
+	           ::run(lhs, rhs, n, res);
+
+	for(; i < n; i++)
+		res[i] = FP_numeric::sub(lhs[i], rhs[i]);
+
+	return res + n;
+}
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type*
+FP_numeric::mul_n(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n,
+                  typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type* res)
+{
+	using __res_t = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type;
+
+	size_t i = __batch::kernel<__batch::Op::MUL, Fixed_Point_Static<Tl, Fl>, Fixed_Point_Static<Tr, Fr>, __res_t, false>
+	           ::run(lhs, rhs, n, res);
+
+	for(; i < n; i++)
+		res[i] = FP_numeric::mul(lhs[i], rhs[i]);
+
+	return res + n;
+}
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type*
+FP_numeric::scale_n(const Fixed_Point_Static<Tl, Fl>* lhs, size_t n, const Fixed_Point_Static<Tr, Fr>& k,
+                    typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type* res)
+{
+	using __res_t = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type;
+
+	size_t i = __batch::kernel<__batch::Op::MUL, Fixed_Point_Static<Tl, Fl>, Fixed_Point_Static<Tr, Fr>, __res_t, true>
+	           ::run(lhs, &k, n, res);
+
+	for(; i < n; i++)
+		res[i] = FP_numeric::mul(lhs[i], k);
+
+	return res + n;
+}
+
+template <size_t T, size_t F>
+Fixed_Point_Static<T,F>*
+FP_numeric::saturating_add_n(const Fixed_Point_Static<T,F>* lhs, const Fixed_Point_Static<T,F>* rhs, size_t n,
+                                   Fixed_Point_Static<T,F>* res)
+{
+	size_t i = __batch::kernel<__batch::Op::SAT_ADD, Fixed_Point_Static<T,F>, Fixed_Point_Static<T,F>, Fixed_Point_Static<T,F>, false>
+	           ::run(lhs, rhs, n, res);
+
+	for(; i < n; i++)
+		res[i] = FP_numeric::add(lhs[i], rhs[i]);
+
+	return res + n;
+}
+
+template <FP_numeric::Rounding_type R, typename floating_t, size_t T, size_t F>
+typename std::enable_if<std::is_floating_point<floating_t>::value, Fixed_Point_Static<T,F>*>::type
+FP_numeric::convert_n(const floating_t* first, size_t n, Fixed_Point_Static<T,F>* result)
+{
+	size_t i = __batch::conversion<floating_t, Fixed_Point_Static<T,F>, R>::run(first, n, result);
+
+	for(; i < n; i++)
+		result[i].template change_data<R>(first[i], T, F);
+
+	return result + n;
+}
+
+template <size_t T, size_t F, typename floating_t>
+typename std::enable_if<std::is_floating_point<floating_t>::value, floating_t*>::type
+FP_numeric::convert_n(const Fixed_Point_Static<T,F>* first, size_t n, floating_t* result)
+{
+	size_t i = __batch::conversion<floating_t, Fixed_Point_Static<T,F>>::run(first, n, result);
+
+	for(; i < n; i++)
+		result[i] = first[i].template convert<floating_t>();
+
+	return result + n;
+}
+
+// the loop is branch free (change_data<R> rounds with a shift and a compare): it is left to the auto-vectorizer
+template <FP_numeric::Rounding_type R, size_t Ti, size_t Fi, size_t To, size_t Fo>
+Fixed_Point_Static<To,Fo>*
+FP_numeric::requantize_n(const Fixed_Point_Static<Ti,Fi>* first, size_t n, Fixed_Point_Static<To,Fo>* result)
+{
+	for(size_t i = 0; i < n; i++)
+		result[i].template change_data<R>(first[i]);
+
+	return result + n;
+}
+
+#endif /* FIXED_POINT_STATIC_BATCH_HXX_ */
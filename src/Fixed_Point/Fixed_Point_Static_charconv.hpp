@@ -0,0 +1,80 @@
+// included before the guard: Fixed_Point_Static_operators.hpp includes this header for operator<< and std::to_string
+#include "Fixed_Point_Static.hpp"
+
+#ifndef FIXED_POINT_STATIC_CHARCONV_HPP_
+#define FIXED_POINT_STATIC_CHARCONV_HPP_
+
+#include <system_error>
+#include <stdexcept>
+
+/// ********************************************************************************************************************
+/// Conversions to text without allocation *****************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// result of to_chars as the std::to_chars_result of C++17: ptr is one past the last written char, or last with
+	// ec == std::errc::value_too_large if [first, last) is too small (its content is then unspecified)
+	struct to_chars_result
+	{
+		char*     ptr;
+		std::errc ec;
+	};
+
+	// maximum number of chars written by to_chars for FP with at most F fractional digits (the sign, the integer digits,
+	// the point and the fractional digits): a buffer of chars_size<FP>::value + precision chars is always large enough
+	template <typename FP>
+	struct chars_size
+	{
+		static const size_t value = 1 + (FP::Tb - FP::Fb) * 30103 / 100000 + 1 + 1 + FP::Fb;
+	};
+
+	// write the exact decimal expansion of x in [first, last): '-' if x is negative, the integer digits, then the point
+	// and the fractional digits if there are some (F at most: a fraction of F bits has F decimal digits), without exponent.
+	// The digits are generated from the raw base_type and F with integer arithmetics only (no floating point, no heap):
+	// 2 digits per division by 100 for the integer part, 9 digits per product by 10^9 for the fractional part
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	to_chars_result to_chars(char* first, char* last, const Fixed_Point_Static<T,F,A>& x) noexcept;
+
+	// same with exactly precision fractional digits (as printf("%.*f")): rounded to the nearest, the ties to even
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	to_chars_result to_chars(char* first, char* last, const Fixed_Point_Static<T,F,A>& x, const size_t precision) noexcept;
+}
+
+/// ********************************************************************************************************************
+/// Conversions from text without allocation ***************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// result of from_chars as the std::from_chars_result of C++17: ptr is one past the parsed number, or first with
+	// ec == std::errc::invalid_argument if [first, last) does not begin with a number (x is then unchanged)
+	struct from_chars_result
+	{
+		const char* ptr;
+		std::errc   ec;
+	};
+
+	// parse the longest number at the beginning of [first, last) in x: an optional sign, decimal digits with an optional
+	// point and exponent ("-12.375", "+.5", "1e-3") or hexadecimal digits after 0x with an optional point ("0x1.8").
+	// The digits are converted straight to the raw base_type with integer arithmetics only (no floating point, so no
+	// double rounding of "0.1"): the dropped bits are rounded in function of R on the exact decimal value (as the
+	// operator= of the floating points by default), the digits after the F+1-th fractional one only count as sticky.
+	// A value out of the range of x saturates it to max() or min() with ec == std::errc::result_out_of_range
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP,
+	          size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	from_chars_result from_chars(const char* first, const char* last, Fixed_Point_Static<T,F,A>& x) noexcept;
+
+	// parse the column-th field (from 0) of each line of [first, last) in result, n values at most, and return the number
+	// of parsed values. The fields are separated by delimiter (any run of blanks if delimiter is ' '), the blanks around
+	// a field, the empty lines and the "\r\n" ends of line are skipped, the values out of range are saturated.
+	// Throws std::invalid_argument (with the line number) if a line has no column-th field or if it is not a number
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::ROUNDED_HALF_UP,
+	          size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	size_t read_column(const char* first, const char* last, Fixed_Point_Static<T,F,A>* result, size_t n,
+	                   size_t column = 0, char delimiter = ',');
+}
+
+#include "Fixed_Point_Static_charconv.hxx"
+
+#endif /* FIXED_POINT_STATIC_CHARCONV_HPP_ */
@@ -0,0 +1,455 @@
+#ifndef FIXED_POINT_STATIC_CHARCONV_HXX_
+#define FIXED_POINT_STATIC_CHARCONV_HXX_
+
+#include <algorithm>
+#include <cstring>
+
+#include "Fixed_Point_Static_charconv.hpp"
+
+namespace FP_numeric
+{
+namespace __chars
+{
+	// number of 64 bits words of the integer type U (not part of the API)
+	template <typename U>
+	struct words
+	{
+		static const size_t value = (sizeof(U)*8 + 63) / 64;
+	};
+
+	// the words of the magnitude of the raw data of x (least significant first)
+	template <typename FP>
+	inline void magnitude(const FP& x, uint64_t* w) noexcept
+	{
+		using base_type = typename FP::base_type;
+		using utype     = typename FP_numeric::unsigned_type<base_type>::type;
+		const size_t bits = sizeof(utype)*8;
+
+		const base_type raw = x.get_data();
+		const utype     m   = x.is_sneg() ? utype(utype(0) - utype(raw)) : utype(raw);
+
+		for (size_t i = 0; i < words<utype>::value; i++)
+			w[i] = uint64_t(m >> (i*64 % bits));
+	}
+
+	inline bool is_zero(const uint64_t* w, const size_t n) noexcept
+	{
+		uint64_t any = 0;
+		for (size_t i = 0; i < n; i++)
+			any |= w[i];
+		return any == 0;
+	}
+
+	// multiply the fraction f of F bits (in n words, n*64 >= F+30) by 10^9 and return its bits above F (the 9 next
+	// decimal digits, lower than 10^9) cleared from f
+	inline uint64_t next_digits(uint64_t* f, const size_t n, const size_t F) noexcept
+	{
+		uint64_t carry = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			uint64_t hi = 0;
+			const uint64_t lo = FP_numeric::mul_64x64(f[i], 1000000000, hi);
+			f[i]  = lo + carry;
+			carry = hi + (f[i] < lo);
+		}
+
+		const size_t w = F / 64, b = F % 64;
+		const uint64_t digits = (f[w] >> b) | ((b != 0 && w + 1 < n) ? f[w + 1] << (64 - b) : 0);
+
+		f[w] &= (b != 0) ? ~uint64_t(0) >> (64 - b) : 0;
+		for (size_t i = w + 1; i < n; i++)
+			f[i] = 0;
+
+		return digits;
+	}
+
+	// write the decimal expansion of x with its fractional digits rounded at precision (if not exact)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	inline to_chars_result write(char* first, char* last, const Fixed_Point_Static<T,F,A>& x, const size_t precision,
+	                             const bool exact) noexcept
+	{
+		const size_t W  = words<typename Fixed_Point_Static<T,F,A>::base_type>::value;
+		const size_t NF = (F + 30) / 64 + 1; // room for the 30 bits of 10^9 above the fraction
+
+		uint64_t m[W] = {};
+		magnitude(x, m);
+
+		// integer part m >> F and fractional part m & (2^F - 1)
+		uint64_t ip[W] = {}, fp[NF] = {};
+		for (size_t i = 0; i + F / 64 < W; i++)
+		{
+			const size_t k = i + F / 64;
+			ip[i] = (m[k] >> F % 64) | ((F % 64 != 0 && k + 1 < W) ? m[k + 1] << (64 - F % 64) : 0);
+		}
+		const uint64_t low_bits = ~uint64_t(0) >> (64 - F % 64) % 64;
+		for (size_t i = 0; i < W && i < NF; i++)
+			fp[i] = (i*64 + 64 <= F) ? m[i] : (i*64 < F) ? m[i] & low_bits : 0;
+
+		// the fractional digits, 9 at once, until the ones needed (one more for the rounding) or a null fraction
+		char frac[F + 10];
+		const size_t wanted = exact ? F : std::min(precision + 1, F);
+		size_t n_frac = 0;
+		for (; n_frac < wanted && !is_zero(fp, NF); n_frac += 9)
+		{
+			char* const chunk = frac + n_frac;
+			char* d = FP_numeric::write_digits(chunk + 9, next_digits(fp, NF, F));
+			while (d > chunk)
+				*--d = '0';
+		}
+		n_frac = std::min(n_frac, F);
+
+		bool carry = false;
+		if (exact)
+		{
+			while (n_frac > 0 && frac[n_frac - 1] == '0')
+				n_frac--;
+		}
+		else if (precision < n_frac)
+		{
+			// the dropped digits are compared to one half: the sticky tail are the digits after the first dropped one
+			// and the fraction left
+			bool sticky = !is_zero(fp, NF);
+			for (size_t i = precision + 1; i < n_frac; i++)
+				sticky |= frac[i] != '0';
+
+			const char dropped = frac[precision];
+			const bool odd     = (precision > 0) ? (frac[precision - 1] - '0') & 1 : ip[0] & 1;
+			carry  = dropped > '5' || (dropped == '5' && (sticky || odd));
+			n_frac = precision;
+
+			for (size_t i = n_frac; carry && i > 0; i--)
+			{
+				carry = frac[i - 1] == '9';
+				frac[i - 1] = carry ? '0' : char(frac[i - 1] + 1);
+			}
+		}
+		for (size_t i = 0; carry && i < W; i++) // the rounding carry goes up to the integer part
+			carry = ++ip[i] == 0;
+
+		char int_digits[W*20 + 1];
+		const char* const int_first = FP_numeric::write_digits(int_digits + sizeof(int_digits), ip, W);
+		const size_t n_int  = size_t(int_digits + sizeof(int_digits) - int_first);
+		const size_t n_dec  = exact ? n_frac : precision;
+		const size_t length = (x.is_sneg() ? 1 : 0) + n_int + ((n_dec > 0) ? 1 + n_dec : 0);
+
+		if (length > size_t(last - first))
+			return {last, std::errc::value_too_large};
+
+		if (x.is_sneg())
+			*first++ = '-';
+		std::memcpy(first, int_first, n_int);
+		first += n_int;
+
+		if (n_dec > 0)
+		{
+			*first++ = '.';
+			std::memcpy(first, frac, n_frac);
+			std::memset(first + n_frac, '0', n_dec - n_frac); // the digits after the F-th one are null
+			first += n_dec;
+		}
+
+		return {first, std::errc()};
+	}
+
+	// value of the character c as a digit in base (10 or 16), -1 if it is not one
+	inline int digit(const char c, const unsigned base) noexcept
+	{
+		return (c >= '0' && c <= '9') ? c - '0'
+		     : (base == 16 && (c | 0x20) >= 'a' && (c | 0x20) <= 'f') ? (c | 0x20) - 'a' + 10 : -1;
+	}
+
+	// w = w * k + a on n words (least significant first), return the carry out of the last word
+	inline uint64_t mul_add(uint64_t* w, const size_t n, const uint64_t k, uint64_t a) noexcept
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			uint64_t hi = 0;
+			const uint64_t lo = FP_numeric::mul_64x64(w[i], k, hi);
+			w[i] = lo + a;
+			a    = hi + (w[i] < lo);
+		}
+		return a;
+	}
+
+	// w <<= s on n words (least significant first), return true if some non null bits are shifted out
+	inline bool shift_left(uint64_t* w, const size_t n, const size_t s) noexcept
+	{
+		const size_t ws = s / 64, bs = s % 64;
+
+		bool lost = false;
+		for (size_t i = (ws < n) ? n - ws : 0; i < n; i++)
+			lost |= w[i] != 0;
+		if (ws < n && bs != 0)
+			lost |= (w[n - ws - 1] >> (64 - bs)) != 0;
+
+		for (size_t i = n; i > 0; i--)
+		{
+			const size_t k = i - 1;
+			w[k] = (k < ws) ? 0 : (w[k - ws] << bs) | ((bs != 0 && k > ws) ? w[k - ws - 1] >> (64 - bs) : 0);
+		}
+		return lost;
+	}
+
+	// multiply the fraction stored in l limbs (most significant first, each one lower than limb_base) by 2^s (s <= 32)
+	// and return its integer part (its s next bits) removed from the limbs
+	template <uint32_t limb_base>
+	inline uint64_t next_bits(uint32_t* limbs, const size_t l, const size_t s) noexcept
+	{
+		uint64_t carry = 0;
+		for (size_t i = l; i > 0; i--)
+		{
+			const uint64_t v = (uint64_t(limbs[i - 1]) << s) + carry;
+			limbs[i - 1] = uint32_t(v % limb_base);
+			carry        = v / limb_base;
+		}
+		return carry;
+	}
+
+	inline bool is_zero(const uint32_t* limbs, const size_t l) noexcept
+	{
+		uint32_t any = 0;
+		for (size_t i = 0; i < l; i++)
+			any |= limbs[i];
+		return any == 0;
+	}
+}
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline FP_numeric::to_chars_result
+FP_numeric::to_chars(char* first, char* last, const Fixed_Point_Static<T,F,A>& x) noexcept
+{
+	return FP_numeric::__chars::write(first, last, x, F, true);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline FP_numeric::to_chars_result
+FP_numeric::to_chars(char* first, char* last, const Fixed_Point_Static<T,F,A>& x, const size_t precision) noexcept
+{
+	return FP_numeric::__chars::write(first, last, x, precision, false);
+}
+
+namespace FP_numeric
+{
+namespace __chars
+{
+	// parse the digits in base from p (after the sign and the 0x of [first, last)) in x
+	template <FP_numeric::Rounding_type R, unsigned base, size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	inline from_chars_result parse(const char* first, const char* p, const char* last, const bool neg,
+	                               Fixed_Point_Static<T,F,A>& x) noexcept
+	{
+		using FP        = Fixed_Point_Static<T,F,A>;
+		using base_type = typename FP::base_type;
+		using utype     = typename FP_numeric::unsigned_type<base_type>::type;
+
+		const size_t bits = sizeof(utype)*8;
+		const size_t W    = words<utype>::value;
+
+		const char* const int_first = p;
+		while (p != last && digit(*p, base) >= 0)
+			p++;
+		const char* const int_last = p;
+
+		const char* frac_first = p;
+		const char* frac_last  = p;
+		if (p != last && *p == '.')
+		{
+			frac_first = ++p;
+			while (p != last && digit(*p, base) >= 0)
+				p++;
+			frac_last = p;
+		}
+
+		if (int_first == int_last && frac_first == frac_last)
+			return {first, std::errc::invalid_argument};
+
+		// the decimal exponent is clamped far beyond the range of any fixed point (the digits are then null or overflow)
+		ptrdiff_t exponent = 0;
+		if (base == 10 && p != last && (*p | 0x20) == 'e')
+		{
+			const char* e = p + 1;
+			const bool exponent_neg = (e != last && *e == '-');
+			if (e != last && (*e == '-' || *e == '+'))
+				e++;
+
+			if (e != last && digit(*e, 10) >= 0)
+			{
+				for (; e != last && digit(*e, 10) >= 0; e++)
+					exponent = std::min<ptrdiff_t>(exponent * 10 + (*e - '0'), ptrdiff_t(1) << 20);
+				exponent = exponent_neg ? -exponent : exponent;
+				p = e;
+			}
+		}
+
+		// the digits of the mantissa (integer then fractional ones) with the point after point of them (null outside)
+		const ptrdiff_t n_int    = int_last - int_first;
+		const ptrdiff_t n_digits = n_int + (frac_last - frac_first);
+		const ptrdiff_t point    = n_int + exponent;
+		const auto digit_at = [&](const ptrdiff_t j) -> unsigned
+		{
+			return (j < 0 || j >= n_digits) ? 0 : unsigned(digit((j < n_int) ? int_first[j] : frac_first[j - n_int], base));
+		};
+
+		// integer part in the words of the magnitude, 19 decimal (15 hexadecimal) digits per product
+		uint64_t m[W] = {};
+		bool overflow = false;
+		{
+			const ptrdiff_t int_end = std::min(point, n_digits);
+
+			uint64_t acc = 0, scale = 1;
+			for (ptrdiff_t j = 0; j < int_end && !overflow; j++)
+			{
+				acc    = acc * base + digit_at(j);
+				scale *= base;
+				if (scale == ((base == 10) ? 10000000000000000000ULL : uint64_t(1) << 60) || j + 1 == int_end) // 10^19 or 16^15
+				{
+					overflow = mul_add(m, W, scale, acc) != 0;
+					acc = 0, scale = 1;
+				}
+			}
+
+			// the zeros of the exponent after the digits (a null integer part stays null)
+			for (ptrdiff_t j = std::max(n_digits, ptrdiff_t(0)); j < point && !overflow && !is_zero(m, W); j++)
+				overflow = mul_add(m, W, base, 0) != 0;
+
+			overflow |= shift_left(m, W, F);
+		}
+
+		// the fractional digits in limbs of 9 decimal (7 hexadecimal) digits: the F + 1 first ones are enough to round the
+		// F bits of the fraction (the ties have F + 1 digits), the next ones only tell if the value is above a tie
+		const unsigned  limb_digits = (base == 10) ? 9 : 7;
+		const uint32_t  limb_base   = (base == 10) ? 1000000000 : uint32_t(1) << 28;
+		const ptrdiff_t k           = std::max<ptrdiff_t>(0, std::min<ptrdiff_t>(ptrdiff_t(F) + 1, n_digits - point));
+		const size_t    l           = size_t(k + limb_digits - 1) / limb_digits;
+
+		uint32_t limbs[(F + 1 + 6) / 7 + 1] = {};
+		uint32_t limb = 0;
+		for (ptrdiff_t d = 0; d < k; d++)
+		{
+			limb = limb * base + digit_at(point + d);
+			if ((d + 1) % limb_digits == 0)
+				limbs[d / limb_digits] = limb, limb = 0;
+		}
+		if (k % limb_digits != 0) // the last limb is padded with zeros
+		{
+			for (size_t d = size_t(k) % limb_digits; d < limb_digits; d++)
+				limb *= base;
+			limbs[l - 1] = limb;
+		}
+
+		bool sticky = false;
+		for (ptrdiff_t j = std::max<ptrdiff_t>(point + k, 0); j < n_digits; j++)
+			sticky |= digit_at(j) != 0;
+
+		// the bits of the fraction, 32 at once from the most significant one, then the round bit
+		for (size_t r = F; r > 0 && !is_zero(limbs, l); )
+		{
+			const size_t s = std::min<size_t>(r, 32);
+			r -= s;
+
+			const uint64_t b = next_bits<limb_base>(limbs, l, s);
+			m[r / 64] |= b << (r % 64);
+			if (r % 64 + s > 64 && r / 64 + 1 < W)
+				m[r / 64 + 1] |= b >> (64 - r % 64);
+		}
+		const bool round = next_bits<limb_base>(limbs, l, 1) != 0;
+		sticky |= !is_zero(limbs, l);
+
+		// rounding of the signed value (floor for TRUNCATED, floor(x + 1/2) for ROUNDED_HALF_UP) on its magnitude
+		const bool up = (R == FP_numeric::Rounding_type::TRUNCATED)         ? neg && (round || sticky)
+		              : (R == FP_numeric::Rounding_type::ROUNDED_HALF_UP)   ? round && (!neg || sticky)
+		              : (R == FP_numeric::Rounding_type::ROUNDED_HALF_EVEN) ? round && (sticky || (m[0] & 1))
+		                                                                    : false; // ROUNDED_TO_ZERO
+		if (up)
+			overflow |= mul_add(m, W, 1, 1) != 0;
+		if (bits < 64)
+			overflow |= (m[0] >> (bits % 64)) != 0;
+
+		utype u = 0;
+		for (size_t i = 0; i < W; i++)
+			u |= utype(utype(m[i]) << (i*64 % bits));
+
+		const utype max_magnitude = utype(FP::max().get_data());
+		const utype min_magnitude = utype(utype(0) - utype(FP::min().get_data()));
+		if (overflow || u > (neg ? min_magnitude : max_magnitude))
+		{
+			x = neg ? FP::min() : FP::max();
+			return {p, std::errc::result_out_of_range};
+		}
+
+		x.set_data(base_type(neg ? utype(utype(0) - u) : u));
+		return {p, std::errc()};
+	}
+}
+}
+
+template <FP_numeric::Rounding_type R, size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline FP_numeric::from_chars_result
+FP_numeric::from_chars(const char* first, const char* last, Fixed_Point_Static<T,F,A>& x) noexcept
+{
+	using FP_numeric::__chars::digit;
+
+	const char* p = first;
+	const bool neg = (p != last && *p == '-');
+	if (p != last && (*p == '-' || *p == '+'))
+		p++;
+
+	// 0x followed by an hexadecimal digit (or a point and an hexadecimal digit) selects the base 16
+	if (last - p > 2 && p[0] == '0' && (p[1] | 0x20) == 'x'
+	    && (digit(p[2], 16) >= 0 || (p[2] == '.' && last - p > 3 && digit(p[3], 16) >= 0)))
+		return FP_numeric::__chars::parse<R, 16>(first, p + 2, last, neg, x);
+
+	return FP_numeric::__chars::parse<R, 10>(first, p, last, neg, x);
+}
+
+template <FP_numeric::Rounding_type R, size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline size_t FP_numeric::read_column(const char* first, const char* last, Fixed_Point_Static<T,F,A>* result, size_t n,
+                                      size_t column, char delimiter)
+{
+	const auto is_blank = [](const char c) { return c == ' ' || c == '\t' || c == '\r'; };
+
+	size_t count = 0, line = 1;
+	for (const char* p = first; p != last && count < n; line++)
+	{
+		const char* eol = static_cast<const char*>(std::memchr(p, '\n', size_t(last - p)));
+		eol = (eol != nullptr) ? eol : last;
+
+		const char* q = p;
+		while (q != eol && is_blank(*q))
+			q++;
+
+		p = (eol != last) ? eol + 1 : last;
+		if (q == eol) // empty line
+			continue;
+
+		// the first fields of the line are skipped
+		for (size_t c = 0; c < column && q != eol; c++)
+		{
+			if (delimiter == ' ')
+				while (q != eol && !is_blank(*q))
+					q++;
+			else
+			{
+				q  = std::find(q, eol, delimiter);
+				q += (q != eol);
+			}
+			while (q != eol && is_blank(*q))
+				q++;
+		}
+
+		const FP_numeric::from_chars_result res = FP_numeric::from_chars<R>(q, eol, result[count]);
+
+		const char* e = res.ptr;
+		while (e != eol && is_blank(*e))
+			e++;
+
+		if (res.ec == std::errc::invalid_argument || (e != eol && (delimiter == ' ' ? e == res.ptr : *e != delimiter)))
+			throw std::invalid_argument("Error in read_column : no number in column " + std::to_string(column)
+			                            + " of line " + std::to_string(line) + "!");
+		count++;
+	}
+
+	return count;
+}
+
+#endif /* FIXED_POINT_STATIC_CHARCONV_HXX_ */
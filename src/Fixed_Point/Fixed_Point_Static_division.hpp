@@ -0,0 +1,62 @@
+#ifndef FIXED_POINT_STATIC_DIVISION_HPP_
+#define FIXED_POINT_STATIC_DIVISION_HPP_
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// Division variants **************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// same result than FP_numeric::div but without exception: a division by zero is saturated at the max() of the
+	// result type if numerator > 0, at its min() if numerator < 0, and is 0 for 0 / 0
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+	constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+	div_sat(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator) noexcept;
+
+	// quotient truncated toward zero on Fq fractional bits and exact remainder = numerator - quotient * denominator
+	// (assigned to remainder), both given by a single integer division instead of a division, a product and a
+	// subtraction. If the quotient saturates, the remainder is computed from the saturated quotient.
+	// Same results than FP_numeric::div(numerator, denominator, quotient, remainder) when Fq <= Fn+Td-Fd, the other
+	// cases being more accurate (div drops the low bits of the quotient beyond its Fn+Td-Fd fractional bits)
+	// throw std::domain_error on a division by zero
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr>
+	constexpr void
+	divmod(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator,
+	             Fixed_Point_Static<Tq, Fq>& quotient ,       Fixed_Point_Static<Tr, Fr>& remainder);
+
+	// approximated division by the reciprocal of the denominator, without hardware division: the denominator is
+	// normalized in [0.5, 1), its reciprocal is seeded from a table of 256 values then refined by 2 Newton-Raphson
+	// iterations on 32 bits, and multiplied by the numerator (Tn and Td <= 32)
+	// The result has the type of FP_numeric::div and is truncated toward zero: it differs from the exact quotient
+	// of less than 2^-28 of its magnitude + 1 unit of its last place. A division by zero is saturated as div_sat
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+	typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+	div_fast(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator) noexcept;
+}
+
+/// ********************************************************************************************************************
+/// Division by a constant *********************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// divide numerator by the constant Fixed_Point_Static<Td,Fd> of raw data D: the same bits than
+	// numerator / denominator, given by a product and a shift by a magic number computed at compile time
+	// D is the get_data() of the denominator, e.g. with constexpr FP_S<16,8> k = 3 : div_by<16,8, k.get_data()>(x)
+	template <size_t Td, size_t Fd, int64_t D, size_t Tn, size_t Fn>
+	constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+	div_by(const Fixed_Point_Static<Tn, Fn>& numerator) noexcept;
+
+	// divide the n fixed points of numerator by the same constant, write the results in res and return res + n
+	template <size_t Td, size_t Fd, int64_t D, size_t Tn, size_t Fn>
+	typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type*
+	div_by_n(const Fixed_Point_Static<Tn, Fn>* numerator, size_t n,
+	         typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type* res) noexcept;
+}
+
+#include "Fixed_Point_Static_division.hxx"
+
+#endif /* FIXED_POINT_STATIC_DIVISION_HPP_ */
@@ -0,0 +1,297 @@
+#ifndef FIXED_POINT_STATIC_DIVISION_HXX_
+#define FIXED_POINT_STATIC_DIVISION_HXX_
+
+#include "Fixed_Point_Static_division.hpp"
+
+/// ********************************************************************************************************************
+/// Division tools *****************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __division
+{
+	// raw value of a division by zero of a numerator of sign num_data saturated in FP
+	template <typename FP, typename T>
+	constexpr typename FP::base_type saturated(const T num_data) noexcept
+	{
+		return (num_data > 0)? FP::max().get_data() : (num_data < 0)? FP::min().get_data() : 0;
+	}
+
+	// number of leading zeros of x != 0
+	inline int leading_zeros(uint32_t x) noexcept
+	{
+	#if defined(__GNUC__)
+		return __builtin_clz(x);
+	#else
+		int n = 0;
+		for (; !(x & 0x80000000u); x <<= 1)
+			n++;
+		return n;
+	#endif
+	}
+
+	// seeds[i] = 2^30 / x in the middle of the i-th interval [0.5 + i/512, 0.5 + (i+1)/512)
+	struct reciprocal_seeds
+	{
+		uint32_t seeds[256];
+
+		constexpr reciprocal_seeds() : seeds()
+		{
+			for (size_t i = 0; i < 256; i++)
+				seeds[i] = uint32_t((uint64_t(1) << 40) / (513 + 2*i));
+		}
+	};
+
+	// return y ~ 2^62 / m for m in [2^31, 2^32): the reciprocal of x = m / 2^32 in [0.5, 1) with 30 fractional bits
+	// each iteration y = y + y * (1 - x*y) doubles the 9 exact bits of the seed, up to the precision of the format
+	inline uint32_t reciprocal(uint32_t m) noexcept
+	{
+		static constexpr reciprocal_seeds table{};
+
+		int64_t y = table.seeds[(m >> 23) & 0xFF];
+		for (int i = 0; i < 2; i++)
+		{
+			const int64_t e = (int64_t)((uint64_t(1) << 62) - uint64_t(m) * uint64_t(y)); // 2^62 * (1 - x*y)
+			y += (y * (e >> 32)) >> 30;
+		}
+		return (uint32_t)y;
+	}
+
+	// number of significant bits of x
+	template <typename U>
+	constexpr size_t bit_width(U x) noexcept
+	{
+		size_t n = 0;
+		for (; x; x >>= 1)
+			n++;
+		return n;
+	}
+
+	// number of trailing zeros of x (0 for 0)
+	template <typename U>
+	constexpr size_t trailing_zeros(U x) noexcept
+	{
+		size_t n = 0;
+		for (; x && !(x & 1); x >>= 1)
+			n++;
+		return n;
+	}
+
+	// return ceil(2^e / d) by a long division, 1 bit at a time
+	template <typename U>
+	constexpr U ceil_pow2_div(size_t e, U d) noexcept
+	{
+		U q = 0, r = 0;
+		for (size_t i = e + 1; i-- > 0;)
+		{
+			r = U(r << 1) | U(i == e);
+			q = U(q << 1) | U(r >= d);
+			if (r >= d)
+				r -= d;
+		}
+		return q + U(r != 0);
+	}
+
+	// operator/ computes trunc(N * 2^k / D) with k = Td, N the data of the numerator and D the raw data of the
+	// denominator. With D = d * 2^t (d odd, or t = k) and |N| <= 2^w:
+	// |N| * 2^(k-t) / d = floor(|N| * m / 2^s) for m = ceil(2^(s+k-t) / d) and s = w + ceil(log2(d)),
+	// since the error |N| * (m - 2^(s+k-t) / d) / 2^s < 1/d is smaller than the gap to the next integer
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+	struct divisor
+	{
+		using res_type = typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type;
+		using big_type = typename res_type::base_type;
+		using ubig     = typename FP_numeric::unsigned_type<big_type>::type;
+
+		static_assert(D != 0, "Error in div_by : division by zero!");
+
+		static constexpr big_type den     = (big_type)D;
+		static constexpr ubig     den_abs = (den < 0)? ubig(-den) : ubig(den);
+
+		static constexpr size_t k  = Td;
+		static constexpr size_t tz = FP_numeric::__division::trailing_zeros(den_abs);
+		static constexpr size_t t  = (tz < k)? tz : k;
+		static constexpr ubig   d  = den_abs >> t;
+		static constexpr size_t w  = Tn - 1;
+		static constexpr size_t l  = FP_numeric::__division::bit_width(ubig(d - 1)); // ceil(log2(d))
+		static constexpr size_t s  = w + l;
+
+		// |N| * m and the long division of 2^(s+k-t) by d
+		static constexpr size_t bits     = 2*w + k - t + 2;
+		static constexpr size_t mul_bits = (bits > FP_numeric::__division::bit_width(d) + 1)? bits
+		                                                                                    : FP_numeric::__division::bit_width(d) + 1;
+		using mul_int  = typename FP_numeric::matching_type<mul_bits>::type;
+		using mul_type = typename FP_numeric::unsigned_type<typename std::conditional<std::is_void<mul_int>::value,
+		                                                                              int64_t, mul_int>::type>::type;
+
+		static_assert(!std::is_void<mul_int>::value, "Error in div_by : the product by the magic number has no matching type!");
+
+		static constexpr mul_type m = FP_numeric::__division::ceil_pow2_div(s + k - t, mul_type(d));
+
+		static constexpr big_type divide(const big_type num_data) noexcept
+		{
+			const mul_type q = mul_type(mul_type((num_data < 0)? ubig(-num_data) : ubig(num_data)) * m) >> s;
+			return ((num_data < 0) != (den < 0))? -(big_type)q : (big_type)q;
+		}
+	};
+}
+}
+
+// definitions of the constants (needed when mul_type is a double_word or multi_word passed by reference before C++17)
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr typename FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::big_type FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::den;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr typename FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::ubig FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::den_abs;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::k;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::tz;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::t;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr typename FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::ubig FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::d;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::w;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::l;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::s;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::bits;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr size_t FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::mul_bits;
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, int64_t D>
+constexpr typename FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::mul_type FP_numeric::__division::divisor<Tn,Fn,Td,Fd,D>::m;
+
+/// ********************************************************************************************************************
+/// Division variants **************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+FP_numeric::div_sat(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator) noexcept
+{
+	using __res_t  = typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type;
+	using big_type = typename __res_t::base_type;
+	__res_t quotient;
+
+	// aligned as by FP_numeric::div: the numerator shifted of Td bits, the raw denominator
+	big_type num_data = FP_numeric::shift_fract((big_type)numerator.get_data(), __res_t::Fb + Fd, Fn);
+	big_type den_data = (big_type)denominator.get_data();
+
+	// divide by 1 instead of 0 and select the saturated value afterwards: no branch before the division
+	const bool zero = (den_data == 0);
+	const big_type q = num_data / (den_data | big_type(zero));
+
+	quotient.set_data(zero? FP_numeric::__division::saturated<__res_t>(num_data) : q);
+	return quotient;
+}
+
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr>
+constexpr void
+FP_numeric::divmod(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator,
+                         Fixed_Point_Static<Tq, Fq>& quotient ,       Fixed_Point_Static<Tr, Fr>& remainder)
+{
+	if(!denominator)
+		throw std::domain_error("Division by zero!");
+
+	using __quo_t = Fixed_Point_Static<Tq, Fq>;
+
+	// numerator and denominator * 2^Fq aligned on Fa fractional bits: their integer quotient is the raw quotient
+	// on Fq bits and their integer remainder the raw remainder on Fa bits
+	constexpr size_t Fa    = (Fn > Fq + Fd)? Fn : Fq + Fd;
+	constexpr size_t Tnum  = Tn + Fa - Fn;
+	constexpr size_t Tden  = Td + Fa - Fq - Fd;
+	constexpr size_t Trem  = (Tden > Fa)? Tden : Fa + 1; // |remainder| < |denominator| * 2^-Fq
+
+	using big_type = typename FP_numeric::matching_type<(Tnum > Tden)? Tnum : Tden>::type;
+	using cmp_type = typename FP_numeric::biggest_type<big_type, typename __quo_t::base_type>::type;
+	static_assert(!std::is_void<big_type>::value, "Error in divmod : the aligned operands have no matching type!");
+
+	const big_type num_data = FP_numeric::shift_fract((big_type)numerator.  get_data(), Fa,      Fn);
+	const big_type den_data = FP_numeric::shift_fract((big_type)denominator.get_data(), Fa - Fq, Fd);
+
+	// a single division gives both results
+	const big_type q = num_data / den_data;
+	const big_type r = num_data % den_data;
+
+	if ((cmp_type)q > (cmp_type)__quo_t::max().get_data() || (cmp_type)q < (cmp_type)__quo_t::min().get_data())
+	{
+		quotient  = (q > 0)? __quo_t::max() : __quo_t::min();
+		remainder = FP_numeric::sub(numerator, FP_numeric::mul(quotient, denominator));
+		return;
+	}
+
+	Fixed_Point_Static<Trem, Fa> rem;
+	quotient.set_data(q);
+	rem.set_data(r);
+	remainder = rem;
+}
+
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
+typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+FP_numeric::div_fast(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator) noexcept
+{
+	static_assert(Tn <= 32 && Td <= 32, "Error in div_fast : the operands have more than 32 bits!");
+
+	using __res_t  = typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type;
+	using big_type = typename __res_t::base_type;
+	__res_t quotient;
+
+	const int64_t num_data = numerator.  get_data();
+	const int64_t den_data = denominator.get_data();
+
+	if (den_data == 0)
+	{
+		quotient.set_data(FP_numeric::__division::saturated<__res_t>(num_data));
+		return quotient;
+	}
+
+	// |numerator| * 2^Td / |denominator| is the raw magnitude of the result on its Fn+Td-Fd fractional bits
+	// with |denominator| = m * 2^-s, m in [2^31, 2^32) and 1/m ~ reciprocal(m) * 2^-62
+	const uint64_t num_abs = (num_data < 0)? uint64_t(-num_data) : uint64_t(num_data);
+	const uint32_t den_abs = (den_data < 0)? uint32_t(-den_data) : uint32_t(den_data);
+
+	// the product is doubled before its right shift of 62 - s - Td + 1 (in [0, 30]) to never shift left
+	const int      s = FP_numeric::__division::leading_zeros(den_abs);
+	const uint64_t p = num_abs * FP_numeric::__division::reciprocal(den_abs << s); // < 2^62
+	const uint64_t q = (p << 1) >> (63 - s - (int)Td);
+
+	quotient.set_data(((num_data < 0) != (den_data < 0))? -(big_type)q : (big_type)q);
+	return quotient;
+}
+
+/// ********************************************************************************************************************
+/// Division by a constant *********************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t Td, size_t Fd, int64_t D, size_t Tn, size_t Fn>
+constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
+FP_numeric::div_by(const Fixed_Point_Static<Tn, Fn>& numerator) noexcept
+{
+	using divisor = FP_numeric::__division::divisor<Tn, Fn, Td, Fd, D>;
+
+	typename divisor::res_type quotient;
+	quotient.set_data(divisor::divide(numerator.get_data()));
+	return quotient;
+}
+
+template <size_t Td, size_t Fd, int64_t D, size_t Tn, size_t Fn>
+typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type*
+FP_numeric::div_by_n(const Fixed_Point_Static<Tn, Fn>* numerator, size_t n,
+                     typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type* res) noexcept
+{
+	using divisor = FP_numeric::__division::divisor<Tn, Fn, Td, Fd, D>;
+
+	const typename Fixed_Point_Static<Tn, Fn>::base_type* num = FP_numeric::__batch::raw(numerator);
+	typename divisor::big_type*                            out = FP_numeric::__batch::raw(res);
+
+	// the results are already sign-extended on the result type: no set_data needed
+	for (size_t i = 0; i < n; i++)
+		out[i] = divisor::divide(num[i]);
+
+	return res + n;
+}
+
+#endif /* FIXED_POINT_STATIC_DIVISION_HXX_ */
@@ -0,0 +1,96 @@
+#ifndef FIXED_POINT_STATIC_DSP_HPP_
+#define FIXED_POINT_STATIC_DSP_HPP_
+
+#include <algorithm>
+#include <cassert>
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// Tools to get the type of a sum of N terms **************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// type of the exact sum of N fixed points FP: the terms are added by pairs with the add_res_type rules,
+	// so the result has ceil(log2(N)) guard bits
+	template <typename FP, size_t N>
+	struct sum_res_type;
+
+	// type of the exact sum of N products of Fixed_Point_Static<Tl,Fl> by Fixed_Point_Static<Tr,Fr>
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, size_t N>
+	struct dot_res_type_d;
+
+	template <typename FPl, typename FPr, size_t N>
+	struct dot_res_type;
+}
+
+/// ********************************************************************************************************************
+/// Dot product ********************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// return the exact sum of the n <= N products lhs[i] * rhs[i]: the same bits than the sum of the products with the
+	// scalar operators in the result type, which has enough guard bits to never overflow (n > N is asserted)
+	// vectorized when lhs and rhs have both 16 bits base types, or both 32 bits base types (SSE4.1 or AVX2)
+	template <size_t N, size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	typename FP_numeric::dot_res_type_d<Tl, Fl, Tr, Fr, N>::type
+	dot(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n = N);
+}
+
+/// ********************************************************************************************************************
+/// FIR filter *********************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// streaming FIR filter of Ntaps coefficients Fixed_Point_Static<Tc,Fc> on samples Fixed_Point_Static<Tx,Fx>:
+	// y[n] = sum of coefs[k] * x[n-k] for k in [0, Ntaps), computed exactly by FP_numeric::dot
+	// The samples are appended in a history buffer of Ntaps - 1 + block samples: the last Ntaps samples are always
+	// contiguous and the delay line is not shifted at each sample, only once every block samples
+	template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+	class fir
+	{
+	public:
+		using coef_type   = Fixed_Point_Static<Tc, Fc>;
+		using sample_type = Fixed_Point_Static<Tx, Fx>;
+		using res_type    = typename FP_numeric::dot_res_type_d<Tc, Fc, Tx, Fx, Ntaps>::type;
+
+		static_assert(Ntaps > 0, "Error in fir : Ntaps == 0!");
+
+		static const size_t taps  = Ntaps;
+		static const size_t block = (Ntaps > 256)? Ntaps : 256;
+
+	private:
+		coef_type   __coefs  [Ntaps];             // reversed: __coefs[Ntaps-1] multiplies the last sample
+		sample_type __history[Ntaps - 1 + block];
+		size_t      __len;                        // the last Ntaps samples are __history[__len-Ntaps .. __len-1]
+
+	public: // constructors
+		fir(); // null coefficients
+
+		// coefs[0] multiplies the last sample, coefs[Ntaps-1] the oldest one
+		explicit fir(const coef_type* coefs);
+
+	public:
+		void set_coefs(const coef_type* coefs);
+		void reset(); // clear the history
+
+		// push the sample x and return the new output
+		res_type operator()(const sample_type& x);
+
+		// filter the n samples of x, write the outputs in y (saturated as an assignment if y is smaller than
+		// res_type) and return y + n
+		template <size_t To, size_t Fo>
+		Fixed_Point_Static<To, Fo>* process(const sample_type* x, size_t n, Fixed_Point_Static<To, Fo>* y);
+
+	private:
+		void rewind(); // move the last Ntaps - 1 samples at the beginning of the history
+	};
+}
+
+#include "Fixed_Point_Static_dsp.hxx"
+
+#endif /* FIXED_POINT_STATIC_DSP_HPP_ */
@@ -0,0 +1,297 @@
+#ifndef FIXED_POINT_STATIC_DSP_HXX_
+#define FIXED_POINT_STATIC_DSP_HXX_
+
+#include "Fixed_Point_Static_dsp.hpp"
+
+/// ********************************************************************************************************************
+/// Tools to get the type of a sum of N terms **************************************************************************
+/// ********************************************************************************************************************
+
+template <typename FP, size_t N>
+struct FP_numeric::sum_res_type
+{
+	using type = typename FP_numeric::add_res_type<typename FP_numeric::sum_res_type<FP, (N+1)/2>::type,
+	                                               typename FP_numeric::sum_res_type<FP,  N   /2>::type>::type;
+};
+
+namespace FP_numeric
+{
+	template <typename FP>
+	struct sum_res_type<FP, 1>
+	{
+		using type = FP;
+	};
+
+	template <typename FP>
+	struct sum_res_type<FP, 0>
+	{
+		using type = FP;
+	};
+}
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, size_t N>
+struct FP_numeric::dot_res_type_d
+{
+	using type = typename FP_numeric::sum_res_type<typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type, N>::type;
+};
+
+template <typename FPl, typename FPr, size_t N>
+struct FP_numeric::dot_res_type
+{
+	using type = typename FP_numeric::dot_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb, N>::type;
+};
+
+/// ********************************************************************************************************************
+/// Dot product kernels ************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __batch
+{
+	// the products are summed on the base_type of the result: the sum is exact as long as the final one fits in it, even
+	// if the wider lanes wrap around, as the integer additions are modular
+	template <typename FPl, typename FPr, typename FPo>
+	struct has_dot
+	{
+		using Bl = typename FPl::base_type;
+		using Br = typename FPr::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const bool value =
+		#if defined(FP_BATCH_SIMD)
+			std::is_same<Bl, Br>::value
+			&& (   (std::is_same<Bl, int16_t>::value && (std::is_same<Bo, int32_t>::value || std::is_same<Bo, int64_t>::value))
+		#if defined(__AVX2__) || defined(__SSE4_1__)
+			    || (std::is_same<Bl, int32_t>::value &&  std::is_same<Bo, int64_t>::value)
+		#endif
+			   );
+		#else
+			false;
+		#endif
+	};
+
+	// sum the products of the first elements of lhs and rhs by whole vectors in res and return the number of summed ones
+	// (the scalar kernel sums none of them)
+	template <typename FPl, typename FPr, typename FPo, bool vectorized = has_dot<FPl, FPr, FPo>::value>
+	struct dot_kernel
+	{
+		using Bo = typename FPo::base_type;
+
+		static size_t run(const FPl*, const FPr*, size_t, Bo&) { return 0; }
+	};
+
+#if defined(FP_BATCH_SIMD)
+
+	#if defined(__AVX2__)
+		#define FP_MM(intrinsic) _mm256_##intrinsic
+	#else
+		#define FP_MM(intrinsic) _mm_##intrinsic
+	#endif
+
+	// horizontal sum of the lanes of v0 and v1 (modular)
+	template <typename B>
+	inline B reduce_add(vec v0, vec v1)
+	{
+		using ubase_type = typename FP_numeric::unsigned_type<B>::type;
+
+		vec v = (sizeof(B) == 8)? ops<int64_t>::add(v0, v1) : ops<int32_t>::add(v0, v1);
+
+	#if defined(__AVX2__)
+		__m128i lo = _mm256_castsi256_si128(v), hi = _mm256_extracti128_si256(v, 1);
+		__m128i h  = (sizeof(B) == 8)? _mm_add_epi64(lo, hi) : _mm_add_epi32(lo, hi);
+	#else
+		__m128i h  = v;
+	#endif
+
+		ubase_type lanes[sizeof(__m128i) / sizeof(B)];
+		_mm_storeu_si128((__m128i*)lanes, h);
+
+		ubase_type sum = 0;
+		for (size_t i = 0; i < sizeof(__m128i) / sizeof(B); i++)
+			sum += lanes[i];
+		return (B)sum;
+	}
+
+	// multiply-add of the Bi lanes of a and b on the Bo lanes of acc0 and acc1:
+	// pairs of 16 bits products summed in 32 bits lanes (the pair can not overflow for values in [min, max])
+	// then accumulated on the 32 or 64 bits lanes, or 32 bits products on 64 bits lanes (even and odd ones)
+	template <typename Bi, typename Bo>
+	struct dot_lanes
+	{
+		static const size_t lanes = sizeof(vec) / sizeof(Bi);
+
+		static vec products(vec a, vec b, vec& odd, std::integral_constant<size_t, 2>)
+		{
+			odd = zero();
+			return FP_MM(madd_epi16)(a, b);
+		}
+
+	#if defined(__AVX2__) || defined(__SSE4_1__)
+		static vec products(vec a, vec b, vec& odd, std::integral_constant<size_t, 4>)
+		{
+			odd = FP_MM(mul_epi32)(FP_MM(srli_epi64)(a, 32), FP_MM(srli_epi64)(b, 32));
+			return FP_MM(mul_epi32)(a, b);
+		}
+	#endif
+
+		static void accumulate(vec p, vec, vec& acc0, vec&, std::integral_constant<size_t, 4>)
+		{
+			acc0 = ops<int32_t>::add(acc0, p);
+		}
+
+		static void accumulate(vec p, vec odd, vec& acc0, vec& acc1, std::integral_constant<size_t, 8>)
+		{
+			if (sizeof(Bi) == 2) // sign extension of the 32 bits pairs
+			{
+				const vec sign = FP_MM(srai_epi32)(p, 31);
+				acc0 = ops<int64_t>::add(acc0, FP_MM(unpacklo_epi32)(p, sign));
+				acc1 = ops<int64_t>::add(acc1, FP_MM(unpackhi_epi32)(p, sign));
+			}
+			else // already 64 bits products
+			{
+				acc0 = ops<int64_t>::add(acc0, p);
+				acc1 = ops<int64_t>::add(acc1, odd);
+			}
+		}
+
+		static void multiply_add(vec a, vec b, vec& acc0, vec& acc1)
+		{
+			vec odd;
+			vec p = products(a, b, odd, std::integral_constant<size_t, sizeof(Bi)>());
+			accumulate(p, odd, acc0, acc1, std::integral_constant<size_t, sizeof(Bo)>());
+		}
+	};
+
+	template <typename FPl, typename FPr, typename FPo>
+	struct dot_kernel<FPl, FPr, FPo, true>
+	{
+		using Bi = typename FPl::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const size_t lanes = dot_lanes<Bi, Bo>::lanes;
+
+		static size_t run(const FPl* lhs, const FPr* rhs, size_t n, Bo& res)
+		{
+			const Bi* l = raw(lhs);
+			const Bi* r = raw(rhs);
+
+			vec acc0 = zero(), acc1 = zero();
+
+			size_t i = 0;
+			for(; i + lanes <= n; i += lanes)
+				dot_lanes<Bi, Bo>::multiply_add(load(l + i), load(r + i), acc0, acc1);
+
+			res = reduce_add<Bo>(acc0, acc1);
+			return i;
+		}
+	};
+
+	#undef FP_MM
+
+#endif // FP_BATCH_SIMD
+}
+}
+
+/// ********************************************************************************************************************
+/// Dot product ********************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t N, size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+typename FP_numeric::dot_res_type_d<Tl, Fl, Tr, Fr, N>::type
+FP_numeric::dot(const Fixed_Point_Static<Tl, Fl>* lhs, const Fixed_Point_Static<Tr, Fr>* rhs, size_t n)
+{
+	using res_type  = typename FP_numeric::dot_res_type_d<Tl, Fl, Tr, Fr, N>::type;
+	using base_type = typename res_type::base_type;
+
+	// the guard bits of res_type are only enough for N products
+	assert(n <= N && "Error in dot : n > N!");
+
+	base_type sum = 0;
+	const size_t done = __batch::dot_kernel<Fixed_Point_Static<Tl, Fl>, Fixed_Point_Static<Tr, Fr>, res_type>::run(lhs, rhs, n, sum);
+
+	// the products have the fractional bits of the result
+	for(size_t i = done; i < n; i++)
+		sum += (base_type)lhs[i].get_data() * (base_type)rhs[i].get_data();
+
+	res_type res;
+	res.set_data(sum);
+	return res;
+}
+
+/// ********************************************************************************************************************
+/// FIR filter *********************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::fir()
+: __coefs(), __history(), __len(Ntaps - 1)
+{
+}
+
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::fir(const coef_type* coefs)
+: __coefs(), __history(), __len(Ntaps - 1)
+{
+	set_coefs(coefs);
+}
+
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+void FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::set_coefs(const coef_type* coefs)
+{
+	for (size_t k = 0; k < Ntaps; k++)
+		__coefs[Ntaps - 1 - k] = coefs[k];
+}
+
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+void FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::reset()
+{
+	std::fill(__history, __history + Ntaps - 1 + block, sample_type::zero());
+	__len = Ntaps - 1;
+}
+
+// the last Ntaps - 1 samples are moved at the beginning of the history once it is full, so once every block samples
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+void FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::rewind()
+{
+	std::copy(__history + __len - (Ntaps - 1), __history + __len, __history);
+	__len = Ntaps - 1;
+}
+
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+typename FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::res_type FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::operator()(const sample_type& x)
+{
+	if (__len == Ntaps - 1 + block)
+		rewind();
+
+	__history[__len++] = x;
+	return FP_numeric::dot<Ntaps>(__coefs, __history + __len - Ntaps);
+}
+
+// the samples are copied by blocks before computing their outputs: the loads of the dot products never wait for the
+// store of the sample just pushed
+template <size_t Tc, size_t Fc, size_t Tx, size_t Fx, size_t Ntaps>
+template <size_t To, size_t Fo>
+Fixed_Point_Static<To, Fo>* FP_numeric::fir<Tc,Fc,Tx,Fx,Ntaps>::process(const sample_type* x, size_t n, Fixed_Point_Static<To, Fo>* y)
+{
+	while (n > 0)
+	{
+		if (__len == Ntaps - 1 + block)
+			rewind();
+
+		const size_t m = std::min(n, Ntaps - 1 + block - __len);
+		std::copy(x, x + m, __history + __len);
+
+		const sample_type* window = __history + __len - (Ntaps - 1);
+		for (size_t i = 0; i < m; i++)
+			y[i] = FP_numeric::dot<Ntaps>(__coefs, window + i);
+
+		__len += m;
+		x += m;
+		y += m;
+		n -= m;
+	}
+	return y;
+}
+
+#endif /* FIXED_POINT_STATIC_DSP_HXX_ */
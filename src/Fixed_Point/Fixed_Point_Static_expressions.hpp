@@ -0,0 +1,118 @@
+#ifndef FIXED_POINT_STATIC_EXPRESSIONS_HPP_
+#define FIXED_POINT_STATIC_EXPRESSIONS_HPP_
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Lazy expressions of fixed points ***********************************************************************************
+/// ********************************************************************************************************************
+
+// Opt-in: FP_numeric::lazy(a) * b + c builds a tree instead of a Fixed_Point_Static per operator.
+// The tree has the same result type than a * b + c and is evaluated once, on the base_type of this result,
+// when it is assigned to a Fixed_Point_Static (saturated once in its quantification) or when eval() is called.
+// The intermediate results are neither sign extended nor saturated: for values in [min, max] they are the same
+// than the ones of the operators as every intermediate result type is smaller than the final one.
+
+namespace FP_numeric
+{
+	enum class Expression_op {ADD, SUB, MUL};
+
+	// leaf of an expression: the fixed point is kept by value (a single base_type word)
+	template <size_t T, size_t F>
+	struct terminal_expression
+	{
+		using type = Fixed_Point_Static<T,F>;
+
+		type value;
+
+		// return the raw value computed on the C integer type, with the fractional bits of type
+		template <typename C>
+		constexpr C eval_raw() const;
+
+		constexpr type eval() const;
+	};
+
+	template <Expression_op op, typename L, typename R>
+	struct binary_expression
+	{
+		using type = typename std::conditional<op == Expression_op::ADD, typename FP_numeric::add_res_type<typename L::type, typename R::type>::type,
+		             typename std::conditional<op == Expression_op::SUB, typename FP_numeric::sub_res_type<typename L::type, typename R::type>::type,
+		                                                                 typename FP_numeric::mul_res_type<typename L::type, typename R::type>::type
+		             >::type>::type;
+
+		L lhs;
+		R rhs;
+
+		template <typename C>
+		constexpr C eval_raw() const;
+
+		constexpr type eval() const;
+	};
+
+	template <size_t T, size_t F>
+	struct is_expression<terminal_expression<T,F>> : public std::true_type { };
+
+	template <Expression_op op, typename L, typename R>
+	struct is_expression<binary_expression<op, L, R>> : public std::true_type { };
+
+	// the expression type of an operand: itself if it is already an expression, else a terminal
+	template <typename X, bool = is_expression<X>::value>
+	struct expression_of
+	{
+		using type = X;
+		static constexpr const X& make(const X& x) { return x; }
+	};
+
+	template <typename X>
+	struct expression_of<X, false>
+	{
+		using type = terminal_expression<X::Tb, X::Fb>;
+		static constexpr type make(const X& x) { return type{x}; }
+	};
+
+	// true if lhs op rhs builds an expression: one of them is an expression and the other an expression or a FP_S
+	template <typename L, typename R>
+	struct is_expression_operation
+	{
+		static const bool value = (is_expression<L>::value || is_expression<R>::value)
+		                       && (is_expression<L>::value || is_FP_S<L>::value)
+		                       && (is_expression<R>::value || is_FP_S<R>::value);
+	};
+
+	// the expression of lhs op rhs, no type if it is not an expression operation (the operands are not instantiated)
+	template <Expression_op op, typename L, typename R, bool = is_expression_operation<L, R>::value>
+	struct expression_operation
+	{
+	};
+
+	template <Expression_op op, typename L, typename R>
+	struct expression_operation<op, L, R, true>
+	{
+		using type = binary_expression<op, typename expression_of<L>::type, typename expression_of<R>::type>;
+	};
+
+	template <Expression_op op, typename L, typename R>
+	using expression_operation_t = typename expression_operation<op, L, R>::type;
+
+	// start a lazy expression with x
+	template <size_t T, size_t F>
+	constexpr terminal_expression<T,F> lazy(const Fixed_Point_Static<T,F>& x);
+
+	// evaluate the expression e in its result type
+	template <typename E>
+	constexpr typename std::enable_if<is_expression<E>::value, typename E::type>::type
+	eval(const E& e);
+
+	template <typename L, typename R>
+	constexpr expression_operation_t<Expression_op::ADD, L, R> operator+(const L& lhs, const R& rhs);
+
+	template <typename L, typename R>
+	constexpr expression_operation_t<Expression_op::SUB, L, R> operator-(const L& lhs, const R& rhs);
+
+	template <typename L, typename R>
+	constexpr expression_operation_t<Expression_op::MUL, L, R> operator*(const L& lhs, const R& rhs);
+}
+
+#include "Fixed_Point_Static_expressions.hxx"
+
+#endif /* FIXED_POINT_STATIC_EXPRESSIONS_HPP_ */
@@ -0,0 +1,80 @@
+#ifndef FIXED_POINT_STATIC_EXPRESSIONS_HXX_
+#define FIXED_POINT_STATIC_EXPRESSIONS_HXX_
+
+#include "Fixed_Point_Static_expressions.hpp"
+
+template <size_t T, size_t F>
+template <typename C>
+constexpr C FP_numeric::terminal_expression<T,F>::eval_raw() const
+{
+	return (C)value.to_raw();
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::terminal_expression<T,F>::type FP_numeric::terminal_expression<T,F>::eval() const
+{
+	return value;
+}
+
+// as FP_numeric::add, sub and mul: the fractional parts are aligned on the one of the result
+template <FP_numeric::Expression_op op, typename L, typename R>
+template <typename C>
+constexpr C FP_numeric::binary_expression<op, L, R>::eval_raw() const
+{
+	switch(op)
+	{
+		case Expression_op::ADD:
+			return (C)(FP_numeric::shift_fract(lhs.template eval_raw<C>(), type::Fb, L::type::Fb)
+			         + FP_numeric::shift_fract(rhs.template eval_raw<C>(), type::Fb, R::type::Fb));
+
+		case Expression_op::SUB:
+			return (C)(FP_numeric::shift_fract(lhs.template eval_raw<C>(), type::Fb, L::type::Fb)
+			         - FP_numeric::shift_fract(rhs.template eval_raw<C>(), type::Fb, R::type::Fb));
+
+		case Expression_op::MUL:
+			return (C)(lhs.template eval_raw<C>() * rhs.template eval_raw<C>());
+	}
+
+	return 0;
+}
+
+template <FP_numeric::Expression_op op, typename L, typename R>
+constexpr typename FP_numeric::binary_expression<op, L, R>::type FP_numeric::binary_expression<op, L, R>::eval() const
+{
+	type res;
+	res.set_data(eval_raw<typename type::base_type>());
+	return res;
+}
+
+template <size_t T, size_t F>
+constexpr FP_numeric::terminal_expression<T,F> FP_numeric::lazy(const Fixed_Point_Static<T,F>& x)
+{
+	return terminal_expression<T,F>{x};
+}
+
+template <typename E>
+constexpr typename std::enable_if<FP_numeric::is_expression<E>::value, typename E::type>::type
+FP_numeric::eval(const E& e)
+{
+	return e.eval();
+}
+
+template <typename L, typename R>
+constexpr FP_numeric::expression_operation_t<FP_numeric::Expression_op::ADD, L, R> FP_numeric::operator+(const L& lhs, const R& rhs)
+{
+	return {expression_of<L>::make(lhs), expression_of<R>::make(rhs)};
+}
+
+template <typename L, typename R>
+constexpr FP_numeric::expression_operation_t<FP_numeric::Expression_op::SUB, L, R> FP_numeric::operator-(const L& lhs, const R& rhs)
+{
+	return {expression_of<L>::make(lhs), expression_of<R>::make(rhs)};
+}
+
+template <typename L, typename R>
+constexpr FP_numeric::expression_operation_t<FP_numeric::Expression_op::MUL, L, R> FP_numeric::operator*(const L& lhs, const R& rhs)
+{
+	return {expression_of<L>::make(lhs), expression_of<R>::make(rhs)};
+}
+
+#endif /* FIXED_POINT_STATIC_EXPRESSIONS_HXX_ */
@@ -0,0 +1,162 @@
+#ifndef FIXED_POINT_STATIC_FILE_HPP_
+#define FIXED_POINT_STATIC_FILE_HPP_
+
+#include <cstdio>
+#include <string>
+#include <stdexcept>
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Column files *******************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// A column file is a column_header followed by the raw base_type data of its values, as in memory (the byte order
+	// of the writing machine): it is reopened by FP_mapped without any parsing nor copy.
+
+	// header of a column file: 64 bytes, so that the raw data which follows it is aligned on a cache line
+	struct column_header
+	{
+		char     magic[8];        // "FPCOLUMN"
+		uint32_t version;         // version of the format
+		uint32_t byte_order;      // 0x01020304 as written by the machine
+		uint32_t total_bits;      // T
+		uint32_t fractional_bits; // F
+		uint32_t arithmetic_type; // A
+		uint32_t base_size;       // sizeof(base_type)
+		uint64_t count;           // number of values
+		uint64_t offset;          // of the raw data from the beginning of the file
+		uint8_t  reserved[16];
+
+		static const uint32_t current_version = 1;
+
+		// header of count values of FP
+		template <typename FP>
+		static column_header of(uint64_t count);
+
+		// true if the magic, the version and the byte order are the ones of this machine
+		bool valid() const;
+
+		// true if the values are FP ones
+		template <typename FP>
+		bool holds() const;
+
+		// quantification of the values as the one of the fixed points (FP_numeric::display_quantification)
+		size_t                      get_total_bits     () const;
+		size_t                      get_fractional_bits() const;
+		FP_numeric::Arithmetic_type get_arithmetic_type() const;
+		std::string                 display_quantification() const;
+	};
+
+	static_assert(sizeof(column_header) == 64, "Error in column_header : the header is not 64 bytes!");
+
+	// read the header of the column file at path (to choose its quantification at run time)
+	// throw std::runtime_error if it cannot be read or if it is not a valid column header
+	column_header file_header(const std::string& path);
+
+	// write the n fixed points of first in a new column file at path (replaced if it exists)
+	// throw std::runtime_error if it cannot be written
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	void write_file(const std::string& path, const Fixed_Point_Static<T,F,A>* first, size_t n);
+}
+
+/// ********************************************************************************************************************
+/// FP_file_writer class ***********************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// writer of a column file by appended blocks (the recordings): the count of the header is updated by close,
+	// called by the destructor (whose errors are then lost: call close to get them)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+	class FP_file_writer
+	{
+	public:
+		using value_type = Fixed_Point_Static<T,F,A>;
+		using size_type  = size_t;
+
+		static_assert(FP_numeric::has_raw_layout<value_type>::value, "Error in FP_file_writer : the layout is not the one of base_type!");
+
+	private:
+		std::string __path;
+		std::FILE*  __file;
+		size_type   __size;
+
+	public: // constructors
+		// create the column file at path (replaced if it exists), throw std::runtime_error if it cannot be created
+		explicit FP_file_writer(const std::string& path);
+		~FP_file_writer();
+
+		FP_file_writer(const FP_file_writer&)            = delete;
+		FP_file_writer& operator=(const FP_file_writer&) = delete;
+
+	public: // writings, throw std::runtime_error on an error
+		void append(const value_type* first, size_type n);
+		void append(const value_type& x);
+
+		// write the count in the header and close the file (nothing if already closed)
+		void close();
+
+		size_type size() const; // number of appended values
+	};
+}
+
+/// ********************************************************************************************************************
+/// FP_mapped class ****************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// read only view of the values of a column file mapped in memory (POSIX mmap): opening it reads its header only,
+	// the pages of the values are loaded by the system when they are accessed. The values are the raw data of the file
+	// (no copy), aligned on a cache line, so they can be given as is to the batch kernels
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+	class FP_mapped
+	{
+	public:
+		using value_type      = Fixed_Point_Static<T,F,A>;
+		using size_type       = size_t;
+		using const_reference = const value_type&;
+		using const_pointer   = const value_type*;
+		using const_iterator  = const value_type*;
+
+		static_assert(FP_numeric::has_raw_layout<value_type>::value, "Error in FP_mapped : the layout is not the one of base_type!");
+
+	private:
+		void*         __map;
+		size_type     __bytes;
+		column_header __header;
+
+	public: // constructors
+		// map the column file at path, throw std::runtime_error if it cannot be mapped, if it is not a valid column
+		// file of value_type or if it is truncated
+		explicit FP_mapped(const std::string& path);
+		~FP_mapped();
+
+		FP_mapped(FP_mapped&& o) noexcept;
+		FP_mapped& operator=(FP_mapped&& o) noexcept;
+
+		FP_mapped(const FP_mapped&)            = delete;
+		FP_mapped& operator=(const FP_mapped&) = delete;
+
+	public: // capacity
+		size_type size () const;
+		bool      empty() const;
+
+		const column_header& header() const;
+
+	public: // element access
+		const_reference operator[](size_type i) const;
+		const_reference at        (size_type i) const; // throw std::out_of_range
+
+		const_pointer  data () const;
+		const_iterator begin() const;
+		const_iterator end  () const;
+	};
+}
+
+#include "Fixed_Point_Static_file.hxx"
+
+#endif /* FIXED_POINT_STATIC_FILE_HPP_ */
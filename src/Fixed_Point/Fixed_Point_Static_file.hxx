@@ -0,0 +1,288 @@
+#ifndef FIXED_POINT_STATIC_FILE_HXX_
+#define FIXED_POINT_STATIC_FILE_HXX_
+
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Fixed_Point_Static_file.hpp"
+
+/// ********************************************************************************************************************
+/// Column files *******************************************************************************************************
+/// ********************************************************************************************************************
+
+template <typename FP>
+FP_numeric::column_header FP_numeric::column_header::of(uint64_t count)
+{
+	column_header h;
+	std::memset(&h, 0, sizeof(h));
+	std::memcpy(h.magic, "FPCOLUMN", sizeof(h.magic));
+
+	h.version         = current_version;
+	h.byte_order      = 0x01020304;
+	h.total_bits      = uint32_t(FP::Tb);
+	h.fractional_bits = uint32_t(FP::Fb);
+	h.arithmetic_type = uint32_t(FP::Ab);
+	h.base_size       = uint32_t(sizeof(typename FP::base_type));
+	h.count           = count;
+	h.offset          = sizeof(column_header);
+
+	return h;
+}
+
+inline bool FP_numeric::column_header::valid() const
+{
+	return std::memcmp(magic, "FPCOLUMN", sizeof(magic)) == 0 && version == current_version && byte_order == 0x01020304
+	    && arithmetic_type <= uint32_t(FP_numeric::Arithmetic_type::UNSIGNED_CHECKED) && offset >= sizeof(column_header);
+}
+
+template <typename FP>
+bool FP_numeric::column_header::holds() const
+{
+	return valid() && total_bits == FP::Tb && fractional_bits == FP::Fb && arithmetic_type == uint32_t(FP::Ab)
+	    && base_size == sizeof(typename FP::base_type) && offset % alignof(typename FP::base_type) == 0;
+}
+
+inline size_t FP_numeric::column_header::get_total_bits() const
+{
+	return total_bits;
+}
+
+inline size_t FP_numeric::column_header::get_fractional_bits() const
+{
+	return fractional_bits;
+}
+
+inline FP_numeric::Arithmetic_type FP_numeric::column_header::get_arithmetic_type() const
+{
+	return FP_numeric::Arithmetic_type(arithmetic_type);
+}
+
+inline std::string FP_numeric::column_header::display_quantification() const
+{
+	return FP_numeric::display_quantification(*this);
+}
+
+inline FP_numeric::column_header FP_numeric::file_header(const std::string& path)
+{
+	std::FILE* file = std::fopen(path.c_str(), "rb");
+	if (file == nullptr)
+		throw std::runtime_error("Error in file_header : cannot open " + path + "!");
+
+	column_header h;
+	const bool read = std::fread(&h, sizeof(h), 1, file) == 1;
+	std::fclose(file);
+
+	if (!read || !h.valid())
+		throw std::runtime_error("Error in file_header : " + path + " is not a column file!");
+
+	return h;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::write_file(const std::string& path, const Fixed_Point_Static<T,F,A>* first, size_t n)
+{
+	FP_numeric::FP_file_writer<T,F,A> writer(path);
+	writer.append(first, n);
+	writer.close();
+}
+
+/// ********************************************************************************************************************
+/// FP_file_writer class ***********************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_file_writer<T,F,A>::FP_file_writer(const std::string& path)
+	: __path(path), __file(std::fopen(path.c_str(), "wb")), __size(0)
+{
+	if (__file == nullptr)
+		throw std::runtime_error("Error in FP_file_writer : cannot create " + path + "!");
+
+	// the count is written by close
+	const column_header h = column_header::of<value_type>(0);
+	if (std::fwrite(&h, sizeof(h), 1, __file) != 1)
+	{
+		std::fclose(__file);
+		throw std::runtime_error("Error in FP_file_writer : cannot write " + path + "!");
+	}
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_file_writer<T,F,A>::~FP_file_writer()
+{
+	try
+	{
+		close();
+	}
+	catch (const std::runtime_error&)
+	{
+	}
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_file_writer<T,F,A>::append(const value_type* first, size_type n)
+{
+	if (__file == nullptr)
+		throw std::runtime_error("Error in FP_file_writer : " + __path + " is closed!");
+
+	if (std::fwrite(first, sizeof(value_type), n, __file) != n)
+		throw std::runtime_error("Error in FP_file_writer : cannot write " + __path + "!");
+
+	__size += n;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_file_writer<T,F,A>::append(const value_type& x)
+{
+	append(&x, 1);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_file_writer<T,F,A>::close()
+{
+	if (__file == nullptr)
+		return;
+
+	const column_header h = column_header::of<value_type>(__size);
+	const bool written = std::fseek(__file, 0, SEEK_SET) == 0 && std::fwrite(&h, sizeof(h), 1, __file) == 1;
+	const bool closed  = std::fclose(__file) == 0;
+	__file = nullptr;
+
+	if (!written || !closed)
+		throw std::runtime_error("Error in FP_file_writer : cannot write " + __path + "!");
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_file_writer<T,F,A>::size_type FP_numeric::FP_file_writer<T,F,A>::size() const
+{
+	return __size;
+}
+
+/// ********************************************************************************************************************
+/// FP_mapped class ****************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_mapped<T,F,A>::FP_mapped(const std::string& path) : __map(nullptr), __bytes(0), __header()
+{
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw std::runtime_error("Error in FP_mapped : cannot open " + path + "!");
+
+	struct stat st;
+	if (::fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(column_header))
+	{
+		::close(fd);
+		throw std::runtime_error("Error in FP_mapped : " + path + " is not a column file!");
+	}
+
+	__bytes = size_t(st.st_size);
+	__map   = ::mmap(nullptr, __bytes, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd); // the mapping keeps its own reference on the file
+
+	if (__map == MAP_FAILED)
+	{
+		__map = nullptr;
+		throw std::runtime_error("Error in FP_mapped : cannot map " + path + "!");
+	}
+
+	std::memcpy(&__header, __map, sizeof(column_header));
+
+	std::string error;
+	if (!__header.valid())
+		error = path + " is not a column file";
+	else if (!__header.holds<value_type>())
+		error = path + " has the quantification " + __header.display_quantification() + " instead of "
+		      + FP_numeric::display_quantification(value_type());
+	else if (__header.offset > __bytes || __header.count > (__bytes - __header.offset) / sizeof(value_type))
+		error = path + " is truncated";
+
+	if (!error.empty())
+	{
+		::munmap(__map, __bytes);
+		__map = nullptr;
+		throw std::runtime_error("Error in FP_mapped : " + error + "!");
+	}
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_mapped<T,F,A>::~FP_mapped()
+{
+	if (__map != nullptr)
+		::munmap(__map, __bytes);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_mapped<T,F,A>::FP_mapped(FP_mapped&& o) noexcept : __map(o.__map), __bytes(o.__bytes), __header(o.__header)
+{
+	o.__map          = nullptr;
+	o.__bytes        = 0;
+	o.__header.count = 0;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_mapped<T,F,A>& FP_numeric::FP_mapped<T,F,A>::operator=(FP_mapped&& o) noexcept
+{
+	std::swap(__map,    o.__map);
+	std::swap(__bytes,  o.__bytes);
+	std::swap(__header, o.__header);
+	return *this;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_mapped<T,F,A>::size_type FP_numeric::FP_mapped<T,F,A>::size() const
+{
+	return size_type(__header.count);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline bool FP_numeric::FP_mapped<T,F,A>::empty() const
+{
+	return size() == 0;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline const FP_numeric::column_header& FP_numeric::FP_mapped<T,F,A>::header() const
+{
+	return __header;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_mapped<T,F,A>::const_reference FP_numeric::FP_mapped<T,F,A>::operator[](size_type i) const
+{
+	return data()[i];
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+typename FP_numeric::FP_mapped<T,F,A>::const_reference FP_numeric::FP_mapped<T,F,A>::at(size_type i) const
+{
+	if (i >= size())
+		throw std::out_of_range("Error in FP_mapped::at : i >= size()!");
+
+	return data()[i];
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_mapped<T,F,A>::const_pointer FP_numeric::FP_mapped<T,F,A>::data() const
+{
+	return (__map == nullptr) ? nullptr
+	                          : reinterpret_cast<const_pointer>(static_cast<const char*>(__map) + __header.offset);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_mapped<T,F,A>::const_iterator FP_numeric::FP_mapped<T,F,A>::begin() const
+{
+	return data();
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_mapped<T,F,A>::const_iterator FP_numeric::FP_mapped<T,F,A>::end() const
+{
+	return data() + size();
+}
+
+#endif /* FIXED_POINT_STATIC_FILE_HXX_ */
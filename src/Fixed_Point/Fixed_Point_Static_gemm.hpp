@@ -0,0 +1,36 @@
+#ifndef FIXED_POINT_STATIC_GEMM_HPP_
+#define FIXED_POINT_STATIC_GEMM_HPP_
+
+#include <vector>
+#include <algorithm>
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_dsp.hpp"
+#include "Fixed_Point_thread_pool.hpp"
+
+/// ********************************************************************************************************************
+/// Matrix product *****************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// storage of a dense matrix of r rows and c columns: element (i,j) at [i*c + j] (ROW_MAJOR) or [j*r + i] (COL_MAJOR)
+	enum class Matrix_layout {ROW_MAJOR, COL_MAJOR};
+
+	// c (m x n) = a (m x k) * b (k x n) with k <= K
+	// Every element of c is first computed exactly in dot_res_type_d<Tl,Fl,Tr,Fr,K>: the mul_res_type of the products
+	// with ceil(log2(K)) guard bits, so the same bits than the sum of the products with the operators. Then it is
+	// assigned to c: requantized and saturated as by operator= if Fixed_Point_Static<To,Fo> is another type.
+	// The operands are packed in blocks summed by register tiles of vectorized multiply-adds (for 16 bits base types,
+	// or 32 bits base types with SSE4.1/AVX2, as FP_numeric::dot), and the tiles of c are shared by the threads of pool.
+	template <size_t K, size_t Tl, size_t Fl, size_t Tr, size_t Fr, size_t To, size_t Fo>
+	void gemm(size_t m, size_t n, size_t k,
+	          const Fixed_Point_Static<Tl, Fl>* a, Matrix_layout layout_a,
+	          const Fixed_Point_Static<Tr, Fr>* b, Matrix_layout layout_b,
+	                Fixed_Point_Static<To, Fo>* c, Matrix_layout layout_c,
+	          FP_numeric::thread_pool& pool = FP_numeric::thread_pool::global());
+}
+
+#include "Fixed_Point_Static_gemm.hxx"
+
+#endif /* FIXED_POINT_STATIC_GEMM_HPP_ */
@@ -0,0 +1,156 @@
+#ifndef FIXED_POINT_STATIC_GEMM_HXX_
+#define FIXED_POINT_STATIC_GEMM_HXX_
+
+#include "Fixed_Point_Static_gemm.hpp"
+
+/// ********************************************************************************************************************
+/// Matrix product kernels *********************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __batch
+{
+	// register tile: add to sums[r*ld + c] the sums of the len products of the packed row r of a by the packed column c
+	// of b (len is a multiple of step)
+	// Every sum is exact: it is a sum of products of the same matrix element, which never overflows its base_type
+	template <typename FPl, typename FPr, typename FPo, size_t MR, size_t NR, bool vectorized = has_dot<FPl, FPr, FPo>::value>
+	struct gemm_tile
+	{
+		using Bl = typename FPl::base_type;
+		using Br = typename FPr::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const size_t step = 1;
+
+		static void run(const Bl* a, const Br* b, size_t stride, size_t len, Bo* sums, size_t ld)
+		{
+			for (size_t r = 0; r < MR; r++)
+				for (size_t c = 0; c < NR; c++)
+				{
+					Bo sum = 0;
+					for (size_t p = 0; p < len; p++)
+						sum += (Bo)a[r*stride + p] * (Bo)b[c*stride + p];
+					sums[r*ld + c] += sum;
+				}
+		}
+	};
+
+#if defined(FP_BATCH_SIMD)
+	template <typename FPl, typename FPr, typename FPo, size_t MR, size_t NR>
+	struct gemm_tile<FPl, FPr, FPo, MR, NR, true>
+	{
+		using Bi = typename FPl::base_type;
+		using Bo = typename FPo::base_type;
+
+		static const size_t step = dot_lanes<Bi, Bo>::lanes;
+
+		// each vector of a is used NR times and each vector of b MR times
+		static void run(const Bi* a, const Bi* b, size_t stride, size_t len, Bo* sums, size_t ld)
+		{
+			vec acc0[MR][NR], acc1[MR][NR];
+			for (size_t r = 0; r < MR; r++)
+				for (size_t c = 0; c < NR; c++)
+					acc0[r][c] = acc1[r][c] = zero();
+
+			for (size_t p = 0; p < len; p += step)
+			{
+				vec va[MR], vb[NR];
+				for (size_t r = 0; r < MR; r++) va[r] = load(a + r*stride + p);
+				for (size_t c = 0; c < NR; c++) vb[c] = load(b + c*stride + p);
+
+				for (size_t r = 0; r < MR; r++)
+					for (size_t c = 0; c < NR; c++)
+						dot_lanes<Bi, Bo>::multiply_add(va[r], vb[c], acc0[r][c], acc1[r][c]);
+			}
+
+			for (size_t r = 0; r < MR; r++)
+				for (size_t c = 0; c < NR; c++)
+					sums[r*ld + c] += reduce_add<Bo>(acc0[r][c], acc1[r][c]);
+		}
+	};
+#endif // FP_BATCH_SIMD
+
+	// copy the rows (or columns) of a matrix in consecutive blocks of stride elements padded with zeros
+	// element (i,p) of the rows x len matrix is at [i*len + p] if contiguous else at [p*rows + i]
+	template <typename FP>
+	void gemm_pack(const FP* x, size_t rows, size_t len, bool contiguous, typename FP::base_type* packed, size_t stride)
+	{
+		const typename FP::base_type* r = raw(x);
+
+		for (size_t i = 0; i < rows; i++)
+			for (size_t p = 0; p < len; p++)
+				packed[i*stride + p] = contiguous? r[i*len + p] : r[p*rows + i];
+	}
+}
+}
+
+/// ********************************************************************************************************************
+/// Matrix product *****************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t K, size_t Tl, size_t Fl, size_t Tr, size_t Fr, size_t To, size_t Fo>
+void FP_numeric::gemm(size_t m, size_t n, size_t k,
+                      const Fixed_Point_Static<Tl, Fl>* a, Matrix_layout layout_a,
+                      const Fixed_Point_Static<Tr, Fr>* b, Matrix_layout layout_b,
+                            Fixed_Point_Static<To, Fo>* c, Matrix_layout layout_c,
+                      FP_numeric::thread_pool& pool)
+{
+	using FPl      = Fixed_Point_Static<Tl, Fl>;
+	using FPr      = Fixed_Point_Static<Tr, Fr>;
+	using res_type = typename FP_numeric::dot_res_type_d<Tl, Fl, Tr, Fr, K>::type;
+	using Bo       = typename res_type::base_type;
+
+	static const size_t MR = 2, NR = 2;    // register tile
+	static const size_t MC = 64, NC = 64;  // tile of c computed by a task
+	static const size_t KC = 512;          // products summed by block (multiple of the vector lanes)
+
+	using tile = __batch::gemm_tile<FPl, FPr, res_type, MR, NR>;
+
+	if (k > K)
+		throw std::length_error("Error in gemm : k > K!");
+
+	if (m == 0 || n == 0)
+		return;
+
+	// rows of a and columns of b padded to whole register tiles and vectors
+	const size_t mp     = (m + MR - 1) / MR * MR;
+	const size_t np     = (n + NR - 1) / NR * NR;
+	const size_t stride = (k + tile::step - 1) / tile::step * tile::step;
+
+	std::vector<typename FPl::base_type> pa(mp * stride, 0);
+	std::vector<typename FPr::base_type> pb(np * stride, 0);
+	__batch::gemm_pack(a, m, k, layout_a == Matrix_layout::ROW_MAJOR, pa.data(), stride);
+	__batch::gemm_pack(b, n, k, layout_b == Matrix_layout::COL_MAJOR, pb.data(), stride);
+
+	const size_t tiles_m = (mp + MC - 1) / MC;
+	const size_t tiles_n = (np + NC - 1) / NC;
+
+	pool.parallel_for(tiles_m * tiles_n, [&](size_t t)
+	{
+		const size_t i0 = (t / tiles_n) * MC, i1 = std::min(i0 + MC, mp);
+		const size_t j0 = (t % tiles_n) * NC, j1 = std::min(j0 + NC, np);
+
+		Bo sums[MC * NC] = {};
+
+		for (size_t p0 = 0; p0 < stride; p0 += KC)
+		{
+			const size_t len = std::min(KC, stride - p0);
+
+			for (size_t j = j0; j < j1; j += NR)
+				for (size_t i = i0; i < i1; i += MR)
+					tile::run(pa.data() + i*stride + p0, pb.data() + j*stride + p0, stride, len,
+					          sums + (i - i0)*NC + (j - j0), NC);
+		}
+
+		res_type res;
+		for (size_t i = i0; i < std::min(i1, m); i++)
+			for (size_t j = j0; j < std::min(j1, n); j++)
+			{
+				res.set_data(sums[(i - i0)*NC + (j - j0)]);
+				c[(layout_c == Matrix_layout::ROW_MAJOR)? i*n + j : j*m + i] = res;
+			}
+	});
+}
+
+#endif /* FIXED_POINT_STATIC_GEMM_HXX_ */
@@ -0,0 +1,81 @@
+#ifndef FIXED_POINT_STATIC_LUT_HPP_
+#define FIXED_POINT_STATIC_LUT_HPP_
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Lookup tables generated at compile time ****************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __lut
+{
+	// log2 of the power of two n (not part of the API)
+	constexpr size_t log2(size_t n) noexcept
+	{
+		return (n > 1)? 1 + log2(n >> 1) : 0;
+	}
+}
+
+	// Size+1 samples of Func on the whole range of Fixed_Point_Static<InT,InF>, evaluated at compile time and stored
+	// as the raw values of Fixed_Point_Static<OutT,OutF> in a constant table (in .rodata, aligned on a cache line)
+	// - Func is a literal type with a constexpr default constructor and a constexpr operator() taking a
+	//   Fixed_Point_Static<InT,InF> and returning a value a Fixed_Point_Static<OutT,OutF> can be built from: a floating
+	//   point number or another Fixed_Point_Static (e.g. one of the functions of Fixed_Point_Static_math.hpp)
+	// - Size is a power of two <= 2^InT: the i-th sample is Func(min() + i * 2^InT / Size units of the last place),
+	//   the ones out of [min(), max()] being clamped. Size+1 samples of OutT bits should fit in the L1 cache (bytes)
+	// Everything is static: e.g. using sigmoid_lut = FP_numeric::lut<16,12, 16,15, sigmoid, 256>;
+	//                            y = sigmoid_lut::interpolate(x);
+	template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+	class lut
+	{
+	public:
+		using in_type   = Fixed_Point_Static<InT,  InF >;
+		using out_type  = Fixed_Point_Static<OutT, OutF>;
+		using base_type = typename out_type::base_type;
+
+		static_assert(InT <= 64, "Error in FP_numeric::lut : InT > 64!");
+		static_assert(Size >= 2 && !(Size & (Size - 1)), "Error in FP_numeric::lut : Size is not a power of two!");
+		static_assert(InT >= 64 || Size <= (uint64_t(1) << InT % 64), "Error in FP_numeric::lut : Size > 2^InT!");
+
+		static const size_t shift = InT - __lut::log2(Size); // log2 of the distance between 2 samples, in units of in_type
+		static const size_t size  = Size + 1;
+
+	public: // lookups
+		// sample the nearest to x
+		static constexpr out_type lookup(const in_type& x) noexcept;
+
+		// linear interpolation between the 2 samples around x, rounded to the nearest (same than lookup if shift == 0)
+		static constexpr out_type interpolate(const in_type& x) noexcept;
+
+		// lookup or interpolate the n values of x, write the results in res and return res + n
+		static out_type* lookup_n     (const in_type* x, size_t n, out_type* res) noexcept;
+		static out_type* interpolate_n(const in_type* x, size_t n, out_type* res) noexcept;
+
+	public: // samples
+		// i-th sample (i < size) and its abscissa
+		static constexpr out_type sample  (size_t i) noexcept;
+		static constexpr in_type  abscissa(size_t i) noexcept;
+
+	private:
+		// raw value of x shifted in [0, 2^InT), min() - 1 being 0
+		static constexpr uint64_t offset(const in_type& x) noexcept;
+
+		struct alignas(64) samples
+		{
+			base_type data[Size + 1];
+
+			constexpr samples();
+		};
+
+		static constexpr samples table{};
+
+	public:
+		static const size_t bytes = sizeof(samples);
+	};
+}
+
+#include "Fixed_Point_Static_lut.hxx"
+
+#endif /* FIXED_POINT_STATIC_LUT_HPP_ */
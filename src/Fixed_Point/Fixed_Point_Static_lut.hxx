@@ -0,0 +1,99 @@
+#ifndef FIXED_POINT_STATIC_LUT_HXX_
+#define FIXED_POINT_STATIC_LUT_HXX_
+
+#include "Fixed_Point_Static_lut.hpp"
+
+/// ********************************************************************************************************************
+/// Table **************************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::samples::samples()
+: data()
+{
+	for (size_t i = 0; i <= Size; i++)
+		data[i] = out_type(Func()(abscissa(i))).get_data();
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::samples FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::table;
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::in_type
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::abscissa(size_t i) noexcept
+{
+	// i * 2^shift - 2^(InT-1) computed modulo 2^64 (for InT == 64), then clamped at min() and max()
+	in_type x;
+	x.set_data((i == 0   )? in_type::min().get_data() :
+	           (i >= Size)? in_type::max().get_data() :
+	           int64_t((uint64_t(i) << shift) - (uint64_t(1) << (InT - 1))));
+	return x;
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::out_type
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::sample(size_t i) noexcept
+{
+	out_type y;
+	y.set_data(table.data[i]);
+	return y;
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr uint64_t FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::offset(const in_type& x) noexcept
+{
+	return uint64_t(int64_t(x.get_data())) + (uint64_t(1) << (InT - 1));
+}
+
+/// ********************************************************************************************************************
+/// Lookups ************************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::out_type
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::lookup(const in_type& x) noexcept
+{
+	// the bit below the index rounds it to the nearest sample (without overflow of the offset for InT == 64)
+	const uint64_t u = offset(x);
+	return sample((shift == 0)? u : (u >> shift) + ((u >> (shift - 1) % 64) & 1));
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+constexpr typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::out_type
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::interpolate(const in_type& x) noexcept
+{
+	// y0 + (y1 - y0) * frac / 2^shift, the product needs OutT+1 + shift bits
+	using wide_type = typename FP_numeric::matching_type<OutT + 1 + shift>::type;
+	static_assert(!std::is_void<wide_type>::value,
+	              "Error in FP_numeric::lut::interpolate : OutT + 1 + shift > 64 (see ENABLE_128_BITS)!");
+
+	const uint64_t  u    = offset(x);
+	const size_t    i    = size_t(u >> shift);
+	const wide_type frac = wide_type(u & ((uint64_t(1) << shift) - 1));
+	const wide_type y0   = table.data[i];
+	const wide_type dy   = (shift == 0)? 0 : wide_type(table.data[i + 1]) - y0;
+
+	out_type y;
+	y.set_data(y0 + ((dy * frac + (wide_type(1) << shift >> 1)) >> shift));
+	return y;
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::out_type*
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::lookup_n(const in_type* x, size_t n, out_type* res) noexcept
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = lookup(x[i]);
+	return res + n;
+}
+
+template <size_t InT, size_t InF, size_t OutT, size_t OutF, class Func, size_t Size>
+typename FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::out_type*
+FP_numeric::lut<InT, InF, OutT, OutF, Func, Size>::interpolate_n(const in_type* x, size_t n, out_type* res) noexcept
+{
+	for (size_t i = 0; i < n; i++)
+		res[i] = interpolate(x[i]);
+	return res + n;
+}
+
+#endif /* FIXED_POINT_STATIC_LUT_HXX_ */
@@ -0,0 +1,140 @@
+#ifndef FIXED_POINT_STATIC_MATH_HPP_
+#define FIXED_POINT_STATIC_MATH_HPP_
+
+#include "Fixed_Point_Static.hpp"
+
+/// ********************************************************************************************************************
+/// Tools to get the type of the results of the mathematical functions *************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// sqrt(x) < 2^(I/2) for the I = T-F-1 integer bits of x: half of them (rounded up) are kept and all the others
+	// bits of T are fractional
+	template <size_t T, size_t F>
+	struct sqrt_res_type_d;
+
+	// 1/sqrt(x) <= 2^(F/2) for x >= 2^-F: floor(F/2)+1 integer bits and all the others bits of T are fractional
+	template <size_t T, size_t F>
+	struct rsqrt_res_type_d;
+
+	// hypot(a, b) <= |a| + |b|: same type than the sum
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	struct hypot_res_type_d;
+
+	template <typename FP>
+	struct sqrt_res_type;
+
+	template <typename FP>
+	struct rsqrt_res_type;
+
+	template <typename FPl, typename FPr>
+	struct hypot_res_type;
+
+	// sin(x) and cos(x) are in [-1, 1]: 1 integer bit and all the others bits of T are fractional
+	template <size_t T, size_t F>
+	struct trig_res_type_d;
+
+	// atan2(y, x) is in [-pi, pi]: 2 integer bits and all the others bits of the largest T are fractional
+	template <size_t Ty, size_t Fy, size_t Tx, size_t Fx>
+	struct atan2_res_type_d;
+
+	// log2(x) is in [-F, I) for the I = T-F-1 integer bits of x: just enough integer bits to hold max(F, I) and all
+	// the others bits of T are fractional (log(x) = log2(x) * ln(2) has the same type)
+	template <size_t T, size_t F>
+	struct log_res_type_d;
+
+	template <typename FP>
+	struct trig_res_type;
+
+	template <typename FPy, typename FPx>
+	struct atan2_res_type;
+
+	template <typename FP>
+	struct log_res_type;
+}
+
+/// ********************************************************************************************************************
+/// Square roots *******************************************************************************************************
+/// ********************************************************************************************************************
+
+// The results are computed in integer arithmetic, without floating point, by an integer square root of as many bits
+// as needed by the quantification: Newton-Raphson iterations with a last correction up to 63 bits, digit-by-digit
+// above. They are exact and truncated: 0 <= exact - result < 1 unit of the last place of the result type.
+
+namespace std
+{
+	// throw std::domain_error if x < 0
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::sqrt_res_type_d<T, F>::type
+	sqrt(const Fixed_Point_Static<T,F>& x);
+
+	// sqrt(a*a + b*b) without overflow of a*a + b*b
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+	constexpr typename FP_numeric::hypot_res_type_d<Tl, Fl, Tr, Fr>::type
+	hypot(const Fixed_Point_Static<Tl,Fl>& a, const Fixed_Point_Static<Tr,Fr>& b);
+}
+
+namespace FP_numeric
+{
+	// 1/sqrt(x): saturated at max() for x == 0, throw std::domain_error if x < 0
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::rsqrt_res_type_d<T, F>::type
+	rsqrt(const Fixed_Point_Static<T,F>& x);
+}
+
+/// ********************************************************************************************************************
+/// Trigonometric, exponential and logarithmic functions ***************************************************************
+/// ********************************************************************************************************************
+
+// The results are computed in integer arithmetic on 60 fractional bits, with tables of atan(2^-i), ln(1+2^-i) and
+// log2(1+2^-i) rounded on 60 bits: CORDIC rotations for sin and cos, CORDIC vectoring for atan2, and shift-and-add
+// iterations for exp, log2 and log. The number of iterations is set at compile time to the fractional bits of the
+// result + 3 (at most 60), so the results are the same on every platform, with an error of at most 1 unit of the last
+// place of the result type for T <= 52 (above, the precision is bounded by the 60 bits of the computations).
+// These functions need T <= 64.
+
+namespace std
+{
+	// x in radians, reduced modulo 2*pi on 60 fractional bits
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::trig_res_type_d<T, F>::type
+	sin(const Fixed_Point_Static<T,F>& x);
+
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::trig_res_type_d<T, F>::type
+	cos(const Fixed_Point_Static<T,F>& x);
+
+	// angle of (x, y) in [-pi, pi], atan2(0, 0) = 0
+	template <size_t Ty, size_t Fy, size_t Tx, size_t Fx>
+	constexpr typename FP_numeric::atan2_res_type_d<Ty, Fy, Tx, Fx>::type
+	atan2(const Fixed_Point_Static<Ty,Fy>& y, const Fixed_Point_Static<Tx,Fx>& x);
+
+	// exp(x) saturated in the quantification of x
+	template <size_t T, size_t F>
+	constexpr Fixed_Point_Static<T,F>
+	exp(const Fixed_Point_Static<T,F>& x);
+
+	// throw std::domain_error if x <= 0
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::log_res_type_d<T, F>::type
+	log2(const Fixed_Point_Static<T,F>& x);
+
+	// throw std::domain_error if x <= 0
+	template <size_t T, size_t F>
+	constexpr typename FP_numeric::log_res_type_d<T, F>::type
+	log(const Fixed_Point_Static<T,F>& x);
+}
+
+namespace FP_numeric
+{
+	// sin(x) and cos(x) given by the same CORDIC rotations (e.g. for a numerically controlled oscillator)
+	template <size_t T, size_t F>
+	constexpr void
+	sincos(const Fixed_Point_Static<T,F>& x, typename FP_numeric::trig_res_type_d<T, F>::type& s,
+	                                         typename FP_numeric::trig_res_type_d<T, F>::type& c);
+}
+
+#include "Fixed_Point_Static_math.hxx"
+
+#endif /* FIXED_POINT_STATIC_MATH_HPP_ */
@@ -0,0 +1,627 @@
+#ifndef FIXED_POINT_STATIC_MATH_HXX_
+#define FIXED_POINT_STATIC_MATH_HXX_
+
+#include "Fixed_Point_Static_math.hpp"
+
+template <size_t T, size_t F>
+struct FP_numeric::sqrt_res_type_d
+{
+	using type = Fixed_Point_Static<T, T - 1 - (T - F) / 2>; // I = ceil((T-F-1)/2) = (T-F)/2 ; F = T-1-I
+};
+
+template <size_t T, size_t F>
+struct FP_numeric::rsqrt_res_type_d
+{
+	using type = Fixed_Point_Static<T, T - 2 - F / 2>;      // I = F/2+1 ; F = T-1-I
+};
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+struct FP_numeric::hypot_res_type_d
+{
+	using type = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type;
+};
+
+template <typename FP>
+struct FP_numeric::sqrt_res_type
+{
+	using type = typename sqrt_res_type_d<FP::Tb, FP::Fb>::type;
+};
+
+template <typename FP>
+struct FP_numeric::rsqrt_res_type
+{
+	using type = typename rsqrt_res_type_d<FP::Tb, FP::Fb>::type;
+};
+
+template <typename FPl, typename FPr>
+struct FP_numeric::hypot_res_type
+{
+	using type = typename hypot_res_type_d<FPl::Tb, FPl::Fb, FPr::Tb, FPr::Fb>::type;
+};
+
+template <size_t T, size_t F>
+struct FP_numeric::trig_res_type_d
+{
+	using type = Fixed_Point_Static<T, T - 2>;              // I = 1 ; F = T-1-I
+};
+
+template <size_t Ty, size_t Fy, size_t Tx, size_t Fx>
+struct FP_numeric::atan2_res_type_d
+{
+	static const size_t T = (Ty > Tx)? Ty : Tx;
+	using type = Fixed_Point_Static<T, T - 3>;              // I = 2 ; F = T-1-I
+};
+
+template <size_t T, size_t F>
+struct FP_numeric::log_res_type_d
+{
+	static const size_t I = T - 1 - F;
+	static const size_t M = (F > I)? F : I;
+	static const size_t B = (M >= 32)? 6 : (M >= 16)? 5 : (M >= 8)? 4 : (M >= 4)? 3 : (M >= 2)? 2 : M; // bits of M
+	using type = Fixed_Point_Static<T, T - 1 - B>;          // I = B ; F = T-1-I
+};
+
+template <typename FP>
+struct FP_numeric::trig_res_type
+{
+	using type = typename trig_res_type_d<FP::Tb, FP::Fb>::type;
+};
+
+template <typename FPy, typename FPx>
+struct FP_numeric::atan2_res_type
+{
+	using type = typename atan2_res_type_d<FPy::Tb, FPy::Fb, FPx::Tb, FPx::Fb>::type;
+};
+
+template <typename FP>
+struct FP_numeric::log_res_type
+{
+	using type = typename log_res_type_d<FP::Tb, FP::Fb>::type;
+};
+
+/// ********************************************************************************************************************
+/// Integer tools of the mathematical functions (not part of the API) **************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __math
+{
+	// unsigned type of at least n bits
+	template <size_t n>
+	struct uint_type
+	{
+		static_assert(!std::is_void<typename FP_numeric::matching_type<n>::type>::value,
+		              "Error in __math::uint_type : no integer type is large enough (see ENABLE_128_BITS)!");
+
+		using type = typename FP_numeric::unsigned_type<typename FP_numeric::matching_type<n>::type>::type;
+	};
+
+	// floor(sqrt(n)) for n < 2^Nbits: one bit of the result by iteration, from the highest one
+	template <size_t Nbits, typename U>
+	constexpr U isqrt_digits(U n) noexcept
+	{
+		U res = 0;
+		for (U bit = U(1) << ((Nbits - 1) & ~size_t(1)); bit; bit >>= 2)
+		{
+			const U    trial = res + bit;
+			const bool keep  = (n >= trial);
+
+			n   -= keep? trial : U(0);
+			res  = (res >> 1) + (keep? bit : U(0));
+		}
+		return res;
+	}
+
+	// seeds[i] = 2^30 / sqrt(x) in the middle of the i-th interval [0.25 + i/256, 0.25 + (i+1)/256)
+	struct rsqrt_seeds
+	{
+		uint32_t seeds[192];
+
+		constexpr rsqrt_seeds() : seeds()
+		{
+			// 2^34 / sqrt(i + 64.5) = 2^15 * sqrt(2^39 / (2*i + 129))
+			for (size_t i = 0; i < 192; i++)
+				seeds[i] = uint32_t(isqrt_digits<64>(uint64_t((uint64_t(1) << 39) / (2*i + 129))) << 15);
+		}
+	};
+
+	static constexpr rsqrt_seeds rsqrt_table{};
+
+	constexpr int leading_zeros(uint64_t x) noexcept
+	{
+	#if defined(__GNUC__)
+		return __builtin_clzll(x);
+	#else
+		int n = 0;
+		for (; !(x & (uint64_t(1) << 63)); x <<= 1)
+			n++;
+		return n;
+	#endif
+	}
+
+	// floor(sqrt(n)) for n < 2^63, with multiplications only: n is normalized in m = n * 4^k in [2^62, 2^64), the
+	// reciprocal square root y of x = m / 2^64 is seeded from a table then refined by 2 Newton-Raphson iterations
+	// y = y * (3 - x*y^2) / 2 on 32 bits, and sqrt(n) ~ x * y * 2^32 / 2^k is off by -4 to +1 (mostly 0), so fixed
+	// by a last exact correction
+	constexpr uint64_t isqrt_newton(uint64_t n) noexcept
+	{
+		if (n == 0)
+			return 0;
+
+		const int      s  = leading_zeros(n) & ~1;
+		const uint64_t xm = (n << s) >> 32; // x in [0.25, 1) with 32 fractional bits
+
+		uint64_t y = rsqrt_table.seeds[(xm >> 24) - 64]; // y in (1, 2] with 30 fractional bits
+		for (int i = 0; i < 2; i++)
+		{
+			const uint64_t xy2 = xm * ((y * y) >> 30);                 // x*y^2 with 62 fractional bits
+			y = (y * ((3*(uint64_t(1) << 62) - xy2) >> 32)) >> 31;
+		}
+
+		uint64_t r = (xm * y) >> (30 + s/2);
+
+		r -= (r * r > n);
+		r += (2*r + 1 <= n - r * r);
+		while (2*r + 1 <= n - r * r)
+			r++;
+		return r;
+	}
+
+	template <size_t Nbits, typename U>
+	constexpr U isqrt(U n) noexcept
+	{
+		return (Nbits <= 63)? U(isqrt_newton(uint64_t(n))) : isqrt_digits<Nbits>(n);
+	}
+
+	template <typename T>
+	constexpr auto magnitude(T data) -> typename FP_numeric::unsigned_type<T>::type
+	{
+		using U = typename FP_numeric::unsigned_type<T>::type;
+		return (data < 0)? U(U(0) - U(data)) : U(data);
+	}
+}
+}
+
+/// ********************************************************************************************************************
+/// Square roots *******************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::sqrt_res_type_d<T, F>::type
+std::sqrt(const Fixed_Point_Static<T,F>& x)
+{
+	using __res_t = typename FP_numeric::sqrt_res_type_d<T, F>::type;
+
+	// sqrt(N * 2^-F) * 2^Fo = sqrt(N * 2^(2*Fo - F))
+	constexpr size_t shift = 2*__res_t::Fb - F;
+	constexpr size_t bits  = T - 1 + shift;
+	using U = typename FP_numeric::__math::uint_type<bits>::type;
+
+	if (x.get_data() < 0)
+		throw std::domain_error("Square root of a negative number!");
+
+	__res_t res;
+	res.set_data(FP_numeric::__math::isqrt<bits>(U(U(x.get_data()) << shift)));
+	return res;
+}
+
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
+constexpr typename FP_numeric::hypot_res_type_d<Tl, Fl, Tr, Fr>::type
+std::hypot(const Fixed_Point_Static<Tl,Fl>& a, const Fixed_Point_Static<Tr,Fr>& b)
+{
+	using __res_t = typename FP_numeric::hypot_res_type_d<Tl, Fl, Tr, Fr>::type;
+
+	// |a| and |b| (of T-1 bits) aligned on the Fo fractional bits of the result: the sum of their squares has 2*Fo
+	// fractional bits
+	constexpr size_t Fo     = __res_t::Fb;
+	constexpr size_t bits_a = Tl - 1 + Fo - Fl;
+	constexpr size_t bits_b = Tr - 1 + Fo - Fr;
+	constexpr size_t bits   = 2*((bits_a > bits_b)? bits_a : bits_b) + 1;
+	using U = typename FP_numeric::__math::uint_type<bits>::type;
+
+	const U ua = U(FP_numeric::__math::magnitude(a.get_data())) << (Fo - Fl);
+	const U ub = U(FP_numeric::__math::magnitude(b.get_data())) << (Fo - Fr);
+
+	__res_t res;
+	res.set_data(FP_numeric::__math::isqrt<bits>(U(ua*ua + ub*ub)));
+	return res;
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::rsqrt_res_type_d<T, F>::type
+FP_numeric::rsqrt(const Fixed_Point_Static<T,F>& x)
+{
+	using __res_t = typename FP_numeric::rsqrt_res_type_d<T, F>::type;
+
+	// 2^Fo / sqrt(N * 2^-F) = sqrt(2^(2*Fo + F) / N), and floor(sqrt(floor(y))) = floor(sqrt(y))
+	constexpr size_t e    = 2*__res_t::Fb + F;
+	constexpr size_t bits = e + 1;
+	using U = typename FP_numeric::__math::uint_type<bits>::type;
+
+	if (x.get_data() < 0)
+		throw std::domain_error("Reciprocal square root of a negative number!");
+
+	if (x.get_data() == 0)
+		return __res_t::max();
+
+	__res_t res;
+	res.set_data(FP_numeric::__math::isqrt<bits>(U(U(1) << e) / U(x.get_data())));
+	return res;
+}
+
+/// ********************************************************************************************************************
+/// Integer tools of the trigonometric, exponential and logarithmic functions (not part of the API) ********************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __math
+{
+	// the values below are rounded on 60 fractional bits
+	static const size_t P = 60;
+
+	// atan(2^-i)
+	static constexpr int64_t atan_table[61] = {
+		0x0c90fdaa22168c23ll, 0x076b19c1586ed3dall, 0x03eb6ebf25901bacll, 0x01fd5ba9aac2f6dcll,
+		0x00ffaaddb967ef4ell, 0x007ff556eea5d893ll, 0x003ffeaab776e535ll, 0x001fffd555bbba97ll,
+		0x000ffffaaaaddddcll, 0x0007ffff55556eefll, 0x0003ffffeaaaab77ll, 0x0001fffffd55555cll,
+		0x0000ffffffaaaaabll, 0x00007ffffff55555ll, 0x00003ffffffeaaabll, 0x00001fffffffd555ll,
+		0x00000ffffffffaabll, 0x000007ffffffff55ll, 0x000003ffffffffebll, 0x000001fffffffffdll,
+		0x0000010000000000ll, 0x0000008000000000ll, 0x0000004000000000ll, 0x0000002000000000ll,
+		0x0000001000000000ll, 0x0000000800000000ll, 0x0000000400000000ll, 0x0000000200000000ll,
+		0x0000000100000000ll, 0x0000000080000000ll, 0x0000000040000000ll, 0x0000000020000000ll,
+		0x0000000010000000ll, 0x0000000008000000ll, 0x0000000004000000ll, 0x0000000002000000ll,
+		0x0000000001000000ll, 0x0000000000800000ll, 0x0000000000400000ll, 0x0000000000200000ll,
+		0x0000000000100000ll, 0x0000000000080000ll, 0x0000000000040000ll, 0x0000000000020000ll,
+		0x0000000000010000ll, 0x0000000000008000ll, 0x0000000000004000ll, 0x0000000000002000ll,
+		0x0000000000001000ll, 0x0000000000000800ll, 0x0000000000000400ll, 0x0000000000000200ll,
+		0x0000000000000100ll, 0x0000000000000080ll, 0x0000000000000040ll, 0x0000000000000020ll,
+		0x0000000000000010ll, 0x0000000000000008ll, 0x0000000000000004ll, 0x0000000000000002ll,
+		0x0000000000000001ll
+	};
+
+	// ln(1 + 2^-i)
+	static constexpr int64_t ln1p_table[61] = {
+		0x0b17217f7d1cf79bll, 0x067cc8fb2fe612fdll, 0x0391fef8f3534436ll, 0x01e27076e2af2e5fll,
+		0x00f85186008b1533ll, 0x007e0a6c39e0cc01ll, 0x003f815161f807c8ll, 0x001fe02a6b106789ll,
+		0x000ff805515885e0ll, 0x0007fe00aa6ac43all, 0x0003ff8015515622ll, 0x0001ffe002aa6ab1ll,
+		0x0000fff800555156ll, 0x00007ffe000aaa6bll, 0x00003fff80015551ll, 0x00001fffe0002aaall,
+		0x00000ffff8000555ll, 0x000007fffe0000abll, 0x000003ffff800015ll, 0x000001ffffe00003ll,
+		0x000000fffff80000ll, 0x0000007ffffe0000ll, 0x0000003fffff8000ll, 0x0000001fffffe000ll,
+		0x0000000ffffff800ll, 0x00000007fffffe00ll, 0x00000003ffffff80ll, 0x00000001ffffffe0ll,
+		0x00000000fffffff8ll, 0x000000007ffffffell, 0x0000000040000000ll, 0x0000000020000000ll,
+		0x0000000010000000ll, 0x0000000008000000ll, 0x0000000004000000ll, 0x0000000002000000ll,
+		0x0000000001000000ll, 0x0000000000800000ll, 0x0000000000400000ll, 0x0000000000200000ll,
+		0x0000000000100000ll, 0x0000000000080000ll, 0x0000000000040000ll, 0x0000000000020000ll,
+		0x0000000000010000ll, 0x0000000000008000ll, 0x0000000000004000ll, 0x0000000000002000ll,
+		0x0000000000001000ll, 0x0000000000000800ll, 0x0000000000000400ll, 0x0000000000000200ll,
+		0x0000000000000100ll, 0x0000000000000080ll, 0x0000000000000040ll, 0x0000000000000020ll,
+		0x0000000000000010ll, 0x0000000000000008ll, 0x0000000000000004ll, 0x0000000000000002ll,
+		0x0000000000000001ll
+	};
+
+	// log2(1 + 2^-i)
+	static constexpr int64_t log21p_table[61] = {
+		0x1000000000000000ll, 0x095c01a39fbd687all, 0x05269e12f346e2c0ll, 0x02b803473f7ad0f4ll,
+		0x01663f6fac913168ll, 0x00b5d69bac77ec3all, 0x005b9e5a170b48a6ll, 0x002dfca16dde10a3ll,
+		0x001709c46d7aac77ll, 0x000b87c1ff853ab2ll, 0x0005c4994dd0fd15ll, 0x0002e27ac5ef2af8ll,
+		0x00017148ec2a1bfdll, 0x0000b8a7588fd29bll, 0x00005c5464ec5f4dll, 0x00002e2a60a005c9ll,
+		0x000017153bda8f82ll, 0x00000b8aa0cfedcbll, 0x000005c55120a0c4ll, 0x000002e2a8be7ae5ll,
+		0x00000171546ac815ll, 0x000000b8aa3846b3ll, 0x0000005c551cdc04ll, 0x0000002e2a8e9c2cll,
+		0x00000017154759a1ll, 0x0000000b8aa3afb3ll, 0x00000005c551d892ll, 0x00000002e2a8ec77ll,
+		0x0000000171547647ll, 0x00000000b8aa3b26ll, 0x000000005c551d94ll, 0x000000002e2a8ecall,
+		0x0000000017154765ll, 0x000000000b8aa3b3ll, 0x0000000005c551d9ll, 0x0000000002e2a8edll,
+		0x0000000001715476ll, 0x0000000000b8aa3bll, 0x00000000005c551ell, 0x00000000002e2a8fll,
+		0x0000000000171547ll, 0x00000000000b8aa4ll, 0x000000000005c552ll, 0x000000000002e2a9ll,
+		0x0000000000017154ll, 0x000000000000b8aall, 0x0000000000005c55ll, 0x0000000000002e2bll,
+		0x0000000000001715ll, 0x0000000000000b8bll, 0x00000000000005c5ll, 0x00000000000002e3ll,
+		0x0000000000000171ll, 0x00000000000000b9ll, 0x000000000000005cll, 0x000000000000002ell,
+		0x0000000000000017ll, 0x000000000000000cll, 0x0000000000000006ll, 0x0000000000000003ll,
+		0x0000000000000001ll
+	};
+
+	static constexpr int64_t  pi      = 0x3243f6a8885a308dll;
+	static constexpr int64_t  half_pi = 0x1921fb54442d1847ll;
+	static constexpr int64_t  ln2     = 0x0b17217f7d1cf79bll;
+	static constexpr int64_t  log2e   = 0x171547652b82fe17ll;
+	static constexpr int64_t  cordic  = 0x09b74eda8435e5a6ll; // 1 / prod(sqrt(1 + 2^-2i)), the inverse CORDIC gain
+	static constexpr uint64_t two_pi  = 0x6487ed5110b4611aull;
+	static constexpr uint64_t two_pi_low   = 0x62633145c06e0e68ull; // next 64 bits of 2*pi after the 60 fractional ones
+	static constexpr uint64_t inv_two_pi64 = 0x28be60db9391054aull; // floor(2^64 / (2*pi))
+
+	// number of iterations giving a result on Fo fractional bits
+	constexpr size_t iterations(size_t Fo) noexcept
+	{
+		return (Fo + 3 < P)? Fo + 3 : P;
+	}
+
+	// high 64 bits of a * b
+	constexpr uint64_t mul_hi(uint64_t a, uint64_t b) noexcept
+	{
+		const uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+		const uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+		const uint64_t p01 = a0 * b1, p10 = a1 * b0;
+		const uint64_t mid = ((a0 * b0) >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+		return a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+	}
+
+	// v on Fi fractional bits rounded to the nearest on Fo fractional bits
+	template <size_t Fo, size_t Fi = P>
+	constexpr int64_t round_to(int64_t v) noexcept
+	{
+		return (Fo >= Fi)? int64_t(uint64_t(v) << (Fo - Fi) % 64)
+		                 : (v + (int64_t(1) << (Fi - Fo - 1) % 64)) >> (Fi - Fo) % 64;
+	}
+
+	// u * 2^-F modulo 2*pi, in (-pi, pi] on P fractional bits: the integer part of u is divided by 2*pi by a product
+	// with its inverse, and the remainder is computed modulo 2^64 with 2*pi on 124 fractional bits, so it is exact up to
+	// a few units of 2^-P for all u < 2^63
+	template <size_t F>
+	constexpr int64_t reduce_angle(uint64_t u) noexcept
+	{
+		const uint64_t ip = (F >= 64)? 0 : u >> F % 64;
+		const uint64_t fp = (F >= 64)? u : u & ((uint64_t(1) << F % 64) - 1);
+		const uint64_t q  = mul_hi(ip, inv_two_pi64); // floor(ip / (2*pi)) or 1 less
+
+		uint64_t r = (ip << P) + ((F >= P)? fp >> (F - P) % 64 : fp << (P - F) % 64) - q * two_pi - mul_hi(q, two_pi_low);
+		r -= (r >= two_pi)? two_pi : 0;
+		return (r > uint64_t(pi))? int64_t(r - two_pi) : int64_t(r);
+	}
+
+	// CORDIC rotations of (cordic, 0) by z in [-pi/2, pi/2]: x = cos(z) and y = sin(z) on P fractional bits
+	template <size_t N>
+	constexpr void rotate(int64_t z, int64_t& x, int64_t& y) noexcept
+	{
+		x = cordic, y = 0;
+		for (size_t i = 0; i < N; i++)
+		{
+			const int64_t d  = z >> 63; // 0 to rotate forward, -1 to rotate backward
+			const int64_t dx = ((y >> i) ^ d) - d;
+			const int64_t dy = ((x >> i) ^ d) - d;
+			x -= dx;
+			y += dy;
+			z -= (atan_table[i] ^ d) - d;
+		}
+	}
+
+	// sin and cos of u * 2^-F (of sign neg) on P fractional bits
+	template <size_t N, size_t F>
+	constexpr void sincos(uint64_t u, bool neg, int64_t& s, int64_t& c) noexcept
+	{
+		int64_t z = reduce_angle<F>(u);
+
+		// (cos, sin)(z -+ pi) = -(cos, sin)(z)
+		const bool flip = (z > half_pi) || (z < -half_pi);
+		z -= (z > half_pi)? pi : (z < -half_pi)? -pi : 0;
+
+		rotate<N>(z, c, s);
+		c = flip? -c :  c;
+		s = (flip != neg)? -s : s;
+	}
+
+	// CORDIC vectoring of (x, y), x >= 0 and y >= 0 < 2^P: atan(y / x) on P fractional bits
+	template <size_t N>
+	constexpr int64_t vector(int64_t x, int64_t y) noexcept
+	{
+		int64_t z = 0;
+		for (size_t i = 0; i < N; i++)
+		{
+			const int64_t d  = y >> 63; // 0 to rotate backward, -1 to rotate forward
+			const int64_t dx = ((y >> i) ^ d) - d;
+			const int64_t dy = ((x >> i) ^ d) - d;
+			x += dx;
+			y -= dy;
+			z += (atan_table[i] ^ d) - d;
+		}
+		return z;
+	}
+
+	// exp(r) for r in [0, ln(2)) on P fractional bits, in [1, 2) on P fractional bits: r is decomposed on the
+	// ln(1 + 2^-i) and the result is the product of the (1 + 2^-i)
+	template <size_t N>
+	constexpr int64_t exp_unit(int64_t r) noexcept
+	{
+		int64_t y = int64_t(1) << P;
+		for (size_t i = 1; i < N; i++)
+		{
+			const bool keep = (r >= ln1p_table[i]);
+			r -= keep? ln1p_table[i] : 0;
+			y += keep? (y >> i) : 0;
+		}
+		return y;
+	}
+
+	// log(m) in base 2 (table log21p_table) or e (table ln1p_table) for m in [1, 2) on 62 fractional bits, on P
+	// fractional bits: m is multiplied by the (1 + 2^-i) that keep it below 2, and log(m) = log(2) - sum(log(1 + 2^-i))
+	template <size_t N>
+	constexpr int64_t log_unit(uint64_t m, const int64_t (&table)[61]) noexcept
+	{
+		int64_t acc = table[0];
+		for (size_t i = 1; i < N; i++)
+		{
+			const uint64_t t    = m + (m >> i);
+			const bool     keep = (t < (uint64_t(1) << 63));
+			m    = keep? t : m;
+			acc -= keep? table[i] : 0;
+		}
+		return acc;
+	}
+
+	// u = m * 2^e with m in [1, 2) on 62 fractional bits, for u != 0
+	constexpr uint64_t normalize(uint64_t u, int& e) noexcept
+	{
+		const int lz = leading_zeros(u);
+		e = 63 - lz;
+		return (u << lz) >> 1;
+	}
+}
+}
+
+/// ********************************************************************************************************************
+/// Trigonometric, exponential and logarithmic functions ***************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F>
+constexpr void
+FP_numeric::sincos(const Fixed_Point_Static<T,F>& x, typename FP_numeric::trig_res_type_d<T, F>::type& s,
+                                                     typename FP_numeric::trig_res_type_d<T, F>::type& c)
+{
+	static_assert(T >= 2 && T <= 64, "Error in FP_numeric::sincos : T < 2 or T > 64!");
+
+	using __res_t = typename FP_numeric::trig_res_type_d<T, F>::type;
+	constexpr size_t N = FP_numeric::__math::iterations(__res_t::Fb);
+
+	int64_t sv = 0, cv = 0;
+	FP_numeric::__math::sincos<N, F>(FP_numeric::__math::magnitude(int64_t(x.get_data())), x.get_data() < 0, sv, cv);
+
+	s.set_data(FP_numeric::__math::round_to<__res_t::Fb>(sv));
+	c.set_data(FP_numeric::__math::round_to<__res_t::Fb>(cv));
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::trig_res_type_d<T, F>::type
+std::sin(const Fixed_Point_Static<T,F>& x)
+{
+	typename FP_numeric::trig_res_type_d<T, F>::type s, c;
+	FP_numeric::sincos(x, s, c);
+	return s;
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::trig_res_type_d<T, F>::type
+std::cos(const Fixed_Point_Static<T,F>& x)
+{
+	typename FP_numeric::trig_res_type_d<T, F>::type s, c;
+	FP_numeric::sincos(x, s, c);
+	return c;
+}
+
+template <size_t Ty, size_t Fy, size_t Tx, size_t Fx>
+constexpr typename FP_numeric::atan2_res_type_d<Ty, Fy, Tx, Fx>::type
+std::atan2(const Fixed_Point_Static<Ty,Fy>& y, const Fixed_Point_Static<Tx,Fx>& x)
+{
+	static_assert(Ty <= 64 && Tx <= 64, "Error in std::atan2 : T > 64!");
+
+	using __res_t = typename FP_numeric::atan2_res_type_d<Ty, Fy, Tx, Fx>::type;
+	constexpr size_t N = FP_numeric::__math::iterations(__res_t::Fb);
+
+	uint64_t uy = FP_numeric::__math::magnitude(int64_t(y.get_data()));
+	uint64_t ux = FP_numeric::__math::magnitude(int64_t(x.get_data()));
+
+	__res_t res;
+	if (ux == 0 && uy == 0)
+		return res;
+
+	// |y| and |x| normalized on their highest bit then aligned on the largest one, below 2^P so the CORDIC gain and
+	// the first rotation of pi/4 do not overflow
+	int ey = 0, ex = 0;
+	uy = (uy == 0)? 0 : FP_numeric::__math::normalize(uy, ey);
+	ux = (ux == 0)? 0 : FP_numeric::__math::normalize(ux, ex);
+
+	const int d       = (ux == 0 || uy == 0)? 0 : (ex - int(Fx)) - (ey - int(Fy));
+	const int shift   = 62 + 1 - int(FP_numeric::__math::P);
+	const int shift_y = shift + ((d > 0)?  d : 0);
+	const int shift_x = shift + ((d < 0)? -d : 0);
+	uy = (shift_y >= 64)? 0 : uy >> shift_y;
+	ux = (shift_x >= 64)? 0 : ux >> shift_x;
+
+	// atan2 of the first quadrant, then (x < 0) : pi - z and (y < 0) : -z
+	int64_t z = FP_numeric::__math::vector<N>(int64_t(ux), int64_t(uy));
+	z = (x.get_data() < 0)? FP_numeric::__math::pi - z : z;
+	z = (y.get_data() < 0)? -z : z;
+
+	res.set_data(FP_numeric::__math::round_to<__res_t::Fb>(z));
+	return res;
+}
+
+template <size_t T, size_t F>
+constexpr Fixed_Point_Static<T,F>
+std::exp(const Fixed_Point_Static<T,F>& x)
+{
+	static_assert(T <= 64, "Error in std::exp : T > 64!");
+
+	constexpr size_t N = FP_numeric::__math::iterations(T - 1);
+	constexpr size_t P = FP_numeric::__math::P;
+
+	// exp(x) >= 2^63 for x >= 45 and exp(x) < 2^-64 for x <= -45: only 6 integer bits are needed, so x is set
+	// on 56 fractional bits
+	constexpr size_t  Fr    = 56;
+	constexpr int64_t bound = (T - 1 - F >= 6)? int64_t(45) << (F % 64) : std::numeric_limits<int64_t>::max();
+
+	const int64_t data = int64_t(x.get_data());
+	if (data >= bound)
+		return Fixed_Point_Static<T,F>::max();
+	if (data <= -bound)
+		return Fixed_Point_Static<T,F>::zero();
+
+	const int64_t xr = (F >= Fr)? data >> (F - Fr) % 64 : int64_t(uint64_t(data) << (Fr - F) % 64);
+
+	// x = k * ln(2) + r, with r in [0, ln(2)): k ~ x * log2(e) on 28 bits, then corrected by one step
+	const int64_t ln2_r = FP_numeric::__math::ln2 >> (P - Fr);
+	int64_t k = ((xr >> 28) * (FP_numeric::__math::log2e >> (P - 28))) >> 56;
+	k += (xr - k * ln2_r >= ln2_r)? 1 : (xr - k * ln2_r < 0)? -1 : 0;
+
+	// exp(x) = exp(r) * 2^k, in [2^(k+P), 2^(k+P+1)) on P + F fractional bits
+	const int64_t y = FP_numeric::__math::exp_unit<N>((xr - k * ln2_r) << (P - Fr));
+	const int     s = int(k) + int(F) - int(P);
+
+	if (s + int(P) >= int(T) - 1)
+		return Fixed_Point_Static<T,F>::max();
+
+	const int64_t v = (s >= 0)? y << s : (-s > int(P) + 1)? 0 : (y + (int64_t(1) << (-s - 1))) >> -s;
+
+	Fixed_Point_Static<T,F> res;
+	res.set_data(std::min(v, int64_t(Fixed_Point_Static<T,F>::max().get_data())));
+	return res;
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::log_res_type_d<T, F>::type
+std::log2(const Fixed_Point_Static<T,F>& x)
+{
+	static_assert(T <= 64, "Error in std::log2 : T > 64!");
+
+	using __res_t = typename FP_numeric::log_res_type_d<T, F>::type;
+	constexpr size_t N = FP_numeric::__math::iterations(__res_t::Fb);
+
+	if (x.get_data() <= 0)
+		throw std::domain_error("Logarithm of a negative or null number!");
+
+	// log2(x) = e - F + log2(m) with x = m * 2^e * 2^-F, on 57 fractional bits to hold |e - F| <= 63
+	constexpr size_t Fr = 57;
+	int e = 0;
+	const uint64_t m = FP_numeric::__math::normalize(uint64_t(x.get_data()), e);
+	const int64_t  v = int64_t(e - int(F)) * (int64_t(1) << Fr)
+	                 + (FP_numeric::__math::log_unit<N>(m, FP_numeric::__math::log21p_table) >> (FP_numeric::__math::P - Fr));
+
+	__res_t res;
+	res.set_data(FP_numeric::__math::round_to<__res_t::Fb, Fr>(v));
+	return res;
+}
+
+template <size_t T, size_t F>
+constexpr typename FP_numeric::log_res_type_d<T, F>::type
+std::log(const Fixed_Point_Static<T,F>& x)
+{
+	static_assert(T <= 64, "Error in std::log : T > 64!");
+
+	using __res_t = typename FP_numeric::log_res_type_d<T, F>::type;
+	constexpr size_t N = FP_numeric::__math::iterations(__res_t::Fb);
+
+	if (x.get_data() <= 0)
+		throw std::domain_error("Logarithm of a negative or null number!");
+
+	// log(x) = (e - F) * ln(2) + log(m) with x = m * 2^e * 2^-F, on 57 fractional bits
+	constexpr size_t Fr = 57;
+	int e = 0;
+	const uint64_t m = FP_numeric::__math::normalize(uint64_t(x.get_data()), e);
+	const int64_t  v = int64_t(e - int(F)) * (FP_numeric::__math::ln2 >> (FP_numeric::__math::P - Fr))
+	                 + (FP_numeric::__math::log_unit<N>(m, FP_numeric::__math::ln1p_table) >> (FP_numeric::__math::P - Fr));
+
+	__res_t res;
+	res.set_data(FP_numeric::__math::round_to<__res_t::Fb, Fr>(v));
+	return res;
+}
+
+#endif /* FIXED_POINT_STATIC_MATH_HXX_ */
@@ -2,13 +2,15 @@
 #define FIXED_POINT_STATIC_OPERATORS_HPP_
 
 #include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_charconv.hpp"
 
 /// *********************************************************************************************************************
 /// Display operator that indicates the used quantification *************************************************************
 /// *********************************************************************************************************************
 
-template <size_t T, size_t F>
-std::ostream& operator<<(std::ostream& os, const Fixed_Point_Static<T,F>& f);
+// write the value with min(os.precision(), F) fractional digits (FP_numeric::to_chars, without floating point)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+std::ostream& operator<<(std::ostream& os, const Fixed_Point_Static<T,F,A>& f);
 
 /// *********************************************************************************************************************
 /// Fixed point arithmetics and bitwise operators ***********************************************************************
@@ -18,195 +20,195 @@ namespace FP_numeric
 {
 	// add, sub, mul or div lhs and rhs
 	// return the result with its automatically given size for the computation
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-	add(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	add(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 		typename std::enable_if < (Fl > Fr), bool>::type v = 0);
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-	add(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	add(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 		typename std::enable_if < (Fl < Fr), bool>::type v = 0);
 
-	template <size_t Tl, size_t Tr, size_t F>
-	typename FP_numeric::add_res_type_d<Tl, F, Tr, F>::type
-	add(const Fixed_Point_Static<Tl, F >& lhs, const Fixed_Point_Static<Tr, F >& rhs);
+	template <size_t Tl, size_t Tr, size_t F, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::add_res_type_d<Tl, F, Tr, F, Al, Ar>::type
+	add(const Fixed_Point_Static<Tl, F , Al>& lhs, const Fixed_Point_Static<Tr, F , Ar>& rhs);
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-	sub(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	sub(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 		typename std::enable_if < (Fl > Fr), bool>::type v = 0);
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-	sub(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	sub(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 		typename std::enable_if < (Fl < Fr), bool>::type v = 0);
 
-	template <size_t Tl, size_t Tr, size_t F>
-	typename FP_numeric::sub_res_type_d<Tl, F, Tr, F>::type
-	sub(const Fixed_Point_Static<Tl, F >& lhs, const Fixed_Point_Static<Tr, F >& rhs);
+	template <size_t Tl, size_t Tr, size_t F, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::sub_res_type_d<Tl, F, Tr, F, Al, Ar>::type
+	sub(const Fixed_Point_Static<Tl, F , Al>& lhs, const Fixed_Point_Static<Tr, F , Ar>& rhs);
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type
-	mul(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	mul(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-	template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
-	typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
-	div(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator);
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, FP_numeric::Arithmetic_type An, FP_numeric::Arithmetic_type Ad>
+	constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd, An, Ad>::type
+	div(const Fixed_Point_Static<Tn, Fn, An>& numerator, const Fixed_Point_Static<Td, Fd, Ad>& denominator);
 
 	// return the quotient in its given size and compute from that the remainder
-	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr>
-	void
-	div(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator,
-	          Fixed_Point_Static<Tq, Fq>& quotient ,       Fixed_Point_Static<Tr, Fr>& remainder);
-
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr>::type
-	mod(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+	template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type An, FP_numeric::Arithmetic_type Ad, FP_numeric::Arithmetic_type Aq, FP_numeric::Arithmetic_type Ar>
+	constexpr void
+	div(const Fixed_Point_Static<Tn, Fn, An>& numerator, const Fixed_Point_Static<Td, Fd, Ad>& denominator,
+	          Fixed_Point_Static<Tq, Fq, Aq>& quotient ,       Fixed_Point_Static<Tr, Fr, Ar>& remainder);
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	mod(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-operator+ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator+ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator+ (const Fixed_Point_Static<T , F >& lhs, const type                        rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator+ (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator+ (const type                        lhs, const Fixed_Point_Static<T , F >& rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator+ (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-operator- (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator- (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator- (const Fixed_Point_Static<T , F >& lhs, const type                        rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::sub_res_type_d<T, F, T, F, A, A>::type>::type
+operator- (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator- (const type                        lhs, const Fixed_Point_Static<T , F >& rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::sub_res_type_d<T, F, T, F, A, A>::type>::type
+operator- (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type
-operator* (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator* (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator* (const Fixed_Point_Static<T , F >& lhs, const type                        rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator* (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator* (const type                        lhs, const Fixed_Point_Static<T , F >& rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator* (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename FP_numeric::div_res_type_d<Tl, Fl, Tr, Fr>::type
-operator/ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::div_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator/ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator/ (const Fixed_Point_Static<T , F >& lhs, const type                        rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator/ (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator/ (const type                        lhs, const Fixed_Point_Static<T , F >& rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator/ (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr>::type
-operator% (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator% (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator% (const Fixed_Point_Static<T , F >& lhs, const type                        rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator% (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs);
 
-template <size_t T, size_t F, typename type>
-typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator% (const type                        lhs, const Fixed_Point_Static<T , F >& rhs);
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator% (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs);
 
 // shift operators (Fixed_Point rhs is convert as an unsigned integer)
-template <size_t Tl, size_t Fl, typename type>
-Fixed_Point_Static<Tl, Fl>
-operator>>(Fixed_Point_Static<Tl, Fl> lhs, const type& rhs);
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr Fixed_Point_Static<Tl, Fl, Al>
+operator>>(Fixed_Point_Static<Tl, Fl, Al> lhs, const type& rhs);
 
-template <size_t Tl, size_t Fl, typename type>
-Fixed_Point_Static<Tl, Fl>
-operator<<(Fixed_Point_Static<Tl, Fl> lhs, const type& rhs);
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr Fixed_Point_Static<Tl, Fl, Al>
+operator<<(Fixed_Point_Static<Tl, Fl, Al> lhs, const type& rhs);
 
 // binary operators between the raw of lhs and rhs
 // return an integer whom the size is equivalent to the size of the biggest base_type size between lhs and rhs
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator& (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
-
-template <size_t Tl, size_t Fl, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator& (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
+
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator& (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs);
+operator& (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs);
 
-template <size_t Tr, size_t Fr, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator& (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs);
+operator& (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator^ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator^ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t Tl, size_t Fl, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator^ (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs);
+operator^ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs);
 
-template <size_t Tr, size_t Fr, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator^ (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs);
+operator^ (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator| (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator| (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t Tl, size_t Fl, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator| (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs);
+operator| (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs);
 
-template <size_t Tr, size_t Fr, typename type>
-typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator| (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs);
+operator| (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
 // boolean comparison of the raw of lhs and rhs
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-bool
-operator&&(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr bool
+operator&&(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-bool
-operator||(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs);
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr bool
+operator||(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs);
 
 
 /// ********************************************************************************************************************
@@ -215,41 +217,41 @@ operator||(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, F
 
 namespace std
 {
-	template <size_t T, size_t F>
-	Fixed_Point_Static<T,F> abs      (const Fixed_Point_Static<T,F>& __x);
-	template <size_t T, size_t F>
-	int                     signbit  (const Fixed_Point_Static<T,F>& __x);
-	template <size_t T, size_t F>
-	std::string             to_string(const Fixed_Point_Static<T,F>& __x);
-
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type
-	max(const Fixed_Point_Static<Tl,Fl>& lhs, const Fixed_Point_Static<Tr,Fr>& rhs);
-
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type
-	min(const Fixed_Point_Static<Tl,Fl>& lhs, const Fixed_Point_Static<Tr,Fr>& rhs);
-
-	template <size_t T, size_t F>
-	Fixed_Point_Static<T,F>
-	max(const Fixed_Point_Static<T,F>& lhs, const Fixed_Point_Static<T,F>& rhs);
-
-	template <size_t T, size_t F>
-	Fixed_Point_Static<T,F>
-	min(const Fixed_Point_Static<T,F>& lhs, const Fixed_Point_Static<T,F>& rhs);
-
-	template<size_t T, size_t F>
-	struct numeric_limits<Fixed_Point_Static<T,F>>
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A> abs      (const Fixed_Point_Static<T,F,A>& __x);
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr int                     signbit  (const Fixed_Point_Static<T,F,A>& __x);
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	std::string             to_string(const Fixed_Point_Static<T,F,A>& __x);
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	max(const Fixed_Point_Static<Tl,Fl,Al>& lhs, const Fixed_Point_Static<Tr,Fr,Ar>& rhs);
+
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	min(const Fixed_Point_Static<Tl,Fl,Al>& lhs, const Fixed_Point_Static<Tr,Fr,Ar>& rhs);
+
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A>
+	max(const Fixed_Point_Static<T,F,A>& lhs, const Fixed_Point_Static<T,F,A>& rhs);
+
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A>
+	min(const Fixed_Point_Static<T,F,A>& lhs, const Fixed_Point_Static<T,F,A>& rhs);
+
+	template<size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	struct numeric_limits<Fixed_Point_Static<T,F,A>>
 	{
 		static _GLIBCXX_USE_CONSTEXPR bool is_specialized = true;
 
-		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F>
-		min() _GLIBCXX_USE_NOEXCEPT { return Fixed_Point_Static<T,F>::min(); }
+		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F,A>
+		min() _GLIBCXX_USE_NOEXCEPT { return Fixed_Point_Static<T,F,A>::min(); }
 
-		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F>
-		max() _GLIBCXX_USE_NOEXCEPT { return Fixed_Point_Static<T,F>::max(); }
+		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F,A>
+		max() _GLIBCXX_USE_NOEXCEPT { return Fixed_Point_Static<T,F,A>::max(); }
 
-		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F>
+		static _GLIBCXX_CONSTEXPR Fixed_Point_Static<T,F,A>
 		lowest() _GLIBCXX_USE_NOEXCEPT { return min(); }
 	};
 }
@@ -259,6 +261,7 @@ namespace std
 /// fixed points copy functions  ****************************************************************************************
 /// *********************************************************************************************************************
 #include <vector>
+#include <iterator>
 
 namespace FP_numeric
 {
@@ -266,22 +269,22 @@ namespace FP_numeric
 	template<typename>
 	struct __is_FP_S_helper : public std::false_type { };
 
-	template<size_t T, size_t F>
-	struct __is_FP_S_helper<Fixed_Point_Static<T,F>> : public std::true_type { };
+	template<size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	struct __is_FP_S_helper<Fixed_Point_Static<T,F,A>> : public std::true_type { };
 
 	/// check if it is a Fixed_Point_Static
 	template<typename _Tp>
 	struct   is_FP_S : public __is_FP_S_helper<typename std::remove_cv<_Tp>::type>::type { };
 
 	/// copy of two vectors
-	template<typename _IT, size_t T, size_t F, typename _IA, typename _OA>
-	void copy(const std::vector<_IT,                       _IA>& __in_vector, std::vector<Fixed_Point_Static<T ,F >, _OA>& __out_vector);
+	template<typename _IT, size_t T, size_t F, FP_numeric::Arithmetic_type A, typename _IA, typename _OA>
+	void copy(const std::vector<_IT,                       _IA>& __in_vector, std::vector<Fixed_Point_Static<T ,F ,A >, _OA>& __out_vector);
 
-	template<typename _OT, size_t T, size_t F, typename _IA, typename _OA>
-	void copy(const std::vector<Fixed_Point_Static<T ,F >, _IA>& __in_vector, std::vector<_OT,                       _OA>& __out_vector);
+	template<typename _OT, size_t T, size_t F, FP_numeric::Arithmetic_type A, typename _IA, typename _OA>
+	void copy(const std::vector<Fixed_Point_Static<T ,F ,A >, _IA>& __in_vector, std::vector<_OT,                       _OA>& __out_vector);
 
-	template<size_t Ti, size_t Fi, size_t To, size_t Fo, typename _IA, typename _OA>
-	void copy(const std::vector<Fixed_Point_Static<Ti,Fi>, _IA>& __in_vector, std::vector<Fixed_Point_Static<To,Fo>, _OA>& __out_vector);
+	template<size_t Ti, size_t Fi, size_t To, size_t Fo, FP_numeric::Arithmetic_type Ai, FP_numeric::Arithmetic_type Ao, typename _IA, typename _OA>
+	void copy(const std::vector<Fixed_Point_Static<Ti,Fi,Ai>, _IA>& __in_vector, std::vector<Fixed_Point_Static<To,Fo,Ao>, _OA>& __out_vector);
 
 	template<typename _IT, typename _OT, typename _IA, typename _OA>
 	void copy(const std::vector<_IT,                       _IA>& __in_vector, std::vector<_OT,                       _OA>& __out_vector);
@@ -5,10 +5,16 @@
 /// Display operator that indicates the used quantification *************************************************************
 /// *********************************************************************************************************************
 
-template <size_t T, size_t F>
-inline std::ostream& operator<<(std::ostream& os, const Fixed_Point_Static<T,F>& f)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline std::ostream& operator<<(std::ostream& os, const Fixed_Point_Static<T,F,A>& f)
 {
-	os << f.display(6) << f.display_quantification() ;
+	const size_t precision = std::min(size_t(os.precision()), F);
+
+	char buffer[FP_numeric::chars_size<Fixed_Point_Static<T,F,A>>::value];
+	const FP_numeric::to_chars_result res = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), f, precision);
+
+	os.write(buffer, res.ptr - buffer);
+	os << f.display_quantification();
 
 	return os;
 }
@@ -19,102 +25,102 @@ inline std::ostream& operator<<(std::ostream& os, const Fixed_Point_Static<T,F>&
 
 // add, sub, mul or div lhs and rhs
 // return the result with its automatically given size for the computation
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::add(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::add(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 	typename std::enable_if < (Fl > Fr), bool>::type v)
 {
-	using __res_t = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	__res_t res;
 	res.set_data((typename __res_t::base_type)(lhs.to_raw())
 	             + FP_numeric::shift_fract((typename __res_t::base_type)(rhs.to_raw()), Fl, Fr));
 	return res;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::add(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::add(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 	typename std::enable_if < (Fl < Fr), bool>::type v)
 {
-	using __res_t = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	__res_t res;
 	res.set_data(FP_numeric::shift_fract((typename __res_t::base_type)(lhs.to_raw()), Fr, Fl)
 	             + (typename __res_t::base_type)(rhs.to_raw()));
 	return res;
 }
 
-template <size_t Tl, size_t Tr, size_t F>
-inline typename FP_numeric::add_res_type_d<Tl, F, Tr, F>::type
-FP_numeric::add(const Fixed_Point_Static<Tl, F >& lhs, const Fixed_Point_Static<Tr, F >& rhs)
+template <size_t Tl, size_t Tr, size_t F, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::add_res_type_d<Tl, F, Tr, F, Al, Ar>::type
+FP_numeric::add(const Fixed_Point_Static<Tl, F , Al>& lhs, const Fixed_Point_Static<Tr, F , Ar>& rhs)
 {
-	using __res_t = typename FP_numeric::add_res_type_d<Tl, F, Tr, F>::type;
+	using __res_t = typename FP_numeric::add_res_type_d<Tl, F, Tr, F, Al, Ar>::type;
 	__res_t res;
 	res.set_data((typename __res_t::base_type)(lhs.to_raw())
 	           + (typename __res_t::base_type)(rhs.to_raw()));
 	return res;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::sub(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::sub(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 	typename std::enable_if < (Fl > Fr), bool>::type v)
 {
-	using __res_t = typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	__res_t res;
 	res.set_data((typename __res_t::base_type)(lhs.to_raw())
 	             - FP_numeric::shift_fract((typename __res_t::base_type)(rhs.to_raw()), Fl, Fr));
 	return res;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::sub(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs,
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::sub(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs,
 	typename std::enable_if < (Fl < Fr), bool>::type v)
 {
-	using __res_t = typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	__res_t res;
 	res.set_data(FP_numeric::shift_fract((typename __res_t::base_type)(lhs.to_raw()), Fr, Fl)
 	             - (typename __res_t::base_type)(rhs.to_raw()));
 	return res;
 }
 
-template <size_t Tl, size_t Tr, size_t F>
-inline typename FP_numeric::sub_res_type_d<Tl, F, Tr, F>::type
-FP_numeric::sub(const Fixed_Point_Static<Tl, F >& lhs, const Fixed_Point_Static<Tr, F >& rhs)
+template <size_t Tl, size_t Tr, size_t F, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::sub_res_type_d<Tl, F, Tr, F, Al, Ar>::type
+FP_numeric::sub(const Fixed_Point_Static<Tl, F , Al>& lhs, const Fixed_Point_Static<Tr, F , Ar>& rhs)
 {
-	using __res_t = typename FP_numeric::add_res_type_d<Tl, F, Tr, F>::type;
+	using __res_t = typename FP_numeric::sub_res_type_d<Tl, F, Tr, F, Al, Ar>::type;
 	__res_t res;
 	res.set_data((typename __res_t::base_type)(lhs.to_raw())
 	           - (typename __res_t::base_type)(rhs.to_raw()));
 	return res;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::mul(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::mul(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	__res_t res;
 	res.set_data((typename __res_t::base_type)(lhs.to_raw())
 	           * (typename __res_t::base_type)(rhs.to_raw()));
 	return res;
 }
 
-template <size_t Tn, size_t Fn, size_t Td, size_t Fd>
-inline typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type
-FP_numeric::div(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator)
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, FP_numeric::Arithmetic_type An, FP_numeric::Arithmetic_type Ad>
+constexpr typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd, An, Ad>::type
+FP_numeric::div(const Fixed_Point_Static<Tn, Fn, An>& numerator, const Fixed_Point_Static<Td, Fd, Ad>& denominator)
 {
 	if(!denominator)
 		throw std::domain_error("Division by zero!");
 
-	using __res_t  = typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd>::type;
+	using __res_t  = typename FP_numeric::div_res_type_d<Tn, Fn, Td, Fd, An, Ad>::type;
 	using big_type = typename __res_t::base_type;
 	__res_t quotient;
 
-	// get the data and align them
-	// TODO : manage risk of overflow when shifting
-	big_type num_data = FP_numeric::shift_fract((big_type)numerator.  get_data(), __res_t::Fb*2, Fn); // resize fractional part
-	big_type den_data = FP_numeric::shift_fract((big_type)denominator.get_data(), __res_t::Fb,   Fd); // resize fractional part
+	// the quotient of the raw data n * 2^(Fq+Fd-Fn) / d has Fq fractional bits: only the numerator is shifted (of Td
+	// bits), so that n * 2^Td holds in the Tn+Td+1 bits of big_type and the quotient is exact (truncated toward zero)
+	big_type num_data = FP_numeric::shift_fract((big_type)numerator.get_data(), __res_t::Fb + Fd, Fn);
+	big_type den_data = (big_type)denominator.get_data();
 
 	// compute
 	quotient.set_data(num_data / den_data);
@@ -123,20 +129,20 @@ FP_numeric::div(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_S
 }
 
 // return the quotient in its given size and compute from that the remainder
-template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr>
-inline void
-FP_numeric::div(const Fixed_Point_Static<Tn, Fn>& numerator, const Fixed_Point_Static<Td, Fd>& denominator,
-                Fixed_Point_Static<Tq, Fq>& quotient , Fixed_Point_Static<Tr, Fr>& remainder)
+template <size_t Tn, size_t Fn, size_t Td, size_t Fd, size_t Tq, size_t Fq, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type An, FP_numeric::Arithmetic_type Ad, FP_numeric::Arithmetic_type Aq, FP_numeric::Arithmetic_type Ar>
+constexpr void
+FP_numeric::div(const Fixed_Point_Static<Tn, Fn, An>& numerator, const Fixed_Point_Static<Td, Fd, Ad>& denominator,
+                Fixed_Point_Static<Tq, Fq, Aq>& quotient , Fixed_Point_Static<Tr, Fr, Ar>& remainder)
 {
 	quotient  = numerator/denominator;
 	remainder = FP_numeric::sub(numerator, FP_numeric::mul(quotient, denominator));
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr>::type
-FP_numeric::mod(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+FP_numeric::mod(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr>::type;
+	using __res_t = typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type;
 	using big_type = typename __res_t::base_type;
 	__res_t res;
 	// TODO : manage risk of overflow when shifting
@@ -145,264 +151,264 @@ FP_numeric::mod(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<
 	return res;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr>::type
-operator+ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::add_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator+ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return FP_numeric::add(lhs, rhs);
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator+ (const Fixed_Point_Static<T , F >& lhs, const type                        rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator+ (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs)
 {
-	return lhs + (Fixed_Point_Static<T, F>)rhs;
+	return lhs + (Fixed_Point_Static<T, F, A>)rhs;
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator+ (const type                        lhs, const Fixed_Point_Static<T , F >& rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator+ (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs)
 {
-	return (Fixed_Point_Static<T, F>)lhs + rhs;
+	return (Fixed_Point_Static<T, F, A>)lhs + rhs;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr>::type
-operator- (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::sub_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator- (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return FP_numeric::sub(lhs, rhs);
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator- (const Fixed_Point_Static<T , F >& lhs, const type                        rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::sub_res_type_d<T, F, T, F, A, A>::type>::type
+operator- (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs)
 {
-	return lhs - (Fixed_Point_Static<T, F>)rhs;
+	return lhs - (Fixed_Point_Static<T, F, A>)rhs;
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator- (const type                        lhs, const Fixed_Point_Static<T , F >& rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::sub_res_type_d<T, F, T, F, A, A>::type>::type
+operator- (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs)
 {
-	return (Fixed_Point_Static<T, F>)lhs - rhs;
+	return (Fixed_Point_Static<T, F, A>)lhs - rhs;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr>::type
-operator* (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mul_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator* (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return FP_numeric::mul(lhs, rhs);
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator* (const Fixed_Point_Static<T , F >& lhs, const type                        rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator* (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs)
 {
-	return lhs * (Fixed_Point_Static<T, F>)rhs;
+	return lhs * (Fixed_Point_Static<T, F, A>)rhs;
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator* (const type                        lhs, const Fixed_Point_Static<T , F >& rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator* (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs)
 {
-	return (Fixed_Point_Static<T, F>)lhs * rhs;
+	return (Fixed_Point_Static<T, F, A>)lhs * rhs;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::div_res_type_d<Tl, Fl, Tr, Fr>::type
-operator/ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::div_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator/ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return FP_numeric::div(lhs, rhs);
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator/ (const Fixed_Point_Static<T , F >& lhs, const type                        rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator/ (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs)
 {
-	return lhs / (Fixed_Point_Static<T, F>)rhs;
+	return lhs / (Fixed_Point_Static<T, F, A>)rhs;
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator/ (const type                        lhs, const Fixed_Point_Static<T , F >& rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator/ (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs)
 {
-	return (Fixed_Point_Static<T, F>)lhs / rhs;
+	return (Fixed_Point_Static<T, F, A>)lhs / rhs;
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr>::type
-operator% (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename FP_numeric::mod_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+operator% (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return FP_numeric::mod(lhs, rhs);
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator% (const Fixed_Point_Static<T , F >& lhs, const type                        rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator% (const Fixed_Point_Static<T , F , A>& lhs, const type                        rhs)
 {
-	return lhs % (Fixed_Point_Static<T, F>)rhs;
+	return lhs % (Fixed_Point_Static<T, F, A>)rhs;
 }
 
-template <size_t T, size_t F, typename type>
-inline typename FP_numeric::add_res_type_d<T, F, T, F>::type
-operator% (const type                        lhs, const Fixed_Point_Static<T , F >& rhs)
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A, typename type>
+constexpr typename std::enable_if<!FP_numeric::is_expression<type>::value, typename FP_numeric::add_res_type_d<T, F, T, F, A, A>::type>::type
+operator% (const type                        lhs, const Fixed_Point_Static<T , F , A>& rhs)
 {
-	return (Fixed_Point_Static<T, F>)lhs % rhs;
+	return (Fixed_Point_Static<T, F, A>)lhs % rhs;
 }
 
 // shift operators (Fixed_Point rhs is convert as an unsigned integer)
-template <size_t Tl, size_t Fl, typename type>
-inline Fixed_Point_Static<Tl, Fl>
-operator>>(Fixed_Point_Static<Tl, Fl> lhs, const type& rhs)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr Fixed_Point_Static<Tl, Fl, Al>
+operator>>(Fixed_Point_Static<Tl, Fl, Al> lhs, const type& rhs)
 {
 	return lhs >>= rhs;
 }
-template <size_t Tl, size_t Fl, typename type>
-inline Fixed_Point_Static<Tl, Fl>
-operator<<(Fixed_Point_Static<Tl, Fl> lhs, const type& rhs)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr Fixed_Point_Static<Tl, Fl, Al>
+operator<<(Fixed_Point_Static<Tl, Fl, Al> lhs, const type& rhs)
 {
 	return lhs <<= rhs;
 }
 
 // binary operators between the raw of lhs and rhs
 // return an integer whom the size is equivalent to the size of the biggest base_type size between lhs and rhs
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator& (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
-{
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type>::type;
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator& (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
+{
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type;
 	return (__res_t)(lhs.to_raw()) & (__res_t)(rhs.to_raw());
 }
 
-template <size_t Tl, size_t Fl, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator& (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs)
+operator& (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
 	                                          type>::type;
 	return (__res_t)(lhs.to_raw()) & (__res_t)rhs;
 }
 
-template <size_t Tr, size_t Fr, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator& (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs)
+operator& (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
 	                                          type>::type;
 	return (__res_t)lhs & (__res_t)(rhs.to_raw());
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator^ (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator^ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type>::type;
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type;
 	return (__res_t)(lhs.to_raw()) ^ (__res_t)(rhs.to_raw());
 }
 
-template <size_t Tl, size_t Fl, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator^ (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs)
+operator^ (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
 	                                          type>::type;
 	return (__res_t)(lhs.to_raw()) ^ (__res_t)rhs;
 }
 
-template <size_t Tr, size_t Fr, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator^ (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs)
+operator^ (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
 	                                          type>::type;
 	return (__res_t)lhs ^ (__res_t)(rhs.to_raw());
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type>::type
-operator| (const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+                                 >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type
+operator| (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
-	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type>::type;
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
+	                                          >= sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type),
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type>::type;
 	return (__res_t)(lhs.to_raw()) | (__res_t)(rhs.to_raw());
 }
 
-template <size_t Tl, size_t Fl, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+template <size_t Tl, size_t Fl, FP_numeric::Arithmetic_type Al, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tl, Fl>::base_type,
+                                 typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
                                  type>::type
-operator| (const Fixed_Point_Static<Tl, Fl>& lhs, const type                        rhs)
+operator| (const Fixed_Point_Static<Tl, Fl, Al>& lhs, const type                        rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tl, Fl, Al>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tl, Fl>::base_type,
+	                                          typename Fixed_Point_Static<Tl, Fl, Al>::base_type,
 	                                          type>::type;
 	return (__res_t)(lhs.to_raw()) | (__res_t)rhs;
 }
 
-template <size_t Tr, size_t Fr, typename type>
-inline typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+template <size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Ar, typename type>
+constexpr typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
                                  >= sizeof(type),
-                                 typename Fixed_Point_Static<Tr, Fr>::base_type,
+                                 typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
                                  type>::type
-operator| (const type lhs,                        const Fixed_Point_Static<Tr, Fr>& rhs)
+operator| (const type lhs,                        const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
-	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr>::base_type)
+	using __res_t = typename std::conditional<sizeof(typename Fixed_Point_Static<Tr, Fr, Ar>::base_type)
 	                                          >= sizeof(type),
-	                                          typename Fixed_Point_Static<Tr, Fr>::base_type,
+	                                          typename Fixed_Point_Static<Tr, Fr, Ar>::base_type,
 	                                          type>::type;
 	return (__res_t)lhs | (__res_t)(rhs.to_raw());
 }
 
 // boolean comparison of the raw of lhs and rhs
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline bool
-operator&&(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr bool
+operator&&(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return lhs.to_raw() && rhs.to_raw();
 }
 
-template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-inline bool
-operator||(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, Fr>& rhs)
+template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+constexpr bool
+operator||(const Fixed_Point_Static<Tl, Fl, Al>& lhs, const Fixed_Point_Static<Tr, Fr, Ar>& rhs)
 {
 	return lhs.to_raw() || rhs.to_raw();
 }
@@ -413,29 +419,33 @@ operator||(const Fixed_Point_Static<Tl, Fl>& lhs, const Fixed_Point_Static<Tr, F
 /// *********************************************************************************************************************
 namespace std
 {
-	template <size_t T, size_t F>
-	inline Fixed_Point_Static<T,F> abs      (const Fixed_Point_Static<T,F>& __x)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A> abs      (const Fixed_Point_Static<T,F,A>& __x)
 	{
 		return __x.abs();
 	}
 
-	template <size_t T, size_t F>
-	inline int                     signbit  (const Fixed_Point_Static<T,F>& __x)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr int                     signbit  (const Fixed_Point_Static<T,F,A>& __x)
 	{
 		return __x.sign();
 	}
 
-	template <size_t T, size_t F>
-	inline std::string             to_string(const Fixed_Point_Static<T,F>& __x)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	inline std::string             to_string(const Fixed_Point_Static<T,F,A>& __x)
 	{
-		return std::to_string(__x.to_float());
+		// 6 fractional digits as the std::to_string of the floating points
+		char buffer[FP_numeric::chars_size<Fixed_Point_Static<T,F,A>>::value + 6];
+		const FP_numeric::to_chars_result res = FP_numeric::to_chars(std::begin(buffer), std::end(buffer), __x, 6);
+
+		return std::string(buffer, res.ptr);
 	}
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	inline typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type
-	max(const Fixed_Point_Static<Tl,Fl>& lhs, const Fixed_Point_Static<Tr,Fr>& rhs)
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	max(const Fixed_Point_Static<Tl,Fl,Al>& lhs, const Fixed_Point_Static<Tr,Fr,Ar>& rhs)
 	{
-		typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type res;
+		typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type res;
 		if(lhs > rhs)
 			res = lhs;
 		else
@@ -443,11 +453,11 @@ namespace std
 		return res;
 	}
 
-	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr>
-	inline typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type
-	min(const Fixed_Point_Static<Tl,Fl>& lhs, const Fixed_Point_Static<Tr,Fr>& rhs)
+	template <size_t Tl, size_t Fl, size_t Tr, size_t Fr, FP_numeric::Arithmetic_type Al, FP_numeric::Arithmetic_type Ar>
+	constexpr typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type
+	min(const Fixed_Point_Static<Tl,Fl,Al>& lhs, const Fixed_Point_Static<Tr,Fr,Ar>& rhs)
 	{
-		typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr>::type res;
+		typename FP_numeric::comp_res_type_d<Tl, Fl, Tr, Fr, Al, Ar>::type res;
 		if(lhs < rhs)
 			res = lhs;
 		else
@@ -455,16 +465,16 @@ namespace std
 		return res;
 	}
 
-	template <size_t T, size_t F>
-	inline Fixed_Point_Static<T,F>
-	max(const Fixed_Point_Static<T,F>& lhs, const Fixed_Point_Static<T,F>& rhs)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A>
+	max(const Fixed_Point_Static<T,F,A>& lhs, const Fixed_Point_Static<T,F,A>& rhs)
 	{
 		return (lhs > rhs)? lhs : rhs;
 	}
 
-	template <size_t T, size_t F>
-	inline Fixed_Point_Static<T,F>
-	min(const Fixed_Point_Static<T,F>& lhs, const Fixed_Point_Static<T,F>& rhs)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	constexpr Fixed_Point_Static<T,F,A>
+	min(const Fixed_Point_Static<T,F,A>& lhs, const Fixed_Point_Static<T,F,A>& rhs)
 	{
 		return (lhs < rhs)? lhs : rhs;
 	}
@@ -525,7 +535,7 @@ namespace FP_numeric
 			__glibcxx_requires_valid_range(__first, __last);
 
 			for (; __first != __last; ++__result, ++__first)
-				*__result = (typename _OI::value_type)(*__first);
+				*__result = (typename std::iterator_traits<_OI>::value_type)(*__first);
 
 			return __result;
 		}
@@ -540,24 +550,24 @@ namespace FP_numeric
 	};
 }
 
-template<typename _IT, size_t T, size_t F, typename _IA, typename _OA>
-void FP_numeric::copy(const std::vector<_IT,                       _IA>& __in_vector, std::vector<Fixed_Point_Static<T ,F >, _OA>& __out_vector)
+template<typename _IT, size_t T, size_t F, FP_numeric::Arithmetic_type A, typename _IA, typename _OA>
+void FP_numeric::copy(const std::vector<_IT,                       _IA>& __in_vector, std::vector<Fixed_Point_Static<T ,F ,A >, _OA>& __out_vector)
 {
 	assert(__in_vector.size() <= __out_vector.size());
 	for (auto i = 0; i < (int)__in_vector.size(); i++)
 		__out_vector[i].set_data(__in_vector[i]);
 }
 
-template<typename _OT, size_t T, size_t F, typename _IA, typename _OA>
-void FP_numeric::copy(const std::vector<Fixed_Point_Static<T ,F >, _IA>& __in_vector, std::vector<_OT,                       _OA>& __out_vector)
+template<typename _OT, size_t T, size_t F, FP_numeric::Arithmetic_type A, typename _IA, typename _OA>
+void FP_numeric::copy(const std::vector<Fixed_Point_Static<T ,F ,A >, _IA>& __in_vector, std::vector<_OT,                       _OA>& __out_vector)
 {
 	assert(__in_vector.size() <= __out_vector.size());
 	for (auto i = 0; i < (int)__in_vector.size(); i++)
 		__out_vector[i] = (_OT)__in_vector[i];
 }
 
-template<size_t Ti, size_t Fi, size_t To, size_t Fo, typename _IA, typename _OA>
-void FP_numeric::copy(const std::vector<Fixed_Point_Static<Ti,Fi>, _IA>& __in_vector, std::vector<Fixed_Point_Static<To,Fo>, _OA>& __out_vector)
+template<size_t Ti, size_t Fi, size_t To, size_t Fo, FP_numeric::Arithmetic_type Ai, FP_numeric::Arithmetic_type Ao, typename _IA, typename _OA>
+void FP_numeric::copy(const std::vector<Fixed_Point_Static<Ti,Fi,Ai>, _IA>& __in_vector, std::vector<Fixed_Point_Static<To,Fo,Ao>, _OA>& __out_vector)
 {
 	std::copy(__in_vector.begin(), __in_vector.end(), __out_vector.begin());
 }
@@ -571,7 +581,9 @@ void FP_numeric::copy(const std::vector<_IT,                       _IA>& __in_ve
 template<typename _II, typename _OI>
 inline _OI FP_numeric::copy(_II __first, _II __last, _OI __result)
 {
-	return copy_FPS<_II,_OI,FP_numeric::is_FP_S<typename _II::value_type>::value,FP_numeric::is_FP_S<typename _OI::value_type>::value>
+	// iterator_traits: the iterators may be pointers, as the ones of FP_span
+	return copy_FPS<_II,_OI,FP_numeric::is_FP_S<typename std::iterator_traits<_II>::value_type>::value,
+	                        FP_numeric::is_FP_S<typename std::iterator_traits<_OI>::value_type>::value>
 	            ::copy(__first, __last, __result);
 }
 
@@ -0,0 +1,95 @@
+#ifndef FIXED_POINT_STATIC_PACKED_HPP_
+#define FIXED_POINT_STATIC_PACKED_HPP_
+
+#include <vector>
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// Bit packing kernels ************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// The packed values are a stream of exactly T bits per value: the value i is stored in the bits [i*T, (i+1)*T) of
+	// the words (least significant bit of the first word first), as its raw data truncated to T bits.
+	// The kernels are vectorized as the batch ones (FP_BATCH_SIMD with -mavx2 or -msse4.1) for the base_type of 32 bits
+	// at most: the unpacking shuffles the bytes of each value in a 32 bits lane (T <= 25), the packing merges the
+	// lanes two by two (four by four if T <= 16) before writing them in the stream.
+
+	// number of words of n packed values of T bits
+	constexpr size_t packed_words(const size_t n, const size_t T);
+
+	// write the n fixed points of first in the slots [index, index + n) of packed, the other slots are kept
+	// return packed + packed_words(index + n, T)
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	uint64_t* pack_n(const Fixed_Point_Static<T,F,A>* first, size_t n, uint64_t* packed, size_t index = 0);
+
+	// read the slots [index, index + n) of packed in result, sign extended as set_data (FP_numeric::sign_extension)
+	// return result + n
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	Fixed_Point_Static<T,F,A>* unpack_n(const uint64_t* packed, size_t index, size_t n, Fixed_Point_Static<T,F,A>* result);
+}
+
+/// ********************************************************************************************************************
+/// FP_packed class ****************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// array of Fixed_Point_Static<T,F,A> stored with exactly T bits per value (pack_n layout) instead of the bits of
+	// the base_type (an FP_S<12,6> takes 12 bits instead of 16), for the recorded traces and their files.
+	// The elements are values (no reference on them): they are read with get or operator[] and written with set,
+	// the ranges are converted from and into arrays of Fixed_Point_Static by the vectorized pack and unpack
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+	class FP_packed
+	{
+		static_assert(T <= 64, "Error in FP_packed : T > 64!");
+
+	public:
+		using value_type = Fixed_Point_Static<T,F,A>;
+		using size_type  = size_t;
+
+		static const size_t bits = T; // bits per value
+
+	private:
+		std::vector<uint64_t> __words;
+		size_type             __size;
+
+	public: // constructors
+		FP_packed();
+		explicit FP_packed(size_type n);                    // n zeros
+		FP_packed(const value_type* first, size_type n); // packed copy of [first, first + n)
+
+	public: // capacity
+		size_type size () const;
+		bool      empty() const;
+		size_type bytes() const;  // bytes of the packed values (the last word is partially used)
+
+		void resize(size_type n); // the new values are zeros
+		void clear ();
+
+	public: // element access
+		value_type get(size_type i) const;
+		void       set(size_type i, const value_type& v);
+		value_type operator[](size_type i) const;
+
+		void push_back(const value_type& v);
+
+		// words of the packed values (packed_words(size(), T) of them)
+		const uint64_t* data() const;
+		      uint64_t* data();
+
+	public: // ranges
+		// unpack the values [first, first + n) in result and return result + n
+		value_type* unpack(size_type first, size_type n, value_type* result) const;
+
+		// pack the n values of values in [first, first + n)
+		void pack(size_type first, const value_type* values, size_type n);
+	};
+}
+
+#include "Fixed_Point_Static_packed.hxx"
+
+#endif /* FIXED_POINT_STATIC_PACKED_HPP_ */
@@ -0,0 +1,419 @@
+#ifndef FIXED_POINT_STATIC_PACKED_HXX_
+#define FIXED_POINT_STATIC_PACKED_HXX_
+
+#include "Fixed_Point_Static_packed.hpp"
+
+/// ********************************************************************************************************************
+/// Bit stream tools (not part of the API) *****************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __packed
+{
+	// the b least significant bits set
+	constexpr uint64_t low_mask(const size_t b)
+	{
+		return (b == 0) ? 0 : ~uint64_t(0) >> (64 - b);
+	}
+
+	// raw data of x truncated to its T bits
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+	inline uint64_t bits_of(const Fixed_Point_Static<T,F,A>& x)
+	{
+		return uint64_t(x.get_data()) & low_mask(T);
+	}
+
+	// the T bits of the slot i of the stream
+	template <size_t T>
+	inline uint64_t read(const uint64_t* w, const size_t i)
+	{
+		const size_t b = i * T;
+		const size_t o = b % 64;
+
+		uint64_t v = w[b / 64] >> o;
+		if (o + T > 64)
+			v |= w[b / 64 + 1] << (64 - o);
+
+		return v & low_mask(T);
+	}
+
+	// write the bits of values of at most 64 bits one after the other from the bit b of the stream
+	// (the bits before b in its word and after the last value in its word are kept)
+	class writer
+	{
+		uint64_t* __w;
+		uint64_t  __acc;  // pending bits of *__w
+		size_t    __fill; // number of pending bits
+
+	public:
+		writer(uint64_t* words, const size_t b) : __w(words + b / 64), __acc(0), __fill(b % 64)
+		{
+			if (__fill)
+				__acc = *__w & low_mask(__fill);
+		}
+
+		// v < 2^bits
+		void put(const uint64_t v, const size_t bits)
+		{
+			__acc |= v << __fill;
+
+			if (__fill + bits >= 64)
+			{
+				*__w++ = __acc;
+				__acc  = (__fill == 0) ? 0 : v >> (64 - __fill);
+				__fill = __fill + bits - 64;
+			}
+			else
+				__fill += bits;
+		}
+
+		// return one past the last written word
+		uint64_t* flush()
+		{
+			if (__fill == 0)
+				return __w;
+
+			*__w = (*__w & ~low_mask(__fill)) | __acc;
+			return __w + 1;
+		}
+	};
+
+	// true if the packing of FP has a vector kernel: the values are handled on 32 bits lanes loaded or stored
+	// as the batch conversions (lanes32), so the unsigned values must stay positive on the signed lanes of base_type
+	template <typename FP>
+	struct has_kernel
+	{
+		using B = typename FP::base_type;
+
+		static const bool value =
+		#if defined(FP_BATCH_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+		                          sizeof(B) <= sizeof(int32_t)
+		                       && (FP_numeric::is_signed_type(FP::Ab) || FP::Tb < 8 * sizeof(B));
+		#else
+		                          false;
+		#endif
+	};
+
+	// read the values of the whole groups from the first byte of a group and return their number
+	// (no kernel for T > 25: a value and its bit offset must fit in the 4 bytes of a lane)
+	template <typename FP, bool vectorized = has_kernel<FP>::value && FP::Tb <= 25>
+	struct unpacker
+	{
+		static size_t run(const uint8_t*, size_t, FP*) { return 0; }
+	};
+
+	// write the first values by whole vectors in the stream and return their number: the T bits of the lanes are
+	// merged two by two in 64 bits lanes (four by four if T <= 16) which are then written in the stream
+	template <typename FP, bool vectorized = has_kernel<FP>::value>
+	struct packer
+	{
+		static size_t run(const FP*, size_t, writer&) { return 0; }
+	};
+
+#if defined(FP_BATCH_SIMD) && (defined(__AVX2__) || defined(__SSE4_1__))
+	using __batch::vec;
+
+	// the values are handled by groups of 8: 8*T bits are exactly T bytes, so the value k of each group always
+	// begins at the same byte and bit offsets from the beginning of its group
+	template <size_t T>
+	struct group8
+	{
+		static constexpr size_t byte(const size_t k) { return k * T / 8; }
+		static constexpr size_t bit (const size_t k) { return k * T % 8; }
+
+		// shuffle control of the half h (values 4h to 4h+3): the byte j of the lane k is the byte j of the value
+		// 4h+k from the 16 bytes loaded at the first byte of the value 4h
+		static constexpr char c(const size_t h, const size_t e)
+		{
+			return char(byte(4*h + e/4) - byte(4*h) + e%4);
+		}
+
+		static __m128i control(const size_t h)
+		{
+			return _mm_setr_epi8(c(h, 0), c(h, 1), c(h,  2), c(h,  3), c(h,  4), c(h,  5), c(h,  6), c(h,  7),
+			                     c(h, 8), c(h, 9), c(h, 10), c(h, 11), c(h, 12), c(h, 13), c(h, 14), c(h, 15));
+		}
+
+		// the value k is moved to the most significant bits of its lane, then shifted back with its sign
+		static constexpr int left(const size_t k) { return int(32 - T - bit(k)); }
+
+		// 4 lanes of the half h of the group at p (values 4h to 4h+3) before the final shift
+		static __m128i half(const uint8_t* p, const size_t h)
+		{
+			const __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + byte(4*h))), control(h));
+
+		#if defined(__AVX2__)
+			return _mm_sllv_epi32(x, _mm_setr_epi32(left(4*h), left(4*h + 1), left(4*h + 2), left(4*h + 3)));
+		#else
+			return _mm_mullo_epi32(x, _mm_setr_epi32(int32_t(uint32_t(1) << left(4*h    )), int32_t(uint32_t(1) << left(4*h + 1)),
+			                                         int32_t(uint32_t(1) << left(4*h + 2)), int32_t(uint32_t(1) << left(4*h + 3))));
+		#endif
+		}
+	};
+
+	template <typename FP>
+	struct unpacker<FP, true>
+	{
+		using B = typename std::make_signed<typename FP::base_type>::type;
+		using G = group8<FP::Tb>;
+
+		static const size_t T     = FP::Tb;
+		static const size_t lanes = sizeof(vec) / sizeof(int32_t);
+		static const size_t group = __batch::lanes32<B>::group;
+		static const size_t block = (lanes * group > 8) ? lanes * group : 8; // values per iteration
+
+		static vec shift(vec v)
+		{
+		#if defined(__AVX2__)
+			return FP_numeric::is_signed_type(FP::Ab) ? _mm256_srai_epi32(v, 32 - T) : _mm256_srli_epi32(v, 32 - T);
+		#else
+			return FP_numeric::is_signed_type(FP::Ab) ? _mm_srai_epi32   (v, 32 - T) : _mm_srli_epi32   (v, 32 - T);
+		#endif
+		}
+
+		static size_t run(const uint8_t* p, size_t n, FP* out)
+		{
+			B* o = reinterpret_cast<B*>(out);
+
+			// the last group of a block loads 16 bytes from its value 4: they must be bytes of the n values
+			const size_t bytes = n * T / 8;
+
+			size_t i = 0;
+			for(; i + block <= n && (i + block - 8) * T / 8 + G::byte(4) + 16 <= bytes; i += block)
+			{
+				vec v[block / lanes];
+				for(size_t g = 0; g < block / 8; g++)
+				{
+					const uint8_t* q = p + (i + 8 * g) * T / 8;
+				#if defined(__AVX2__)
+					v[g] = shift(_mm256_inserti128_si256(_mm256_castsi128_si256(G::half(q, 0)), G::half(q, 1), 1));
+				#else
+					v[2*g    ] = shift(G::half(q, 0));
+					v[2*g + 1] = shift(G::half(q, 1));
+				#endif
+				}
+
+				for(size_t s = 0; s < block / (lanes * group); s++)
+					__batch::lanes32<B>::store(o + i + s * lanes * group, v + s * group);
+			}
+
+			return i;
+		}
+	};
+
+	template <typename FP>
+	struct packer<FP, true>
+	{
+		using B = typename std::make_signed<typename FP::base_type>::type;
+
+		static const size_t T     = FP::Tb;
+		static const size_t lanes = sizeof(vec) / sizeof(int32_t);
+		static const size_t merge = (T <= 16) ? 4 : 2; // values per 64 bits lane
+
+	#if defined(__AVX2__)
+		static vec set1_64(uint64_t v)   { return _mm256_set1_epi64x(int64_t(v)); }
+		static vec srli_64(vec a, int s) { return _mm256_srli_epi64(a, s); }
+		static vec even32 (vec a)        { return _mm256_shuffle_epi32(a, 0xD8); }
+	#else
+		static vec set1_64(uint64_t v)   { return _mm_set1_epi64x(int64_t(v)); }
+		static vec srli_64(vec a, int s) { return _mm_srli_epi64(a, s); }
+		static vec even32 (vec a)        { return _mm_shuffle_epi32(a, 0xD8); }
+	#endif
+
+		// the two 32 bits halves of each 64 bits lane of a (of b bits each) merged on 2b bits
+		static vec pairs(vec a, const size_t b)
+		{
+			const vec lo = set1_64(0x00000000FFFFFFFFu);
+			return __batch::v_or(__batch::v_and(a, lo), srli_64(__batch::v_and(a, set1_64(0xFFFFFFFF00000000u)), int(32 - b)));
+		}
+
+		static size_t run(const FP* in, size_t n, writer& w)
+		{
+			const B* p = reinterpret_cast<const B*>(in);
+
+			const vec mask = set1_64((__packed::low_mask(T) << 32) | __packed::low_mask(T));
+
+			size_t i = 0;
+			for(; i + lanes <= n; i += lanes)
+			{
+				vec v = pairs(__batch::v_and(__batch::lanes32<B>::load(p + i), mask), T);
+				if (merge == 4) // the pairs of the 64 bits lanes 2k and 2k+1 moved to the 32 bits lanes of the lane 2k
+					v = pairs(even32(v), 2 * T);
+
+				uint64_t m[lanes / 2];
+				__batch::store(m, v);
+				for(size_t k = 0; k < lanes / 2; k += (merge == 4) ? 2 : 1)
+					w.put(m[k], merge * T);
+			}
+
+			return i;
+		}
+	};
+#endif
+}
+}
+
+/// ********************************************************************************************************************
+/// Bit packing kernels ************************************************************************************************
+/// ********************************************************************************************************************
+
+constexpr size_t FP_numeric::packed_words(const size_t n, const size_t T)
+{
+	return (n * T + 63) / 64;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+uint64_t* FP_numeric::pack_n(const Fixed_Point_Static<T,F,A>* first, size_t n, uint64_t* packed, size_t index)
+{
+	static_assert(T <= 64, "Error in pack_n : T > 64!");
+
+	__packed::writer w(packed, index * T);
+
+	size_t i = __packed::packer<Fixed_Point_Static<T,F,A>>::run(first, n, w);
+
+	for(; i < n; i++)
+		w.put(__packed::bits_of(first[i]), T);
+
+	w.flush();
+
+	return packed + FP_numeric::packed_words(index + n, T);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+Fixed_Point_Static<T,F,A>* FP_numeric::unpack_n(const uint64_t* packed, size_t index, size_t n, Fixed_Point_Static<T,F,A>* result)
+{
+	static_assert(T <= 64, "Error in unpack_n : T > 64!");
+
+	// the slots before the first whole group of 8 values (beginning at a whole byte)
+	size_t i = 0;
+	for(; i < n && (index + i) % 8 != 0; i++)
+		result[i].set_data(__packed::read<T>(packed, index + i));
+
+	if (i < n)
+		i += __packed::unpacker<Fixed_Point_Static<T,F,A>>::run(reinterpret_cast<const uint8_t*>(packed) + (index + i) * T / 8,
+		                                                      n - i, result + i);
+
+	for(; i < n; i++)
+		result[i].set_data(__packed::read<T>(packed, index + i));
+
+	return result + n;
+}
+
+/// ********************************************************************************************************************
+/// FP_packed class ****************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_packed<T,F,A>::FP_packed() : __words(), __size(0)
+{
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_packed<T,F,A>::FP_packed(size_type n) : __words(FP_numeric::packed_words(n, T), 0), __size(n)
+{
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+FP_numeric::FP_packed<T,F,A>::FP_packed(const value_type* first, size_type n) : FP_packed(n)
+{
+	FP_numeric::pack_n(first, n, __words.data());
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_packed<T,F,A>::size_type FP_numeric::FP_packed<T,F,A>::size() const
+{
+	return __size;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline bool FP_numeric::FP_packed<T,F,A>::empty() const
+{
+	return __size == 0;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_packed<T,F,A>::size_type FP_numeric::FP_packed<T,F,A>::bytes() const
+{
+	return (__size * T + 7) / 8;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_packed<T,F,A>::resize(size_type n)
+{
+	// the bits of the removed values are cleared so that the new ones are zeros
+	if (n < __size && n * T % 64)
+		__words[n * T / 64] &= __packed::low_mask(n * T % 64);
+
+	__words.resize(FP_numeric::packed_words(n, T), 0);
+	__size = n;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_packed<T,F,A>::clear()
+{
+	__words.clear();
+	__size = 0;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_packed<T,F,A>::value_type FP_numeric::FP_packed<T,F,A>::get(size_type i) const
+{
+	value_type x;
+	x.set_data(__packed::read<T>(__words.data(), i));
+	return x;
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline void FP_numeric::FP_packed<T,F,A>::set(size_type i, const value_type& v)
+{
+	const size_t   b = i * T;
+	const size_t   o = b % 64;
+	const uint64_t x = __packed::bits_of(v);
+
+	uint64_t* w = __words.data() + b / 64;
+
+	w[0] = (w[0] & ~(__packed::low_mask(T) << o)) | (x << o);
+	if (o + T > 64)
+		w[1] = (w[1] & ~__packed::low_mask(o + T - 64)) | (x >> (64 - o));
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline typename FP_numeric::FP_packed<T,F,A>::value_type FP_numeric::FP_packed<T,F,A>::operator[](size_type i) const
+{
+	return get(i);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_packed<T,F,A>::push_back(const value_type& v)
+{
+	resize(__size + 1);
+	set(__size - 1, v);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline const uint64_t* FP_numeric::FP_packed<T,F,A>::data() const
+{
+	return __words.data();
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+inline uint64_t* FP_numeric::FP_packed<T,F,A>::data()
+{
+	return __words.data();
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+typename FP_numeric::FP_packed<T,F,A>::value_type*
+FP_numeric::FP_packed<T,F,A>::unpack(size_type first, size_type n, value_type* result) const
+{
+	return FP_numeric::unpack_n(__words.data(), first, n, result);
+}
+
+template <size_t T, size_t F, FP_numeric::Arithmetic_type A>
+void FP_numeric::FP_packed<T,F,A>::pack(size_type first, const value_type* values, size_type n)
+{
+	FP_numeric::pack_n(values, n, __words.data(), first);
+}
+
+#endif /* FIXED_POINT_STATIC_PACKED_HXX_ */
@@ -0,0 +1,88 @@
+#ifndef FIXED_POINT_STATIC_SPAN_HPP_
+#define FIXED_POINT_STATIC_SPAN_HPP_
+
+#include <stdexcept>
+
+#include "Fixed_Point_Static.hpp"
+#include "Fixed_Point_Static_batch.hpp"
+
+/// ********************************************************************************************************************
+/// FP_span class ******************************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// non-owning view of n fixed points FP (or const FP) over an existing range of raw base_type words (ADC samples,
+	// DMA buffers, network frames already in Q format), without any copy: the words are the fixed points, so the
+	// view is given as is to the batch kernels (data()), to the algorithms and to FP_numeric::copy (begin(), end()).
+	// The words must be the raw data of the fixed points, with their sign extended on the unused most significant bits
+	// of base_type (or these bits cleared for the unsigned types), as set_data would store them: sign_extend() does it in
+	// place (vectorized) for the buffers whose unused bits are garbage
+	template <typename FP>
+	class FP_basic_span
+	{
+	public:
+		using value_type      = typename std::remove_const<FP>::type;
+		using element_type    = FP;
+		using base_type       = typename std::conditional<std::is_const<FP>::value, const typename value_type::base_type,
+		                                                                             typename value_type::base_type>::type;
+		using size_type       = size_t;
+		using reference       = FP&;
+		using pointer         = FP*;
+		using iterator        = FP*;
+
+		static_assert(FP_numeric::is_FP_S<value_type>::value, "Error in FP_basic_span : FP is not a Fixed_Point_Static!");
+		static_assert(FP_numeric::has_raw_layout<value_type>::value, "Error in FP_basic_span : the layout is not the one of base_type!");
+
+	private:
+		pointer   __data;
+		size_type __size;
+
+	public: // constructors
+		FP_basic_span();
+		FP_basic_span(pointer first, size_type n);
+		FP_basic_span(base_type* words, size_type n); // the n words of words as fixed points
+
+		// a view of FP is a view of const FP
+		template <typename FPo, typename = typename std::enable_if<std::is_same<const FPo, FP>::value>::type>
+		FP_basic_span(const FP_basic_span<FPo>& o);
+
+	public: // capacity
+		size_type size () const;
+		bool      empty() const;
+
+	public: // element access
+		reference operator[](size_type i) const;
+		reference at        (size_type i) const; // throw std::out_of_range
+		reference front() const;
+		reference back () const;
+
+		pointer    data() const;
+		base_type* raw () const; // the raw base_type words of the fixed points
+
+		iterator begin() const;
+		iterator end  () const;
+
+	public: // sub views
+		FP_basic_span first  (size_type n) const;
+		FP_basic_span last   (size_type n) const;
+		FP_basic_span subspan(size_type offset, size_type n) const;
+
+	public: // raw words
+		// true if all the words are the raw data of fixed points (their unused bits are the extension of their sign)
+		bool canonical() const;
+
+		// extend the sign of the T bits of each word on its unused bits (clear them for the unsigned types) in place
+		void sign_extend() const;
+	};
+
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+	using FP_span = FP_basic_span<Fixed_Point_Static<T,F,A>>;
+
+	template <size_t T, size_t F, FP_numeric::Arithmetic_type A = FP_numeric::Arithmetic_type::SIGNED_SATURATED>
+	using FP_cspan = FP_basic_span<const Fixed_Point_Static<T,F,A>>;
+}
+
+#include "Fixed_Point_Static_span.hxx"
+
+#endif /* FIXED_POINT_STATIC_SPAN_HPP_ */
@@ -0,0 +1,207 @@
+#ifndef FIXED_POINT_STATIC_SPAN_HXX_
+#define FIXED_POINT_STATIC_SPAN_HXX_
+
+#include "Fixed_Point_Static_span.hpp"
+
+/// ********************************************************************************************************************
+/// Sign extension of raw words (not part of the API) ******************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+namespace __span
+{
+	// true if the sign extension of the raw words of FP has a vector kernel (no 8 bits arithmetic shift)
+	template <typename FP>
+	struct has_kernel
+	{
+		using B = typename FP::base_type;
+
+		static const bool value =
+		#if defined(FP_BATCH_SIMD)
+		                          sizeof(B) <= sizeof(int64_t) && FP::Tb < FP::capacity
+		                       && (sizeof(B) > sizeof(int8_t) || !FP_numeric::is_signed_type(FP::Ab));
+		#else
+		                          false;
+		#endif
+	};
+
+	// extend the first words by whole vectors and return their number
+	template <typename FP, bool vectorized = has_kernel<FP>::value>
+	struct extension
+	{
+		static size_t run(typename FP::base_type*, size_t) { return 0; }
+	};
+
+#if defined(FP_BATCH_SIMD)
+	template <typename FP>
+	struct extension<FP, true>
+	{
+		using B = typename std::make_signed<typename FP::base_type>::type;
+		using vec = __batch::vec;
+
+		static const size_t lanes = sizeof(vec) / sizeof(B);
+		static const size_t s     = FP::capacity - FP::Tb;
+
+		// as set_data: the sign extended for the signed types, the unused bits cleared for the unsigned ones
+		static vec extend(vec v, vec,      std::true_type ) { return __batch::ops<B>::template sign_extension<s>(v); }
+		static vec extend(vec v, vec mask, std::false_type) { return __batch::v_and(v, mask); }
+
+		static size_t run(typename FP::base_type* words, size_t n)
+		{
+			using is_signed = std::integral_constant<bool, FP_numeric::is_signed_type(FP::Ab)>;
+
+			B* p = reinterpret_cast<B*>(words);
+
+			using U = typename FP::base_type;
+
+			const vec mask = __batch::ops<B>::set1(B(U(~U(0)) >> s));
+
+			size_t i = 0;
+			for(; i + lanes <= n; i += lanes)
+				__batch::store(p + i, extend(__batch::load(p + i), mask, is_signed()));
+
+			return i;
+		}
+	};
+
+#endif
+}
+}
+
+/// ********************************************************************************************************************
+/// FP_span class ******************************************************************************************************
+/// ********************************************************************************************************************
+
+template <typename FP>
+FP_numeric::FP_basic_span<FP>::FP_basic_span() : __data(nullptr), __size(0)
+{
+}
+
+template <typename FP>
+FP_numeric::FP_basic_span<FP>::FP_basic_span(pointer first, size_type n) : __data(first), __size(n)
+{
+}
+
+template <typename FP>
+FP_numeric::FP_basic_span<FP>::FP_basic_span(base_type* words, size_type n) : __data(reinterpret_cast<pointer>(words)), __size(n)
+{
+}
+
+template <typename FP>
+template <typename FPo, typename>
+FP_numeric::FP_basic_span<FP>::FP_basic_span(const FP_basic_span<FPo>& o) : __data(o.data()), __size(o.size())
+{
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::size_type FP_numeric::FP_basic_span<FP>::size() const
+{
+	return __size;
+}
+
+template <typename FP>
+inline bool FP_numeric::FP_basic_span<FP>::empty() const
+{
+	return __size == 0;
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::reference FP_numeric::FP_basic_span<FP>::operator[](size_type i) const
+{
+	return __data[i];
+}
+
+template <typename FP>
+typename FP_numeric::FP_basic_span<FP>::reference FP_numeric::FP_basic_span<FP>::at(size_type i) const
+{
+	if (i >= __size)
+		throw std::out_of_range("Error in FP_span::at : i >= size()!");
+
+	return __data[i];
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::reference FP_numeric::FP_basic_span<FP>::front() const
+{
+	return __data[0];
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::reference FP_numeric::FP_basic_span<FP>::back() const
+{
+	return __data[__size - 1];
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::pointer FP_numeric::FP_basic_span<FP>::data() const
+{
+	return __data;
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::base_type* FP_numeric::FP_basic_span<FP>::raw() const
+{
+	return reinterpret_cast<base_type*>(__data);
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::iterator FP_numeric::FP_basic_span<FP>::begin() const
+{
+	return __data;
+}
+
+template <typename FP>
+inline typename FP_numeric::FP_basic_span<FP>::iterator FP_numeric::FP_basic_span<FP>::end() const
+{
+	return __data + __size;
+}
+
+template <typename FP>
+inline FP_numeric::FP_basic_span<FP> FP_numeric::FP_basic_span<FP>::first(size_type n) const
+{
+	return FP_basic_span(__data, n);
+}
+
+template <typename FP>
+inline FP_numeric::FP_basic_span<FP> FP_numeric::FP_basic_span<FP>::last(size_type n) const
+{
+	return FP_basic_span(__data + __size - n, n);
+}
+
+template <typename FP>
+inline FP_numeric::FP_basic_span<FP> FP_numeric::FP_basic_span<FP>::subspan(size_type offset, size_type n) const
+{
+	return FP_basic_span(__data + offset, n);
+}
+
+template <typename FP>
+bool FP_numeric::FP_basic_span<FP>::canonical() const
+{
+	const base_type* w = raw();
+
+	value_type x;
+	for (size_type i = 0; i < __size; i++)
+	{
+		x.set_data(w[i]);
+		if (x.get_data() != w[i])
+			return false;
+	}
+
+	return true;
+}
+
+template <typename FP>
+void FP_numeric::FP_basic_span<FP>::sign_extend() const
+{
+	static_assert(!std::is_const<FP>::value, "Error in FP_span::sign_extend : the view is const!");
+
+	base_type* w = raw();
+
+	size_type i = __span::extension<value_type>::run(w, __size);
+
+	for (; i < __size; i++)
+		__data[i].set_data(w[i]);
+}
+
+#endif /* FIXED_POINT_STATIC_SPAN_HXX_ */
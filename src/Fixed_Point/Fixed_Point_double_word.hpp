@@ -0,0 +1,196 @@
+#ifndef FIXED_POINT_DOUBLE_WORD_HPP_
+#define FIXED_POINT_DOUBLE_WORD_HPP_
+
+#include <stdint.h>
+#include <iostream>
+#include <string>
+#include <limits>
+#include <type_traits>
+
+/// ********************************************************************************************************************
+/// Portable 128 bits integers *****************************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// two's complement integer of 128 bits stored in two 64 bits words (least significant word first, as __int128 on
+	// x86_64): base_type of the Fixed_Point_Static of 65 to 128 bits when __int128 is not enabled (see ENABLE_128_BITS).
+	// It behaves as a built-in integer: implicit conversion from the integers, explicit conversions to the integers and
+	// floating points, and wrapped arithmetics modulo 2^128 with the same bits than __int128 / unsigned __int128.
+	// The words are added with a carry chain (compiled in add/adc), the 64x64 bits products use the double word product
+	// of the compiler when it has one (unsigned __int128 of GCC and Clang), else 4 products of 32 bits.
+	template <bool S>
+	class double_word
+	{
+	public:
+		static const bool is_signed = S;
+
+	private:
+		uint64_t __lo;
+		uint64_t __hi;
+
+	public: // constructors
+		constexpr double_word();
+		constexpr double_word(const uint64_t hi, const uint64_t lo); // from the two words
+
+		// implicit from the built-in integers (sign extended if signed), explicit from the other signedness
+		template <typename integral_t, typename std::enable_if<std::is_integral<integral_t>::value, int>::type = 0>
+		constexpr double_word(const integral_t n);
+
+		explicit constexpr double_word(const double_word<!S>& n);
+
+		// truncated toward zero (undefined if out of range, as a built-in conversion)
+		template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type = 0>
+		explicit constexpr double_word(const floating_t x);
+
+	public: // accessors
+		constexpr uint64_t low () const;
+		constexpr uint64_t high() const;
+		constexpr bool     is_neg() const; // the sign bit of a signed double_word
+
+	public: // conversions
+		// low bits of the value (modulo 2^N as a built-in conversion)
+		template <typename integral_t, typename std::enable_if<std::is_integral<integral_t>::value, int>::type = 0>
+		explicit constexpr operator integral_t() const;
+
+		// correctly rounded to the nearest (as the conversion of __int128)
+		template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type = 0>
+		explicit constexpr operator floating_t() const;
+
+	public: // arithmetics modulo 2^128 (a division by zero is undefined as a built-in one)
+		constexpr double_word add(const double_word& o) const;
+		constexpr double_word sub(const double_word& o) const;
+		constexpr double_word mul(const double_word& o) const;
+		constexpr double_word div(const double_word& o) const; // truncated toward zero
+		constexpr double_word mod(const double_word& o) const; // with the sign of this
+		constexpr double_word neg() const;
+
+		constexpr double_word shl(const size_t s) const; // 0 <= s < 128
+		constexpr double_word shr(const size_t s) const; // 0 <= s < 128, arithmetic shift if signed
+
+		constexpr bool equal(const double_word& o) const;
+		constexpr bool less (const double_word& o) const;
+
+	public: // operators
+		friend constexpr double_word operator+ (const double_word& l, const double_word& r) { return l.add(r); }
+		friend constexpr double_word operator- (const double_word& l, const double_word& r) { return l.sub(r); }
+		friend constexpr double_word operator* (const double_word& l, const double_word& r) { return l.mul(r); }
+		friend constexpr double_word operator/ (const double_word& l, const double_word& r) { return l.div(r); }
+		friend constexpr double_word operator% (const double_word& l, const double_word& r) { return l.mod(r); }
+		friend constexpr double_word operator& (const double_word& l, const double_word& r) { return double_word(l.__hi & r.__hi, l.__lo & r.__lo); }
+		friend constexpr double_word operator| (const double_word& l, const double_word& r) { return double_word(l.__hi | r.__hi, l.__lo | r.__lo); }
+		friend constexpr double_word operator^ (const double_word& l, const double_word& r) { return double_word(l.__hi ^ r.__hi, l.__lo ^ r.__lo); }
+		friend constexpr double_word operator<<(const double_word& l, const size_t s)        { return l.shl(s); }
+		friend constexpr double_word operator>>(const double_word& l, const size_t s)        { return l.shr(s); }
+
+		friend constexpr bool operator==(const double_word& l, const double_word& r) { return  l.equal(r); }
+		friend constexpr bool operator!=(const double_word& l, const double_word& r) { return !l.equal(r); }
+		friend constexpr bool operator< (const double_word& l, const double_word& r) { return  l.less (r); }
+		friend constexpr bool operator> (const double_word& l, const double_word& r) { return  r.less (l); }
+		friend constexpr bool operator<=(const double_word& l, const double_word& r) { return !r.less (l); }
+		friend constexpr bool operator>=(const double_word& l, const double_word& r) { return !l.less (r); }
+
+		constexpr double_word operator-() const;
+		constexpr double_word operator+() const;
+		constexpr double_word operator~() const;
+		constexpr bool        operator!() const;
+		explicit constexpr operator bool() const;
+
+		constexpr double_word& operator+= (const double_word& o);
+		constexpr double_word& operator-= (const double_word& o);
+		constexpr double_word& operator*= (const double_word& o);
+		constexpr double_word& operator/= (const double_word& o);
+		constexpr double_word& operator%= (const double_word& o);
+		constexpr double_word& operator&= (const double_word& o);
+		constexpr double_word& operator|= (const double_word& o);
+		constexpr double_word& operator^= (const double_word& o);
+		constexpr double_word& operator<<=(const size_t s);
+		constexpr double_word& operator>>=(const size_t s);
+
+		constexpr double_word& operator++();
+		constexpr double_word& operator--();
+		constexpr double_word  operator++(int);
+		constexpr double_word  operator--(int);
+	};
+
+	using  int128_t = double_word<true >;
+	using uint128_t = double_word<false>;
+
+	// the built-in integers, with __int128 which the standard library only knows in the GNU dialects (-std=gnu++1y,
+	// not -std=c++1y)
+	template <typename T>
+	struct is_builtin_integral : public std::is_integral<T> { };
+
+	// the integer traits of the standard library extended to the double_word and to __int128 (their specialization
+	// is not allowed)
+	template <typename T>
+	struct is_integral : public FP_numeric::is_builtin_integral<T> { };
+
+	template <bool S>
+	struct is_integral<FP_numeric::double_word<S>> : public std::true_type { };
+
+	template <typename T>
+	struct is_signed : public std::is_signed<T> { };
+
+	template <bool S>
+	struct is_signed<FP_numeric::double_word<S>> : public std::integral_constant<bool, S> { };
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
+	template <>
+	struct is_builtin_integral< __int128_t> : public std::true_type { };
+
+	template <>
+	struct is_builtin_integral<__uint128_t> : public std::true_type { };
+
+	template <>
+	struct is_signed< __int128_t> : public std::true_type { };
+
+	template <>
+	struct is_signed<__uint128_t> : public std::false_type { };
+#endif
+
+	// return the 128 bits product of the 64 bits a and b (its most significant word in hi)
+	constexpr uint64_t mul_64x64(const uint64_t a, const uint64_t b, uint64_t& hi);
+
+	// return the decimal (or hexadecimal) writing of n
+	template <bool S>
+	std::string to_string(const FP_numeric::double_word<S>& n, const bool hexadecimal = false);
+
+	// write the decimal digits of n backward, the last one just before last, and return a pointer to the first one (two
+	// digits per division by 100, 20 chars at most, no allocation)
+	char* write_digits(char* last, uint64_t n) noexcept;
+
+	// same for the unsigned integer of the n given words (least significant first, they are consumed): 9 digits per long
+	// division by 10^9 of their 32 bits halves (divisions of the built-in 64 bits integers) until it holds in a word
+	char* write_digits(char* last, uint64_t* words, size_t n) noexcept;
+}
+
+namespace std
+{
+	template <bool S>
+	class numeric_limits<FP_numeric::double_word<S>>
+	{
+	public:
+		static const bool is_specialized = true;
+		static const bool is_signed      = S;
+		static const bool is_integer     = true;
+		static const bool is_exact       = true;
+		static const bool is_modulo      = !S;
+		static const int  digits         = S ? 127 : 128;
+		static const int  radix          = 2;
+
+		static constexpr FP_numeric::double_word<S> min   ();
+		static constexpr FP_numeric::double_word<S> max   ();
+		static constexpr FP_numeric::double_word<S> lowest();
+	};
+
+	template <bool S>
+	string to_string(const FP_numeric::double_word<S>& n);
+}
+
+template <bool S>
+std::ostream& operator<<(std::ostream& s, const FP_numeric::double_word<S>& n);
+
+#include "Fixed_Point_double_word.hxx"
+
+#endif /* FIXED_POINT_DOUBLE_WORD_HPP_ */
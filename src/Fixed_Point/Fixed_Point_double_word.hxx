@@ -0,0 +1,423 @@
+#ifndef FIXED_POINT_DOUBLE_WORD_HXX_
+#define FIXED_POINT_DOUBLE_WORD_HXX_
+
+#include "Fixed_Point_double_word.hpp"
+
+/// ********************************************************************************************************************
+/// Constructors *******************************************************************************************************
+/// ********************************************************************************************************************
+
+template <bool S>
+constexpr FP_numeric::double_word<S>::double_word()
+: __lo(0), __hi(0)
+{
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S>::double_word(const uint64_t hi, const uint64_t lo)
+: __lo(lo), __hi(hi)
+{
+}
+
+template <bool S>
+template <typename integral_t, typename std::enable_if<std::is_integral<integral_t>::value, int>::type>
+constexpr FP_numeric::double_word<S>::double_word(const integral_t n)
+: __lo(uint64_t(n)), __hi((std::is_signed<integral_t>::value && n < integral_t(0)) ? ~uint64_t(0) : uint64_t(0))
+{
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S>::double_word(const double_word<!S>& n)
+: __lo(n.low()), __hi(n.high())
+{
+}
+
+// the magnitude is split in its two words by an exact division by 2^64 (its remainder is exact too)
+template <bool S>
+template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type>
+constexpr FP_numeric::double_word<S>::double_word(const floating_t x)
+: __lo(0), __hi(0)
+{
+	const floating_t two_64 = floating_t(18446744073709551616.0);
+	const floating_t m      = (x < floating_t(0)) ? -x : x;
+	const floating_t h      = floating_t(uint64_t(m / two_64));
+
+	__hi = uint64_t(h);
+	__lo = uint64_t(m - h * two_64);
+
+	if(x < floating_t(0))
+		*this = neg();
+}
+
+/// ********************************************************************************************************************
+/// Accessors and conversions ******************************************************************************************
+/// ********************************************************************************************************************
+
+template <bool S>
+constexpr uint64_t FP_numeric::double_word<S>::low () const
+{
+	return __lo;
+}
+
+template <bool S>
+constexpr uint64_t FP_numeric::double_word<S>::high() const
+{
+	return __hi;
+}
+
+template <bool S>
+constexpr bool FP_numeric::double_word<S>::is_neg() const
+{
+	return S && (__hi >> 63);
+}
+
+template <bool S>
+template <typename integral_t, typename std::enable_if<std::is_integral<integral_t>::value, int>::type>
+constexpr FP_numeric::double_word<S>::operator integral_t() const
+{
+	return integral_t(__lo);
+}
+
+// the magnitude is shifted on 64 bits with a sticky bit (set if a dropped bit is set) so that the single rounding
+// of the 64 bits conversion is the rounding of the whole value, then scaled back by an exact power of 2
+template <bool S>
+template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type>
+constexpr FP_numeric::double_word<S>::operator floating_t() const
+{
+	const double_word<false> m(is_neg() ? neg().__hi : __hi, is_neg() ? neg().__lo : __lo);
+
+	floating_t x = 0;
+	if(m.high() == 0)
+		x = floating_t(m.low());
+	else
+	{
+		size_t s = 0; // number of significant bits of the high word
+		for(uint64_t h = m.high(); h; h >>= 1)
+			s++;
+
+		const uint64_t sticky = (m.low() & (~uint64_t(0) >> (64 - s))) ? 1 : 0;
+		x = floating_t((m >> s).low() | sticky) * floating_t(uint64_t(1) << (s - 1)) * floating_t(2);
+	}
+
+	return is_neg() ? -x : x;
+}
+
+/// ********************************************************************************************************************
+/// Arithmetics ********************************************************************************************************
+/// ********************************************************************************************************************
+
+// the carry of the low words is their sum lower than one of them
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::add(const double_word& o) const
+{
+	const uint64_t lo = __lo + o.__lo;
+	return double_word(__hi + o.__hi + (lo < __lo), lo);
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::sub(const double_word& o) const
+{
+	return double_word(__hi - o.__hi - (__lo < o.__lo), __lo - o.__lo);
+}
+
+// the product modulo 2^128 is the same for the signed and unsigned numbers: only the cross products of the high words
+// with the low ones are needed beside the full product of the low words
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::mul(const double_word& o) const
+{
+	uint64_t hi = 0;
+	const uint64_t lo = FP_numeric::mul_64x64(__lo, o.__lo, hi);
+
+	return double_word(hi + __lo * o.__hi + __hi * o.__lo, lo);
+}
+
+// long division of the magnitudes on the unsigned numbers (a single 64 bits division when both fit in a word)
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::div(const double_word& o) const
+{
+	const double_word<false> n(is_neg()   ? neg()  .__hi : __hi,   is_neg()   ? neg()  .__lo : __lo);
+	const double_word<false> d(o.is_neg() ? o.neg().__hi : o.__hi, o.is_neg() ? o.neg().__lo : o.__lo);
+
+	double_word<false> q, r;
+	if(n.high() == 0 && d.high() == 0)
+		q = n.low() / d.low();
+	else
+	{
+		for(size_t i = 128; i > 0; i--)
+		{
+			r = (r << 1) | ((n >> (i - 1)) & 1u);
+			q = q << 1;
+			if(r >= d)
+			{
+				r -= d;
+				q |= 1u;
+			}
+		}
+	}
+
+	const double_word res(q.high(), q.low());
+	return (is_neg() != o.is_neg()) ? res.neg() : res;
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::mod(const double_word& o) const
+{
+	return sub(div(o).mul(o));
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::neg() const
+{
+	return double_word(~__hi + (__lo == 0), ~__lo + 1);
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::shl(const size_t s) const
+{
+	return (s == 0) ? *this
+	     : (s < 64) ? double_word((__hi << s) | (__lo >> (64 - s)), __lo << s)
+	                : double_word(__lo << (s - 64), 0);
+}
+
+// the signed shift extends the sign: the words are shifted as int64_t (implementation defined before C++20,
+// arithmetic on every supported compiler as the shifts of the signed base_type in Fixed_Point_Static)
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::shr(const size_t s) const
+{
+	const uint64_t sign = is_neg() ? ~uint64_t(0) : uint64_t(0);
+
+	return (s == 0) ? *this
+	     : (s < 64) ? double_word(S ? uint64_t(int64_t(__hi) >> s) : __hi >> s, (__lo >> s) | (__hi << (64 - s)))
+	                : double_word(sign, S ? uint64_t(int64_t(__hi) >> (s - 64)) : __hi >> (s - 64));
+}
+
+template <bool S>
+constexpr bool FP_numeric::double_word<S>::equal(const double_word& o) const
+{
+	return ((__hi ^ o.__hi) | (__lo ^ o.__lo)) == 0;
+}
+
+// the high words are compared with their sign, the low ones without
+template <bool S>
+constexpr bool FP_numeric::double_word<S>::less(const double_word& o) const
+{
+	return (__hi != o.__hi) ? (S ? int64_t(__hi) < int64_t(o.__hi) : __hi < o.__hi) : __lo < o.__lo;
+}
+
+/// ********************************************************************************************************************
+/// Operators **********************************************************************************************************
+/// ********************************************************************************************************************
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::operator-() const
+{
+	return neg();
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::operator+() const
+{
+	return *this;
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::operator~() const
+{
+	return double_word(~__hi, ~__lo);
+}
+
+template <bool S>
+constexpr bool FP_numeric::double_word<S>::operator!() const
+{
+	return (__hi | __lo) == 0;
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S>::operator bool() const
+{
+	return (__hi | __lo) != 0;
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator+= (const double_word& o) { return *this = add(o); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator-= (const double_word& o) { return *this = sub(o); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator*= (const double_word& o) { return *this = mul(o); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator/= (const double_word& o) { return *this = div(o); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator%= (const double_word& o) { return *this = mod(o); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator&= (const double_word& o) { return *this = *this & o; }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator|= (const double_word& o) { return *this = *this | o; }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator^= (const double_word& o) { return *this = *this ^ o; }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator<<=(const size_t s)        { return *this = shl(s); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator>>=(const size_t s)        { return *this = shr(s); }
+
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator++() { return *this = add(1); }
+template <bool S>
+constexpr FP_numeric::double_word<S>& FP_numeric::double_word<S>::operator--() { return *this = sub(1); }
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::operator++(int)
+{
+	const double_word old = *this;
+	*this = add(1);
+	return old;
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> FP_numeric::double_word<S>::operator--(int)
+{
+	const double_word old = *this;
+	*this = sub(1);
+	return old;
+}
+
+/// ********************************************************************************************************************
+/// Tools **************************************************************************************************************
+/// ********************************************************************************************************************
+
+// the double word product of the compiler is a single mul instruction on x86_64 (mul + umulh on AArch64)
+constexpr uint64_t FP_numeric::mul_64x64(const uint64_t a, const uint64_t b, uint64_t& hi)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ using product_t = unsigned __int128;
+
+	const product_t p = product_t(a) * b;
+	hi = uint64_t(p >> 64);
+	return uint64_t(p);
+#else
+	const uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+	const uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+
+	const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF); // can not overflow
+
+	hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+	return (mid << 32) | (p00 & 0xFFFFFFFF);
+#endif
+}
+
+template <bool S>
+inline std::string FP_numeric::to_string(const FP_numeric::double_word<S>& n, const bool hexadecimal)
+{
+	const bool neg = n.is_neg() && !hexadecimal; // the hexadecimal writing is the one of the two's complement bits
+
+	// the digits of the magnitude are written from the end of the buffer (39 decimal digits at most)
+	double_word<false> m(neg ? (-n).high() : n.high(), neg ? (-n).low() : n.low());
+	char buffer[48];
+	char* d = buffer + sizeof(buffer);
+	if (hexadecimal)
+	{
+		do
+		{
+			*--d = "0123456789abcdef"[m.low() & 0xF];
+			m >>= 4;
+		} while (m);
+	}
+	else
+	{
+		uint64_t words[2] = {m.low(), m.high()};
+		d = FP_numeric::write_digits(d, words, 2);
+	}
+
+	if (neg)
+		*--d = '-';
+
+	return std::string(d, buffer + sizeof(buffer));
+}
+
+inline char* FP_numeric::write_digits(char* last, uint64_t n) noexcept
+{
+	static const char pairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	                            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	                            "8081828384858687888990919293949596979899";
+	for (; n >= 100; n /= 100)
+	{
+		const size_t p = size_t(n % 100) * 2;
+		*--last = pairs[p + 1];
+		*--last = pairs[p];
+	}
+
+	if (n >= 10)
+	{
+		*--last = pairs[n * 2 + 1];
+		*--last = pairs[n * 2];
+	}
+	else
+		*--last = char('0' + n);
+
+	return last;
+}
+
+// each half of a word is divided with the remainder of the previous one above it: the partial numerators are lower
+// than 10^9 * 2^32, so the partial quotients hold in 32 bits
+inline char* FP_numeric::write_digits(char* last, uint64_t* words, size_t n) noexcept
+{
+	const uint64_t chunk = 1000000000;
+
+	while (n > 1 && words[n - 1] == 0)
+		n--;
+
+	while (n > 1)
+	{
+		uint64_t rem = 0;
+		for (size_t i = n; i > 0; i--)
+		{
+			const uint64_t hi = (rem << 32) | (words[i - 1] >> 32);
+			const uint64_t lo = ((hi % chunk) << 32) | (words[i - 1] & 0xFFFFFFFF);
+			words[i - 1] = ((hi / chunk) << 32) | (lo / chunk);
+			rem          = lo % chunk;
+		}
+
+		// the 9 digits of the chunk with their leading zeros
+		char* const first = last - 9;
+		last = FP_numeric::write_digits(last, rem);
+		while (last > first)
+			*--last = '0';
+
+		while (n > 1 && words[n - 1] == 0)
+			n--;
+	}
+
+	return FP_numeric::write_digits(last, words[0]);
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> std::numeric_limits<FP_numeric::double_word<S>>::min()
+{
+	return S ? FP_numeric::double_word<S>(uint64_t(1) << 63, 0) : FP_numeric::double_word<S>(0, 0);
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> std::numeric_limits<FP_numeric::double_word<S>>::max()
+{
+	return S ? FP_numeric::double_word<S>(~uint64_t(0) >> 1, ~uint64_t(0)) : FP_numeric::double_word<S>(~uint64_t(0), ~uint64_t(0));
+}
+
+template <bool S>
+constexpr FP_numeric::double_word<S> std::numeric_limits<FP_numeric::double_word<S>>::lowest()
+{
+	return min();
+}
+
+template <bool S>
+inline std::string std::to_string(const FP_numeric::double_word<S>& n)
+{
+	return FP_numeric::to_string(n);
+}
+
+template <bool S>
+inline std::ostream& operator<<(std::ostream& s, const FP_numeric::double_word<S>& n)
+{
+	return s << FP_numeric::to_string(n, (s.flags() & std::ios_base::basefield) == std::ios_base::hex);
+}
+
+#endif /* FIXED_POINT_DOUBLE_WORD_HXX_ */
@@ -0,0 +1,190 @@
+#ifndef FIXED_POINT_MULTI_WORD_HPP_
+#define FIXED_POINT_MULTI_WORD_HPP_
+
+#include <stdint.h>
+#include <iostream>
+#include <string>
+#include <limits>
+#include <type_traits>
+
+#include "Fixed_Point_double_word.hpp"
+
+/// ********************************************************************************************************************
+/// Portable integers of N 64 bits words *******************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// largest base_type of a Fixed_Point_Static (16 words: the magnitudes still hold in a double)
+	static const size_t max_words = 16;
+
+	// two's complement integer of N*64 bits stored in N words (least significant word first): base_type of the
+	// Fixed_Point_Static of 129 to max_words*64 bits, so that the chains of products and quotients stay exact integers.
+	// It behaves as double_word (same interface): implicit conversions from the integers and the double_word, explicit
+	// conversions to them, to the other multi_word and to the floating points, wrapped arithmetics modulo 2^(N*64).
+	// The words are added with carry chains (add/adc), multiplied with the 64x64 bits products of mul_64x64 (mul/mulx)
+	// accumulated in carry chains, divided with the long division of Knuth on 32 bits digits.
+	template <size_t N, bool S>
+	class multi_word
+	{
+		static_assert(N > 2 && N <= FP_numeric::max_words, "Error in multi_word : N is not in ]2, max_words]!");
+
+	public:
+		static const bool   is_signed = S;
+		static const size_t words     = N;
+
+	private:
+		uint64_t __w[N];
+
+	public: // constructors
+		constexpr multi_word();
+
+		// implicit from the built-in integers and the double_word (sign extended if signed)
+		template <typename integral_t, typename std::enable_if<FP_numeric::is_builtin_integral<integral_t>::value, int>::type = 0>
+		constexpr multi_word(const integral_t n);
+
+		template <bool So>
+		constexpr multi_word(const double_word<So>& n);
+
+		// explicit from the other multi_word (truncated or sign extended)
+		template <size_t No, bool So, typename std::enable_if<No != N || So != S, int>::type = 0>
+		explicit constexpr multi_word(const multi_word<No, So>& n);
+
+		// truncated toward zero (undefined if out of range, as a built-in conversion)
+		template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type = 0>
+		explicit constexpr multi_word(const floating_t x);
+
+	public: // accessors
+		constexpr uint64_t word(const size_t i) const; // i-th word from the least significant one
+		constexpr bool     is_neg() const;             // the sign bit of a signed multi_word
+
+	public: // conversions
+		// low bits of the value (modulo 2^N as a built-in conversion)
+		template <typename integral_t, typename std::enable_if<FP_numeric::is_builtin_integral<integral_t>::value, int>::type = 0>
+		explicit constexpr operator integral_t() const;
+
+		template <bool So>
+		explicit constexpr operator double_word<So>() const;
+
+		// correctly rounded to the nearest (as the conversion of double_word)
+		template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type = 0>
+		explicit constexpr operator floating_t() const;
+
+	public: // arithmetics modulo 2^(N*64) (a division by zero is undefined as a built-in one)
+		constexpr multi_word add(const multi_word& o) const;
+		constexpr multi_word sub(const multi_word& o) const;
+		constexpr multi_word mul(const multi_word& o) const;
+		constexpr multi_word div(const multi_word& o) const; // truncated toward zero
+		constexpr multi_word mod(const multi_word& o) const; // with the sign of this
+		constexpr multi_word neg() const;
+
+		constexpr multi_word shl(const size_t s) const; // 0 <= s < N*64
+		constexpr multi_word shr(const size_t s) const; // 0 <= s < N*64, arithmetic shift if signed
+
+		constexpr bool equal(const multi_word& o) const;
+		constexpr bool less (const multi_word& o) const;
+
+	private:
+		constexpr multi_word<N, false> magnitude() const;
+
+		// quotient q and remainder r of the unsigned n / d
+		static constexpr void divmod(const multi_word<N, false>& n, const multi_word<N, false>& d,
+		                             multi_word<N, false>& q, multi_word<N, false>& r);
+
+		template <size_t No, bool So>
+		friend class multi_word;
+
+	public: // operators
+		friend constexpr multi_word operator+ (const multi_word& l, const multi_word& r) { return l.add(r); }
+		friend constexpr multi_word operator- (const multi_word& l, const multi_word& r) { return l.sub(r); }
+		friend constexpr multi_word operator* (const multi_word& l, const multi_word& r) { return l.mul(r); }
+		friend constexpr multi_word operator/ (const multi_word& l, const multi_word& r) { return l.div(r); }
+		friend constexpr multi_word operator% (const multi_word& l, const multi_word& r) { return l.mod(r); }
+		friend constexpr multi_word operator& (const multi_word& l, const multi_word& r) { return l.bitwise(r, 0); }
+		friend constexpr multi_word operator| (const multi_word& l, const multi_word& r) { return l.bitwise(r, 1); }
+		friend constexpr multi_word operator^ (const multi_word& l, const multi_word& r) { return l.bitwise(r, 2); }
+		friend constexpr multi_word operator<<(const multi_word& l, const size_t s)       { return l.shl(s); }
+		friend constexpr multi_word operator>>(const multi_word& l, const size_t s)       { return l.shr(s); }
+
+		friend constexpr bool operator==(const multi_word& l, const multi_word& r) { return  l.equal(r); }
+		friend constexpr bool operator!=(const multi_word& l, const multi_word& r) { return !l.equal(r); }
+		friend constexpr bool operator< (const multi_word& l, const multi_word& r) { return  l.less (r); }
+		friend constexpr bool operator> (const multi_word& l, const multi_word& r) { return  r.less (l); }
+		friend constexpr bool operator<=(const multi_word& l, const multi_word& r) { return !r.less (l); }
+		friend constexpr bool operator>=(const multi_word& l, const multi_word& r) { return !l.less (r); }
+
+		constexpr multi_word operator-() const;
+		constexpr multi_word operator+() const;
+		constexpr multi_word operator~() const;
+		constexpr bool       operator!() const;
+		explicit constexpr operator bool() const;
+
+		constexpr multi_word& operator+= (const multi_word& o);
+		constexpr multi_word& operator-= (const multi_word& o);
+		constexpr multi_word& operator*= (const multi_word& o);
+		constexpr multi_word& operator/= (const multi_word& o);
+		constexpr multi_word& operator%= (const multi_word& o);
+		constexpr multi_word& operator&= (const multi_word& o);
+		constexpr multi_word& operator|= (const multi_word& o);
+		constexpr multi_word& operator^= (const multi_word& o);
+		constexpr multi_word& operator<<=(const size_t s);
+		constexpr multi_word& operator>>=(const size_t s);
+
+		constexpr multi_word& operator++();
+		constexpr multi_word& operator--();
+		constexpr multi_word  operator++(int);
+		constexpr multi_word  operator--(int);
+
+	private:
+		constexpr multi_word bitwise(const multi_word& o, const int op) const; // 0: and, 1: or, 2: xor
+	};
+
+	template <size_t N, bool S>
+	struct is_integral<FP_numeric::multi_word<N, S>> : public std::true_type { };
+
+	template <size_t N, bool S>
+	struct is_signed<FP_numeric::multi_word<N, S>> : public std::integral_constant<bool, S> { };
+
+	// signed (unsigned) integer of at least T bits, from double_word to multi_word<max_words> (void above)
+	template <size_t T, bool S>
+	struct wide_type
+	{
+		using type = typename std::conditional<(T <= 128), FP_numeric::double_word<S>,
+		             typename std::conditional<(T <= FP_numeric::max_words*64), FP_numeric::multi_word<(T <= 128) ? 3 : (T+63)/64, S>,
+		                                       void>::type>::type;
+	};
+
+	// return the decimal (or hexadecimal) writing of n
+	template <size_t N, bool S>
+	std::string to_string(const FP_numeric::multi_word<N, S>& n, const bool hexadecimal = false);
+}
+
+namespace std
+{
+	template <size_t N, bool S>
+	class numeric_limits<FP_numeric::multi_word<N, S>>
+	{
+	public:
+		static const bool is_specialized = true;
+		static const bool is_signed      = S;
+		static const bool is_integer     = true;
+		static const bool is_exact       = true;
+		static const bool is_modulo      = !S;
+		static const int  digits         = int(N*64) - (S ? 1 : 0);
+		static const int  radix          = 2;
+
+		static constexpr FP_numeric::multi_word<N, S> min   ();
+		static constexpr FP_numeric::multi_word<N, S> max   ();
+		static constexpr FP_numeric::multi_word<N, S> lowest();
+	};
+
+	template <size_t N, bool S>
+	string to_string(const FP_numeric::multi_word<N, S>& n);
+}
+
+template <size_t N, bool S>
+std::ostream& operator<<(std::ostream& s, const FP_numeric::multi_word<N, S>& n);
+
+#include "Fixed_Point_multi_word.hxx"
+
+#endif /* FIXED_POINT_MULTI_WORD_HPP_ */
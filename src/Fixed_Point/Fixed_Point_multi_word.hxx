@@ -0,0 +1,555 @@
+#ifndef FIXED_POINT_MULTI_WORD_HXX_
+#define FIXED_POINT_MULTI_WORD_HXX_
+
+#include "Fixed_Point_multi_word.hpp"
+
+/// ********************************************************************************************************************
+/// Constructors *******************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>::multi_word()
+: __w{}
+{
+}
+
+template <size_t N, bool S>
+template <typename integral_t, typename std::enable_if<FP_numeric::is_builtin_integral<integral_t>::value, int>::type>
+constexpr FP_numeric::multi_word<N,S>::multi_word(const integral_t n)
+: __w{}
+{
+	const uint64_t sign = (FP_numeric::is_signed<integral_t>::value && n < integral_t(0)) ? ~uint64_t(0) : uint64_t(0);
+	const size_t   bits = sizeof(integral_t)*8;
+
+	// (an __int128 fills two words when it is enabled)
+	for(size_t i = 0; i < N; i++)
+		__w[i] = (i*64 < bits) ? uint64_t(n >> (i*64 % bits)) : sign;
+}
+
+template <size_t N, bool S>
+template <bool So>
+constexpr FP_numeric::multi_word<N,S>::multi_word(const double_word<So>& n)
+: __w{}
+{
+	const uint64_t sign = n.is_neg() ? ~uint64_t(0) : uint64_t(0);
+
+	__w[0] = n.low();
+	__w[1] = n.high();
+	for(size_t i = 2; i < N; i++)
+		__w[i] = sign;
+}
+
+template <size_t N, bool S>
+template <size_t No, bool So, typename std::enable_if<No != N || So != S, int>::type>
+constexpr FP_numeric::multi_word<N,S>::multi_word(const multi_word<No, So>& n)
+: __w{}
+{
+	const uint64_t sign = n.is_neg() ? ~uint64_t(0) : uint64_t(0);
+
+	for(size_t i = 0; i < N; i++)
+		__w[i] = (i < No) ? n.__w[i] : sign;
+}
+
+// the magnitude is split in its words from the most significant one by exact divisions by powers of 2^64 (a float is
+// first widened to a double: 2^(64*(max_words-1)) does not hold in a float)
+template <size_t N, bool S>
+template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type>
+constexpr FP_numeric::multi_word<N,S>::multi_word(const floating_t x)
+: __w{}
+{
+	using wide_t = typename std::conditional<(sizeof(floating_t) < sizeof(double)), double, floating_t>::type;
+
+	const wide_t two_64 = wide_t(18446744073709551616.0);
+	wide_t m     = (x < floating_t(0)) ? -wide_t(x) : wide_t(x);
+	wide_t scale = 1;
+	for(size_t i = 1; i < N; i++)
+		scale *= two_64;
+
+	for(size_t i = N; i > 0; i--, scale /= two_64)
+	{
+		const wide_t h = wide_t(uint64_t(m / scale));
+		__w[i - 1] = uint64_t(h);
+		m -= h * scale;
+	}
+
+	if(x < floating_t(0))
+		*this = neg();
+}
+
+/// ********************************************************************************************************************
+/// Accessors and conversions ******************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t N, bool S>
+constexpr uint64_t FP_numeric::multi_word<N,S>::word(const size_t i) const
+{
+	return __w[i];
+}
+
+template <size_t N, bool S>
+constexpr bool FP_numeric::multi_word<N,S>::is_neg() const
+{
+	return S && (__w[N - 1] >> 63);
+}
+
+template <size_t N, bool S>
+template <typename integral_t, typename std::enable_if<FP_numeric::is_builtin_integral<integral_t>::value, int>::type>
+constexpr FP_numeric::multi_word<N,S>::operator integral_t() const
+{
+	const size_t bits = sizeof(integral_t)*8;
+
+	integral_t n = 0;
+	for(size_t i = 0; i*64 < bits; i++)
+		n |= integral_t(integral_t(__w[i]) << (i*64 % bits));
+	return n;
+}
+
+template <size_t N, bool S>
+template <bool So>
+constexpr FP_numeric::multi_word<N,S>::operator FP_numeric::double_word<So>() const
+{
+	return FP_numeric::double_word<So>(__w[1], __w[0]);
+}
+
+// as for double_word: the 64 most significant bits of the magnitude with a sticky bit (set if a dropped bit is set) are
+// converted with a single rounding, then scaled back by an exact power of 2 (infinite if out of range)
+template <size_t N, bool S>
+template <typename floating_t, typename std::enable_if<std::is_floating_point<floating_t>::value, int>::type>
+constexpr FP_numeric::multi_word<N,S>::operator floating_t() const
+{
+	const multi_word<N, false> m = magnitude();
+
+	size_t s = N*64; // number of significant bits of the magnitude
+	while(s > 64 && !(m.__w[(s - 1) / 64] >> ((s - 1) % 64)))
+		s--;
+
+	floating_t x = 0;
+	if(s <= 64)
+		x = floating_t(m.__w[0]);
+	else
+	{
+		const multi_word<N, false> top = m >> (s - 64);
+		const uint64_t sticky = ((top << (s - 64)) != m) ? 1 : 0;
+
+		x = floating_t(top.__w[0] | sticky);
+		for(size_t e = s - 64; e > 0; e -= (e >= 32) ? 32 : e)
+			x *= floating_t(uint64_t(1) << ((e >= 32) ? 32 : e));
+	}
+
+	return is_neg() ? -x : x;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N, false> FP_numeric::multi_word<N,S>::magnitude() const
+{
+	return multi_word<N, false>(is_neg() ? neg() : *this);
+}
+
+/// ********************************************************************************************************************
+/// Arithmetics ********************************************************************************************************
+/// ********************************************************************************************************************
+
+// carry chain: each carry is a sum lower than one of its terms (the loop is unrolled in a add/adc sequence)
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::add(const multi_word& o) const
+{
+	multi_word res;
+	uint64_t carry = 0;
+	for(size_t i = 0; i < N; i++)
+	{
+		const uint64_t t = __w[i] + carry;
+		res.__w[i] = t + o.__w[i];
+		carry      = (t < carry) | (res.__w[i] < t);
+	}
+	return res;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::sub(const multi_word& o) const
+{
+	multi_word res;
+	uint64_t borrow = 0;
+	for(size_t i = 0; i < N; i++)
+	{
+		const uint64_t t = __w[i] - o.__w[i];
+		res.__w[i] = t - borrow;
+		borrow     = (__w[i] < o.__w[i]) | (t < borrow);
+	}
+	return res;
+}
+
+// schoolbook product modulo 2^(N*64) (the same for the signed and unsigned numbers): only the products of the words
+// i and j with i + j < N are computed, each row accumulated in a carry chain (a*b + 2 words hold in 128 bits)
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::mul(const multi_word& o) const
+{
+	multi_word res;
+	for(size_t i = 0; i < N; i++)
+	{
+		uint64_t carry = 0;
+		for(size_t j = 0; i + j < N; j++)
+		{
+			uint64_t hi = 0;
+			const uint64_t lo = FP_numeric::mul_64x64(__w[i], o.__w[j], hi);
+
+			const uint64_t t = res.__w[i + j] + lo;
+			res.__w[i + j]   = t + carry;
+			carry            = hi + (t < lo) + (res.__w[i + j] < t);
+		}
+	}
+	return res;
+}
+
+// quotient of the magnitudes, with the sign of the quotient of the built-in integers
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::div(const multi_word& o) const
+{
+	multi_word<N, false> q, r;
+	divmod(magnitude(), o.magnitude(), q, r);
+
+	const multi_word res(q);
+	return (is_neg() != o.is_neg()) ? res.neg() : res;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::mod(const multi_word& o) const
+{
+	multi_word<N, false> q, r;
+	divmod(magnitude(), o.magnitude(), q, r);
+
+	const multi_word res(r);
+	return is_neg() ? res.neg() : res;
+}
+
+// algorithm D of Knuth (The Art of Computer Programming vol. 2, 4.3.1) on 32 bits digits: every step is a 64 by 32 bits
+// division of the built-in integers. The divisor is normalized (its most significant digit has its high bit set) so
+// that each estimated quotient digit is at most 2 above the true one.
+template <size_t N, bool S>
+constexpr void FP_numeric::multi_word<N,S>::divmod(const multi_word<N, false>& n, const multi_word<N, false>& d,
+                                                   multi_word<N, false>& q, multi_word<N, false>& r)
+{
+	const size_t   D = N*2;
+	const uint64_t b = uint64_t(1) << 32;
+
+	uint32_t u[D + 1] = {}, v[D] = {}, qd[D] = {};
+	for(size_t i = 0; i < N; i++)
+	{
+		u[2*i] = uint32_t(n.__w[i]); u[2*i + 1] = uint32_t(n.__w[i] >> 32);
+		v[2*i] = uint32_t(d.__w[i]); v[2*i + 1] = uint32_t(d.__w[i] >> 32);
+	}
+
+	size_t m = D, k = D; // number of digits of the numerator and of the divisor
+	while(m > 0 && u[m - 1] == 0)
+		m--;
+	while(k > 0 && v[k - 1] == 0)
+		k--;
+
+	q = multi_word<N, false>();
+	r = multi_word<N, false>();
+	if(m < k) // n < d
+	{
+		r = n;
+		return;
+	}
+
+	if(k == 1) // single digit divisor: a 64 by 32 bits division per digit
+	{
+		uint64_t rem = 0;
+		for(size_t j = m; j > 0; j--)
+		{
+			const uint64_t cur = (rem << 32) | u[j - 1];
+			qd[j - 1] = uint32_t(cur / v[0]);
+			rem       = cur % v[0];
+		}
+		r.__w[0] = rem;
+	}
+	else
+	{
+		// normalization: shifted left of s bits such that the high bit of the most significant digit of v is set
+		size_t s = 0;
+		while(!((v[k - 1] << s) & 0x80000000u))
+			s++;
+
+		uint32_t vn[D] = {}, un[D + 1] = {};
+		for(size_t i = k - 1; i > 0; i--)
+			vn[i] = uint32_t((uint64_t(v[i]) << s) | (uint64_t(v[i - 1]) >> (32 - s)));
+		vn[0] = uint32_t(uint64_t(v[0]) << s);
+
+		un[m] = uint32_t(uint64_t(u[m - 1]) >> (32 - s));
+		for(size_t i = m - 1; i > 0; i--)
+			un[i] = uint32_t((uint64_t(u[i]) << s) | (uint64_t(u[i - 1]) >> (32 - s)));
+		un[0] = uint32_t(uint64_t(u[0]) << s);
+
+		for(size_t j = m - k + 1; j > 0; j--)
+		{
+			const size_t jj = j - 1;
+
+			// estimation of the quotient digit from the 2 most significant digits, corrected with the third one
+			const uint64_t num  = (uint64_t(un[jj + k]) << 32) | un[jj + k - 1];
+			uint64_t       qhat = num / vn[k - 1];
+			uint64_t       rhat = num % vn[k - 1];
+			while(qhat >= b || qhat * vn[k - 2] > ((rhat << 32) | un[jj + k - 2]))
+			{
+				qhat--;
+				rhat += vn[k - 1];
+				if(rhat >= b)
+					break;
+			}
+
+			// multiply and subtract
+			int64_t  t      = 0;
+			uint64_t borrow = 0;
+			for(size_t i = 0; i < k; i++)
+			{
+				const uint64_t p = qhat * vn[i];
+				t          = int64_t(un[i + jj]) - int64_t(borrow) - int64_t(p & 0xFFFFFFFF);
+				un[i + jj] = uint32_t(t);
+				borrow     = (p >> 32) - uint64_t(t >> 32);
+			}
+			t           = int64_t(un[jj + k]) - int64_t(borrow);
+			un[jj + k]  = uint32_t(t);
+
+			// the estimation was one too large (rare): add the divisor back
+			if(t < 0)
+			{
+				qhat--;
+				uint64_t carry = 0;
+				for(size_t i = 0; i < k; i++)
+				{
+					const uint64_t sum = uint64_t(un[i + jj]) + vn[i] + carry;
+					un[i + jj] = uint32_t(sum);
+					carry      = sum >> 32;
+				}
+				un[jj + k] = uint32_t(un[jj + k] + carry);
+			}
+
+			qd[jj] = uint32_t(qhat);
+		}
+
+		// the remainder is the numerator left, normalized back
+		uint32_t rd[D] = {};
+		for(size_t i = 0; i < k; i++)
+			rd[i] = uint32_t((uint64_t(un[i]) >> s) | ((s == 0) ? 0 : (uint64_t(un[i + 1]) << (32 - s))));
+
+		for(size_t i = 0; i < N; i++)
+			r.__w[i] = uint64_t(rd[2*i]) | (uint64_t(rd[2*i + 1]) << 32);
+	}
+
+	for(size_t i = 0; i < N; i++)
+		q.__w[i] = uint64_t(qd[2*i]) | (uint64_t(qd[2*i + 1]) << 32);
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::neg() const
+{
+	return (~*this).add(multi_word(1));
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::shl(const size_t s) const
+{
+	const size_t ws = s / 64, bs = s % 64;
+
+	multi_word res;
+	for(size_t i = N; i > ws; i--)
+	{
+		const size_t k = i - 1 - ws; // source word
+		res.__w[i - 1] = (__w[k] << bs) | ((bs != 0 && k > 0) ? __w[k - 1] >> (64 - bs) : 0);
+	}
+	return res;
+}
+
+// the vacated words are filled with the sign (if signed), as the arithmetic shift of the built-in integers
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::shr(const size_t s) const
+{
+	const size_t   ws   = s / 64, bs = s % 64;
+	const uint64_t sign = is_neg() ? ~uint64_t(0) : uint64_t(0);
+
+	multi_word res;
+	for(size_t i = 0; i < N; i++)
+	{
+		const uint64_t w0 = (i + ws     < N) ? __w[i + ws]     : sign;
+		const uint64_t w1 = (i + ws + 1 < N) ? __w[i + ws + 1] : sign;
+		res.__w[i] = (bs == 0) ? w0 : (w0 >> bs) | (w1 << (64 - bs));
+	}
+	return res;
+}
+
+template <size_t N, bool S>
+constexpr bool FP_numeric::multi_word<N,S>::equal(const multi_word& o) const
+{
+	uint64_t diff = 0;
+	for(size_t i = 0; i < N; i++)
+		diff |= __w[i] ^ o.__w[i];
+	return diff == 0;
+}
+
+// the most significant words are compared with their sign, the others without
+template <size_t N, bool S>
+constexpr bool FP_numeric::multi_word<N,S>::less(const multi_word& o) const
+{
+	if(__w[N - 1] != o.__w[N - 1])
+		return S ? int64_t(__w[N - 1]) < int64_t(o.__w[N - 1]) : __w[N - 1] < o.__w[N - 1];
+
+	for(size_t i = N - 1; i > 0; i--)
+		if(__w[i - 1] != o.__w[i - 1])
+			return __w[i - 1] < o.__w[i - 1];
+
+	return false;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::bitwise(const multi_word& o, const int op) const
+{
+	multi_word res;
+	for(size_t i = 0; i < N; i++)
+		res.__w[i] = (op == 0) ? __w[i] & o.__w[i] : (op == 1) ? __w[i] | o.__w[i] : __w[i] ^ o.__w[i];
+	return res;
+}
+
+/// ********************************************************************************************************************
+/// Operators **********************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::operator-() const
+{
+	return neg();
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::operator+() const
+{
+	return *this;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::operator~() const
+{
+	multi_word res;
+	for(size_t i = 0; i < N; i++)
+		res.__w[i] = ~__w[i];
+	return res;
+}
+
+template <size_t N, bool S>
+constexpr bool FP_numeric::multi_word<N,S>::operator!() const
+{
+	return equal(multi_word());
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>::operator bool() const
+{
+	return !equal(multi_word());
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator+= (const multi_word& o) { return *this = add(o); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator-= (const multi_word& o) { return *this = sub(o); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator*= (const multi_word& o) { return *this = mul(o); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator/= (const multi_word& o) { return *this = div(o); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator%= (const multi_word& o) { return *this = mod(o); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator&= (const multi_word& o) { return *this = bitwise(o, 0); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator|= (const multi_word& o) { return *this = bitwise(o, 1); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator^= (const multi_word& o) { return *this = bitwise(o, 2); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator<<=(const size_t s)       { return *this = shl(s); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator>>=(const size_t s)       { return *this = shr(s); }
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator++() { return *this = add(1); }
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S>& FP_numeric::multi_word<N,S>::operator--() { return *this = sub(1); }
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::operator++(int)
+{
+	const multi_word old = *this;
+	*this = add(1);
+	return old;
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N,S> FP_numeric::multi_word<N,S>::operator--(int)
+{
+	const multi_word old = *this;
+	*this = sub(1);
+	return old;
+}
+
+/// ********************************************************************************************************************
+/// Tools **************************************************************************************************************
+/// ********************************************************************************************************************
+
+template <size_t N, bool S>
+inline std::string FP_numeric::to_string(const FP_numeric::multi_word<N, S>& n, const bool hexadecimal)
+{
+	const bool neg = n.is_neg() && !hexadecimal; // the hexadecimal writing is the one of the two's complement bits
+
+	multi_word<N, false> m = neg ? multi_word<N, false>(-n) : multi_word<N, false>(n);
+	char buffer[N*20 + 2];
+	char* d = buffer + sizeof(buffer);
+
+	if(hexadecimal)
+	{
+		do
+		{
+			*--d = "0123456789abcdef"[m.word(0) & 0xF];
+			m >>= 4;
+		} while (m);
+	}
+	else
+	{
+		uint64_t words[N] = {};
+		for(size_t i = 0; i < N; i++)
+			words[i] = m.word(i);
+		d = FP_numeric::write_digits(d, words, N);
+	}
+
+	if (neg)
+		*--d = '-';
+
+	return std::string(d, buffer + sizeof(buffer));
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N, S> std::numeric_limits<FP_numeric::multi_word<N, S>>::min()
+{
+	return S ? FP_numeric::multi_word<N, S>(1) << (N*64 - 1) : FP_numeric::multi_word<N, S>(0);
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N, S> std::numeric_limits<FP_numeric::multi_word<N, S>>::max()
+{
+	return S ? ~min() : ~FP_numeric::multi_word<N, S>(0);
+}
+
+template <size_t N, bool S>
+constexpr FP_numeric::multi_word<N, S> std::numeric_limits<FP_numeric::multi_word<N, S>>::lowest()
+{
+	return min();
+}
+
+template <size_t N, bool S>
+inline std::string std::to_string(const FP_numeric::multi_word<N, S>& n)
+{
+	return FP_numeric::to_string(n);
+}
+
+template <size_t N, bool S>
+inline std::ostream& operator<<(std::ostream& s, const FP_numeric::multi_word<N, S>& n)
+{
+	return s << FP_numeric::to_string(n, (s.flags() & std::ios_base::basefield) == std::ios_base::hex);
+}
+
+#endif /* FIXED_POINT_MULTI_WORD_HXX_ */
@@ -0,0 +1,71 @@
+#ifndef FIXED_POINT_THREAD_POOL_HPP_
+#define FIXED_POINT_THREAD_POOL_HPP_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/// ********************************************************************************************************************
+/// Pool of threads for the parallel kernels ***************************************************************************
+/// ********************************************************************************************************************
+
+namespace FP_numeric
+{
+	// fixed set of threads waiting for the tasks of parallel_for: the threads are created once, not at each kernel call
+	class thread_pool
+	{
+	private:
+		// tasks of a parallel_for: a late thread keeps the job it has woken up for, so it never runs a task of the next one
+		struct job
+		{
+			std::function<void(size_t)> f;
+			size_t                      n_tasks;
+			std::atomic<size_t>         next;     // next task to run
+			size_t                      finished; // number of finished tasks (guarded by the mutex of the pool)
+		};
+
+		std::vector<std::thread> __threads;
+
+		std::mutex               __run_mutex; // a single parallel_for at a time
+		std::mutex               __mutex;
+		std::condition_variable  __wake;      // a new job or the end of the pool
+		std::condition_variable  __done;      // all the tasks of the job are done
+
+		std::shared_ptr<job>     __job;
+		size_t                   __generation;
+		bool                     __stop;
+
+	public: // constructors
+		// n_threads threads in addition to the one calling parallel_for (by default, one less than the hardware threads)
+		explicit thread_pool(size_t n_threads = default_size());
+		~thread_pool();
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+	public:
+		// call f(t) for every t in [0, n_tasks) on the threads of the pool and on the calling one, then return once
+		// they are all done
+		template <class Functor>
+		void parallel_for(size_t n_tasks, Functor f);
+
+		size_t size() const; // number of threads of the pool
+
+		// pool shared by the kernels when none is given
+		static thread_pool& global();
+
+		static size_t default_size();
+
+	private:
+		void worker();
+		void run_tasks(job& j); // run the tasks of the job j until there is none left
+	};
+}
+
+#include "Fixed_Point_thread_pool.hxx"
+
+#endif /* FIXED_POINT_THREAD_POOL_HPP_ */
@@ -0,0 +1,115 @@
+#ifndef FIXED_POINT_THREAD_POOL_HXX_
+#define FIXED_POINT_THREAD_POOL_HXX_
+
+#include "Fixed_Point_thread_pool.hpp"
+
+inline FP_numeric::thread_pool::thread_pool(size_t n_threads)
+: __generation(0), __stop(false)
+{
+	for (size_t t = 0; t < n_threads; t++)
+		__threads.emplace_back(&thread_pool::worker, this);
+}
+
+inline FP_numeric::thread_pool::~thread_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(__mutex);
+		__stop = true;
+	}
+	__wake.notify_all();
+
+	for (auto& thread : __threads)
+		thread.join();
+}
+
+template <class Functor>
+void FP_numeric::thread_pool::parallel_for(size_t n_tasks, Functor f)
+{
+	if (n_tasks == 0)
+		return;
+
+	if (__threads.empty() || n_tasks == 1)
+	{
+		for (size_t t = 0; t < n_tasks; t++)
+			f(t);
+		return;
+	}
+
+	std::lock_guard<std::mutex> run_lock(__run_mutex);
+
+	std::shared_ptr<job> j = std::make_shared<job>();
+	j->f        = f;
+	j->n_tasks  = n_tasks;
+	j->next     = 0;
+	j->finished = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(__mutex);
+		__job = j;
+		__generation++;
+	}
+	__wake.notify_all();
+
+	run_tasks(*j);
+
+	std::unique_lock<std::mutex> lock(__mutex);
+	__done.wait(lock, [&]{ return j->finished == j->n_tasks; });
+	__job = nullptr;
+}
+
+inline size_t FP_numeric::thread_pool::size() const
+{
+	return __threads.size();
+}
+
+inline FP_numeric::thread_pool& FP_numeric::thread_pool::global()
+{
+	static thread_pool pool;
+	return pool;
+}
+
+inline size_t FP_numeric::thread_pool::default_size()
+{
+	const size_t hardware = std::thread::hardware_concurrency();
+	return (hardware > 1)? hardware - 1 : 0;
+}
+
+inline void FP_numeric::thread_pool::worker()
+{
+	size_t generation = 0;
+	for (;;)
+	{
+		std::shared_ptr<job> j;
+		{
+			std::unique_lock<std::mutex> lock(__mutex);
+			__wake.wait(lock, [&]{ return __stop || __generation != generation; });
+			if (__stop)
+				return;
+			generation = __generation;
+			j = __job;
+		}
+
+		if (j)
+			run_tasks(*j);
+	}
+}
+
+inline void FP_numeric::thread_pool::run_tasks(job& j)
+{
+	size_t finished = 0;
+	for (size_t t = j.next++; t < j.n_tasks; t = j.next++)
+	{
+		j.f(t);
+		finished++;
+	}
+
+	if (finished > 0)
+	{
+		std::lock_guard<std::mutex> lock(__mutex);
+		j.finished += finished;
+		if (j.finished == j.n_tasks)
+			__done.notify_all();
+	}
+}
+
+#endif /* FIXED_POINT_THREAD_POOL_HXX_ */
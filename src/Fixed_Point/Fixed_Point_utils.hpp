@@ -9,6 +9,9 @@
 #include <string>
 #include <cmath>
 #include <type_traits>
+#include <limits>
+
+#include "Fixed_Point_multi_word.hpp"
 
 #if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
 
@@ -25,29 +28,76 @@
 
 namespace FP_numeric
 {
-	// TODO : manage other arithmetic types cases
-	enum  Arithmetic_type {SIGNED_SATURATED};//, UNSIGNED_SATURATED, CYCLIC};
+	// overflow policy of a Fixed_Point_Static, applied when a value is stored in its quantification:
+	// SIGNED_SATURATED   : clamped in the symmetric range [-max, max]
+	// SIGNED_WRAPPED     : wrapped modulo 2^T in the two's complement range [-max-1, max], without any compare
+	// SIGNED_CHECKED     : as SIGNED_SATURATED but throw std::overflow_error instead of clamping (debug builds)
+	// UNSIGNED_SATURATED : clamped in [0, max] where max = 2^T-1 ulp, stored in an unsigned base_type
+	// UNSIGNED_WRAPPED   : wrapped modulo 2^T in [0, max], without any compare
+	// UNSIGNED_CHECKED   : as UNSIGNED_SATURATED but throw std::overflow_error instead of clamping (debug builds)
+	enum  Arithmetic_type {SIGNED_SATURATED,   SIGNED_WRAPPED,   SIGNED_CHECKED,
+	                       UNSIGNED_SATURATED, UNSIGNED_WRAPPED, UNSIGNED_CHECKED};
+
+	// properties of an Arithmetic_type
+	constexpr bool is_signed_type (const FP_numeric::Arithmetic_type A);
+	constexpr bool is_wrapped_type(const FP_numeric::Arithmetic_type A);
+	constexpr bool is_checked_type(const FP_numeric::Arithmetic_type A);
+
+	// Arithmetic_type of the results of the operations: saturated, signed if one of the operands is signed
+	constexpr FP_numeric::Arithmetic_type result_type(const FP_numeric::Arithmetic_type Al, const FP_numeric::Arithmetic_type Ar);
+
+	// rounding applied when fractional bits are dropped:
+	// TRUNCATED         : toward minus infinity (the arithmetic right shift)
+	// ROUNDED_HALF_UP   : to the nearest, the ties toward plus infinity
+	// ROUNDED_HALF_EVEN : to the nearest, the ties to the even neighbour (convergent rounding: no bias)
+	// ROUNDED_TO_ZERO   : toward zero
+	enum  Rounding_type {TRUNCATED, ROUNDED_HALF_UP, ROUNDED_HALF_EVEN, ROUNDED_TO_ZERO};
+
+	// return the given value val saturated, wrapped or checked (if needed) between min and max in function of the
+	// Arithmetic_type A. For the wrapped types max-min+1 must be a power of 2.
+	template <FP_numeric::Arithmetic_type A, typename T>
+	constexpr T saturate(const T val, const T min, const T max);
+
+	// return the given value val saturated or checked (if needed) at max in function of the Arithmetic_type A
+	// (a single bound can not wrap: the wrapped types are refused at compile time)
+	template <FP_numeric::Arithmetic_type A, typename T>
+	constexpr T saturate_max(const T val, const T max);
+
+	// return the given value val saturated or checked (if needed) at min in function of the Arithmetic_type A
+	template <FP_numeric::Arithmetic_type A, typename T>
+	constexpr T saturate_min(const T val, const T min);
 
-	// return the given value val saturated (if needed) between min and max in function of the Arithmetic_type
-	template <typename T>
-	T saturate(const T val, const T min, const T max, const FP_numeric::Arithmetic_type ar_type);
+	// return the value of data with the point set at the new_fract_bits position that is originally set at old_fract_bits
+	// (the dropped fractional bits are rounded in function of the Rounding_type R)
+	template <FP_numeric::Rounding_type R = FP_numeric::Rounding_type::TRUNCATED, typename T>
+	constexpr T shift_fract(const T data, const size_t new_fract_bits, const size_t old_fract_bits);
 
-	// return the given value val saturated (if needed) at max in function of the Arithmetic_type
-	template <typename T>
-	T saturate_max(const T val, const T max, const FP_numeric::Arithmetic_type ar_type);
+	// return data shifted right of s bits (0 < s <= the size of T) and rounded in function of the Rounding_type R,
+	// without any branch
+	template <FP_numeric::Rounding_type R, typename T>
+	constexpr T round_shift(const T data, const size_t s);
 
-	// return the given value val saturated (if needed) at min in function of the Arithmetic_type
-	template <typename T>
-	T saturate_min(const T val, const T min, const FP_numeric::Arithmetic_type ar_type);
+	// return the floating point number x rounded to an integral_t in function of the Rounding_type R, without any
+	// branch (2*x is clamped in the range of integral_t and a NaN gives 0)
+	template <FP_numeric::Rounding_type R, typename integral_t, typename floating_t>
+	constexpr integral_t round_float(const floating_t x);
 
-	// return the value of data with the point set at the new_fract_bits position that is originally set at old_fract_bits
-	template <typename T>
-	T shift_fract(const T data, const size_t new_fract_bits, const size_t old_fract_bits);
+	// return the integer val saturated in the range of the integer type To (whatever the signedness of both types)
+	template <typename To, typename From>
+	constexpr To saturate_cast(const From val);
 
 	// return the given value on its T type and its given quantification but with its sign extended on the most
 	// significant bits of T
 	template <typename T>
-	T sign_extension(T data, const size_t total_bits);
+	constexpr T sign_extension(T data, const size_t total_bits);
+
+	// return a T with its n least significant bits set (n can be the size of T)
+	template <typename T>
+	constexpr T low_mask(const size_t n);
+
+	// return 2^n as a floating point number (exact and usable in constant expressions, even when n >= 64)
+	template <typename floating_t>
+	constexpr floating_t exp2i(size_t n);
 
 	template <typename FP>
 	std::string display(const FP& n, int precision);
@@ -75,8 +125,9 @@ namespace FP_numeric
 	std::string to_hex(const T data, const size_t n_bits);
 
 
+	// built-in signed integer of at least T bits (void if there is none)
 	template<size_t T>
-	struct matching_type
+	struct matching_native_type
 	{
 		using type = typename std::conditional<T<=sizeof(int8_t)*8, int8_t,
 	                                   typename std::conditional<T<=sizeof(int16_t)*8, int16_t,
@@ -93,12 +144,51 @@ namespace FP_numeric
 	                                 >::type;
 	};
 
+	// signed base_type of the signed Fixed_Point_Static: the portable double_word takes over from 65 to 128 bits when
+	// there is no built-in integer that large, then the multi_word up to max_words*64 bits
+	template<size_t T>
+	struct matching_type
+	{
+		using type = typename std::conditional<std::is_void<typename matching_native_type<T>::type>::value,
+		                                       typename FP_numeric::wide_type<T, true>::type,
+		                                       typename matching_native_type<T>::type>::type;
+	};
+
+	// built-in unsigned integer of at least T bits (void if there is none)
+	template<size_t T>
+	struct matching_native_utype
+	{
+		using type = typename std::conditional<T<=sizeof(uint8_t)*8, uint8_t,
+	                                   typename std::conditional<T<=sizeof(uint16_t)*8, uint16_t,
+	                                   typename std::conditional<T<=sizeof(uint32_t)*8, uint32_t,
+	                                   typename std::conditional<T<=sizeof(uint64_t)*8, uint64_t,
+	                               #if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
+	                                   typename std::conditional<T<=sizeof(__uint128_t)*8, __uint128_t, void>::type
+	                               #else
+	                                   void
+	                               #endif
+	                                   >::type
+	                                   >::type
+	                                   >::type
+	                                 >::type;
+	};
+
+	// unsigned base_type of the unsigned Fixed_Point_Static
+	template<size_t T>
+	struct matching_utype
+	{
+		using type = typename std::conditional<std::is_void<typename matching_native_utype<T>::type>::value,
+		                                       typename FP_numeric::wide_type<T, false>::type,
+		                                       typename matching_native_utype<T>::type>::type;
+	};
+
+	// the temporaries of the conversions stay on the built-in integers
 	template<size_t T>
 	struct next_type_from_size
 	{
-		using type = typename std::conditional<std::is_void<typename matching_type<T*2>::type>::value,
-		                                       typename matching_type<T>::type, // no type above
-		                                       typename matching_type<T*2>::type>::type;
+		using type = typename std::conditional<std::is_void<typename matching_native_type<T*2>::type>::value,
+		                                       typename matching_native_type<T>::type, // no type above
+		                                       typename matching_native_type<T*2>::type>::type;
 	};
 
 	template<typename T>
@@ -112,6 +202,38 @@ namespace FP_numeric
 	{
 		using type = typename std::conditional<sizeof(T1) >= sizeof(T2), T1, T2>::type;
 	};
+
+	template<typename T>
+	struct unsigned_type
+	{
+		using type = typename std::make_unsigned<T>::type;
+	};
+
+	template<bool S>
+	struct unsigned_type<FP_numeric::double_word<S>>
+	{
+		using type = FP_numeric::uint128_t;
+	};
+
+	template<size_t N, bool S>
+	struct unsigned_type<FP_numeric::multi_word<N, S>>
+	{
+		using type = FP_numeric::multi_word<N, false>;
+	};
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
+	template<>
+	struct unsigned_type<__int128_t>
+	{
+		using type = __uint128_t;
+	};
+
+	template<>
+	struct unsigned_type<__uint128_t>
+	{
+		using type = __uint128_t;
+	};
+#endif
 }
 
 #include "Fixed_Point_utils.hxx"
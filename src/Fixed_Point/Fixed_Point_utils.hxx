@@ -3,131 +3,209 @@
 
 #if defined(__GNUC__) && defined(__x86_64__) && defined(ENABLE_128_BITS)
 
+// the digits of the magnitude are written from the end of the buffer by the long divisions of its two words
 inline std::string std::to_string(__int128_t __val)
 {
-	__uint128_t tmp = __val < 0 ? -__val : __val;
-    char buffer[ 128 ];
-    char* d = std::end( buffer );
-    do
-    {
-        -- d;
-        *d = "0123456789"[ tmp % 10 ];
-        tmp /= 10;
-    } while ( tmp != 0 );
-
-    if ( __val < 0 )
-    {
-        -- d;
-        *d = '-';
-    }
-    int len = std::end( buffer ) - d;
-
-    string s(d, len);
-	return s;
+	const __uint128_t m = (__val < 0) ? __uint128_t(0) - __uint128_t(__val) : __uint128_t(__val);
+
+	uint64_t words[2] = {uint64_t(m), uint64_t(m >> 64)};
+	char buffer[48];
+	char* d = FP_numeric::write_digits(std::end(buffer), words, 2);
+	if (__val < 0)
+		*--d = '-';
+
+	return string(d, std::end(buffer));
 }
 
 inline std::string std::to_string(__uint128_t __val)
 {
-	string s = __gnu_cxx::__to_xstring<string>(&std::vsnprintf, 4 * sizeof(__int128)/2,
-				   "%d", (uint64_t)__val);
-	s += __gnu_cxx::__to_xstring<string>(&std::vsnprintf, 4 * sizeof(__int128)/2,
-				   "%d", (uint64_t)(__val >> 64));
+	uint64_t words[2] = {uint64_t(__val), uint64_t(__val >> 64)};
+	char buffer[48];
+	char* d = FP_numeric::write_digits(std::end(buffer), words, 2);
 
-	return s;
+	return string(d, std::end(buffer));
 }
 
 inline std::ostream& operator<<(std::ostream& s, __int128_t __val)
 {
-	s << (int64_t)(__val >> 64);
-	s << (int64_t)__val;
-
-	return s;
+	return s << std::to_string(__val);
 }
 
 inline std::ostream& operator<<(std::ostream& s, __uint128_t __val)
 {
-	s << (uint64_t)(__val >> 64);
-	s << (uint64_t)__val;
-
-	return s;
+	return s << std::to_string(__val);
 }
 
 #endif
 
-// return the given value val saturated (if needed) between min and max in function of the Arithmetic_type
-template <typename T>
-inline T FP_numeric::saturate(const T val, const T min, const T max, const FP_numeric::Arithmetic_type ar_type)
+constexpr bool FP_numeric::is_signed_type (const FP_numeric::Arithmetic_type A)
 {
-	switch(ar_type)
-	{
-//		case FP_numeric::Arithmetic_type::CYCLIC:
-//			return __data & __max;
+	return A == SIGNED_SATURATED || A == SIGNED_WRAPPED || A == SIGNED_CHECKED;
+}
 
-//		case FP_numeric::Arithmetic_type::UNSIGNED_SATURATED:
-		case FP_numeric::Arithmetic_type::SIGNED_SATURATED:
-			return std::min(std::max(val, min), max);
-	}
+constexpr bool FP_numeric::is_wrapped_type(const FP_numeric::Arithmetic_type A)
+{
+	return A == SIGNED_WRAPPED || A == UNSIGNED_WRAPPED;
+}
+
+constexpr bool FP_numeric::is_checked_type(const FP_numeric::Arithmetic_type A)
+{
+	return A == SIGNED_CHECKED || A == UNSIGNED_CHECKED;
+}
 
-	return val;
+constexpr FP_numeric::Arithmetic_type FP_numeric::result_type(const FP_numeric::Arithmetic_type Al,
+                                                              const FP_numeric::Arithmetic_type Ar)
+{
+	return (is_signed_type(Al) || is_signed_type(Ar)) ? SIGNED_SATURATED : UNSIGNED_SATURATED;
 }
 
-// return the given value val saturated (if needed) at max in function of the Arithmetic_type
-template <typename T>
-inline T FP_numeric::saturate_max(const T val, const T max, const FP_numeric::Arithmetic_type ar_type)
+// return the given value val saturated, wrapped or checked (if needed) between min and max in function of the
+// Arithmetic_type A. A is known at compile time: only the code of one policy is left in each instantiation.
+template <FP_numeric::Arithmetic_type A, typename T>
+constexpr T FP_numeric::saturate(const T val, const T min, const T max)
 {
-	switch(ar_type)
-	{
-//		case FP_numeric::Arithmetic_type::CYCLIC:
-//			return __data & __max;
+	// the offset from min is taken modulo max-min+1 (a power of 2) on the unsigned type: no compare, no overflow
+	using utype = typename FP_numeric::unsigned_type<T>::type;
 
-//		case FP_numeric::Arithmetic_type::UNSIGNED_SATURATED:
-		case FP_numeric::Arithmetic_type::SIGNED_SATURATED:
-			return std::min(val, max);
-	}
+	if(FP_numeric::is_wrapped_type(A))
+		return T(utype(utype(utype(val) - utype(min)) & utype(utype(max) - utype(min))) + utype(min));
 
-	return val;
+	if(FP_numeric::is_checked_type(A) && (val < min || val > max))
+		throw std::overflow_error("Fixed point overflow!");
+
+	return std::min(std::max(val, min), max);
 }
 
-// return the given value val saturated (if needed) at min in function of the Arithmetic_type
-template <typename T>
-inline T FP_numeric::saturate_min(const T val, const T min, const FP_numeric::Arithmetic_type ar_type)
+// return the given value val saturated or checked (if needed) at max in function of the Arithmetic_type A
+template <FP_numeric::Arithmetic_type A, typename T>
+constexpr T FP_numeric::saturate_max(const T val, const T max)
 {
-	switch(ar_type)
-	{
-//		case FP_numeric::Arithmetic_type::CYCLIC:
-//			return __data & __max;
+	static_assert(!FP_numeric::is_wrapped_type(A), "Error in saturate_max : a single bound can not wrap!");
 
-//		case FP_numeric::Arithmetic_type::UNSIGNED_SATURATED:
-		case FP_numeric::Arithmetic_type::SIGNED_SATURATED:
-			return std::max(val, min);
-	}
+	if(FP_numeric::is_checked_type(A) && val > max)
+		throw std::overflow_error("Fixed point overflow!");
+
+	return std::min(val, max);
+}
+
+// return the given value val saturated or checked (if needed) at min in function of the Arithmetic_type A
+template <FP_numeric::Arithmetic_type A, typename T>
+constexpr T FP_numeric::saturate_min(const T val, const T min)
+{
+	static_assert(!FP_numeric::is_wrapped_type(A), "Error in saturate_min : a single bound can not wrap!");
+
+	if(FP_numeric::is_checked_type(A) && val < min)
+		throw std::overflow_error("Fixed point overflow!");
 
-	return val;
+	return std::max(val, min);
 }
 
 // return the value of data with the point set at the new_fract_bits position that is originally set at old_fract_bits
-template <typename T>
-inline T FP_numeric::shift_fract(const T data, const size_t new_fract_bits, const size_t old_fract_bits)
+// (the dropped fractional bits are rounded in function of the Rounding_type R)
+template <FP_numeric::Rounding_type R, typename T>
+constexpr T FP_numeric::shift_fract(const T data, const size_t new_fract_bits, const size_t old_fract_bits)
+{
+	// left shift done on the (promoted) unsigned type to stay defined (and usable in constant expressions) on negative data
+	using utype = decltype(typename FP_numeric::unsigned_type<T>::type() + 0u);
+
+	return ((old_fract_bits > new_fract_bits) ? FP_numeric::round_shift<R>(data, old_fract_bits - new_fract_bits)
+	                                          : T(utype(data) << (new_fract_bits - old_fract_bits)));
+}
+
+// return data shifted right of s bits (0 < s <= the size of T) and rounded in function of the Rounding_type R,
+// without any branch: the quotient q is floor(data / 2^s) and the remainder r (in [0, 2^s[) decides the increment
+template <FP_numeric::Rounding_type R, typename T>
+constexpr T FP_numeric::round_shift(const T data, const size_t s)
 {
-	return ((old_fract_bits > new_fract_bits) ? (data >> (old_fract_bits - new_fract_bits))
-	                                          : (data << (new_fract_bits - old_fract_bits)));
+	using utype = decltype(typename FP_numeric::unsigned_type<T>::type() + 0u);
+
+	const T     q    = T(data >> (s - 1) >> 1); // two shifts: defined when s is the size of T
+	const utype r    = utype(data) & utype(FP_numeric::low_mask<T>(s));
+	const utype half = utype(1) << (s - 1);
+
+	return (R == FP_numeric::Rounding_type::TRUNCATED)         ? q
+	     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_UP)   ? T(q + T(r >= half))
+	     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_EVEN) ? T(q + T(r + utype(q & 1) > half)) // a tie goes up for an odd q
+	                                                           : T(q + T((data < T(0)) & (r != 0))); // ROUNDED_TO_ZERO
+}
+
+// return the floating point number x rounded to an integral_t in function of the Rounding_type R, without any branch:
+// 2*x is exact (a power of 2 scaling), its truncation c and its floor f hold the half bit and the sign of x
+// 2*x is first clamped to +/-2^(size of integral_t - 2) in floating point and a NaN gives 0: casting an out of range,
+// infinite or NaN floating point number to an integer is undefined (INT64_MIN on x86 for any of them)
+template <FP_numeric::Rounding_type R, typename integral_t, typename floating_t>
+constexpr integral_t FP_numeric::round_float(const floating_t x)
+{
+	// a float is widened to a double when the bound is above the float range (the multi_word types)
+	using wide_t = typename std::conditional<(sizeof(integral_t)*8 - 2 >= 128 && sizeof(floating_t) < sizeof(double)),
+	                                         double, floating_t>::type;
+
+	const wide_t     lim = std::min(FP_numeric::exp2i<wide_t>(sizeof(integral_t)*8 - 2), std::numeric_limits<wide_t>::max());
+	const wide_t     x2  = (x == x) ? std::max(-lim, std::min(wide_t(x) * wide_t(2), lim)) : wide_t(0);
+	const integral_t c   = integral_t(x2);                              // truncated toward zero
+	const integral_t f   = integral_t(c - integral_t(wide_t(c) > x2));  // floor(2*x)
+	const integral_t h   = integral_t((f + 1) >> 1);                    // floor(x + 1/2)
+
+	return (R == FP_numeric::Rounding_type::TRUNCATED)         ? integral_t(f >> 1)
+	     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_UP)   ? h
+	     : (R == FP_numeric::Rounding_type::ROUNDED_HALF_EVEN) ? integral_t(h - (h & integral_t(bool(f & 1) & (wide_t(f) == x2))))
+	                                                           : integral_t((c + integral_t(c < 0)) >> 1); // ROUNDED_TO_ZERO
+}
+
+// return the integer val saturated in the range of the integer type To (whatever the signedness of both types)
+template <typename To, typename From>
+constexpr To FP_numeric::saturate_cast(const From val)
+{
+	using big_type  = typename FP_numeric::biggest_type<To, From>::type;
+	using big_utype = typename FP_numeric::unsigned_type<big_type>::type;
+
+	// a negative val is compared on the signed types (both are signed), a positive one on the unsigned type
+	return (val < From(0)) ? ((std::is_signed<To>::value && big_type(val) >= big_type(std::numeric_limits<To>::min()))
+	                         ? To(val) : std::numeric_limits<To>::min())
+	                       : ((big_utype(val) <= big_utype(std::numeric_limits<To>::max()))
+	                         ? To(val) : std::numeric_limits<To>::max());
 }
 
 // return the given value on its T type and its given quantification but with its sign extended on the most
 // significant bits of T
 template <typename T>
-inline T FP_numeric::sign_extension(T data, const size_t total_bits)
+constexpr T FP_numeric::sign_extension(T data, const size_t total_bits)
 {
-	const T extension_mask = (~T(0)) << total_bits;
+	using utype = decltype(typename FP_numeric::unsigned_type<T>::type() + 0u);
+
+	if (total_bits >= sizeof(T)*8) // nothing to extend
+		return data;
+
+	const utype extension_mask = (~utype(0)) << total_bits;
 
-	if (data & (T(1) << (total_bits-1))) // if signed
-		data |= extension_mask;
+	if (utype(data) & (utype(1) << (total_bits-1))) // if signed
+		data = T(utype(data) |  extension_mask);
 	else
-		data &= ~extension_mask;
+		data = T(utype(data) & ~extension_mask);
 
 	return data;
 }
 
+// return a T with its n least significant bits set (n can be the size of T)
+template <typename T>
+constexpr T FP_numeric::low_mask(const size_t n)
+{
+	using utype = typename FP_numeric::unsigned_type<T>::type;
+
+	return (n >= sizeof(T)*8) ? T(~utype(0)) : T((utype(1) << n) - 1);
+}
+
+// return 2^n as a floating point number (exact and usable in constant expressions, even when n >= 64)
+template <typename floating_t>
+constexpr floating_t FP_numeric::exp2i(size_t n)
+{
+	floating_t p = 1;
+	for (; n >= 32; n -= 32)
+		p *= floating_t(4294967296.0);
+
+	return p * floating_t(uint32_t(1) << n);
+}
+
 template <typename FP>
 inline std::string FP_numeric::display(const FP& n, int precision)
 {
@@ -154,16 +232,24 @@ inline std::string FP_numeric::display_quantification(const FP& n)
 	                + std::to_string(n.get_fractional_bits()) + std::string(",");
 	switch(n.get_arithmetic_type())
 	{
-//		case FP_numeric::Arithmetic_type::CYCLIC:
-//			str += std::string(" c");
-//		break;
-
-//		case FP_numeric::Arithmetic_type::UNSIGNED_SATURATED:
-//			str += std::string(" u");
-//		break;
 	case FP_numeric::Arithmetic_type::SIGNED_SATURATED:
 		str += std::string(" s");
 	break;
+	case FP_numeric::Arithmetic_type::SIGNED_WRAPPED:
+		str += std::string(" w");
+	break;
+	case FP_numeric::Arithmetic_type::SIGNED_CHECKED:
+		str += std::string(" c");
+	break;
+	case FP_numeric::Arithmetic_type::UNSIGNED_SATURATED:
+		str += std::string(" u");
+	break;
+	case FP_numeric::Arithmetic_type::UNSIGNED_WRAPPED:
+		str += std::string("uw");
+	break;
+	case FP_numeric::Arithmetic_type::UNSIGNED_CHECKED:
+		str += std::string("uc");
+	break;
 	}
 
 	str += std::string(")" );